@@ -26,7 +26,7 @@
 
 // Version number for shader translation API.
 // It is incremented every time the API changes.
-#define ANGLE_SH_VERSION 362
+#define ANGLE_SH_VERSION 364
 
 enum ShShaderSpec
 {
@@ -456,6 +456,10 @@ struct ShCompileOptions
     // Emulate r32f image with an r32ui image
     uint64_t emulateR32fImageAtomicExchange : 1;
 
+    // Record the time and pool memory taken by each stage and pass of the compilation, to be
+    // retrieved with GetCompileProfile().  This does not affect the output.
+    uint64_t profileCompilation : 1;
+
     ShCompileOptionsMetal metal;
     ShPixelLocalStorageOptions pls;
 };
@@ -804,6 +808,33 @@ void ClearResults(const ShHandle handle);
 // Return the version of the shader language.
 int GetShaderVersion(const ShHandle handle);
 
+// Memory used by the translator for the last compilation.  The memory of the translator is
+// allocated in pages, which are reused from previous compilations on the same thread if possible.
+struct CompileMemoryStats
+{
+    // Most memory in use at once, including the built-in symbol table.
+    size_t peakBytes = 0;
+    // Pages that had to be allocated, and pages that were reused.
+    size_t pagesAllocated = 0;
+    size_t pagesReused    = 0;
+};
+void GetCompileMemoryStats(const ShHandle handle, CompileMemoryStats *statsOut);
+
+// A stage or pass of the last compilation, if compiled with the profileCompilation option.
+struct CompileStageProfile
+{
+    const char *name = nullptr;
+    // Stages nest; passes are one deeper than the stage they are part of.
+    int depth = 0;
+    // In seconds, as returned by angle::GetCurrentSystemTime().
+    double startTime = 0;
+    double duration  = 0;
+    // Bytes allocated from the translator's pool, which is only freed after the compilation.
+    size_t poolBytes = 0;
+};
+// Returns the stages and passes in the order they started.  Empty unless profiled.
+const std::vector<CompileStageProfile> &GetCompileProfile(const ShHandle handle);
+
 // Return the currently set language output type.
 ShShaderOutput GetShaderOutputType(const ShHandle handle);
 
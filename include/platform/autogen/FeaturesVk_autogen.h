@@ -409,6 +409,22 @@ struct FeaturesVk : FeatureSetBase
         &members, "http://anglebug.com/42262955"
     };
 
+    FeatureInfo coalesceAsyncQueueSubmits = {
+        "coalesceAsyncQueueSubmits",
+        FeatureCategory::VulkanFeatures,
+        "With asyncCommandQueue, coalesce the submissions that are queued together, "
+        "possibly from different contexts, into a single vkQueueSubmit2 call.",
+        &members,
+    };
+
+    FeatureInfo useTimelineSemaphoreForQueueCompletion = {
+        "useTimelineSemaphoreForQueueCompletion",
+        FeatureCategory::VulkanFeatures,
+        "Track the completion of queue submissions with a timeline semaphore per queue "
+        "instead of a VkFence per submission",
+        &members,
+    };
+
     FeatureInfo slowAsyncCommandQueueForTesting = {
         "slowAsyncCommandQueueForTesting",
         FeatureCategory::VulkanWorkarounds,
@@ -447,6 +463,14 @@ struct FeaturesVk : FeatureSetBase
         &members, "http://anglebug.com/42263158"
     };
 
+    FeatureInfo forceGenerateMipmapOnCPU = {
+        "forceGenerateMipmapOnCPU",
+        FeatureCategory::VulkanFeatures,
+        "Always generate mipmaps on the CPU instead of with compute or blit, to test and "
+        "benchmark the CPU path",
+        &members,
+    };
+
     FeatureInfo supportsRenderPassStoreOpNone = {
         "supportsRenderPassStoreOpNone",
         FeatureCategory::VulkanFeatures,
@@ -834,6 +858,14 @@ struct FeaturesVk : FeatureSetBase
         &members, "http://anglebug.com/42264422"
     };
 
+    FeatureInfo precompileRecordedGraphicsPipelines = {
+        "precompileRecordedGraphicsPipelines",
+        FeatureCategory::VulkanFeatures,
+        "Record the graphics pipelines created by draw calls for each program in the blob "
+        "cache, and precompile them after the program is linked or loaded again",
+        &members,
+    };
+
     FeatureInfo preferDeviceLocalMemoryHostVisible = {
         "preferDeviceLocalMemoryHostVisible",
         FeatureCategory::VulkanFeatures,
@@ -1651,6 +1683,62 @@ struct FeaturesVk : FeatureSetBase
         &members, "https://anglebug.com/42263322"
     };
 
+    FeatureInfo supportsDescriptorBuffer = {
+        "supportsDescriptorBuffer",
+        FeatureCategory::VulkanFeatures,
+        "VkDevice supports the VK_EXT_descriptor_buffer extension along with "
+        "bufferDeviceAddress",
+        &members,
+    };
+
+    FeatureInfo useDescriptorBuffer = {
+        "useDescriptorBuffer",
+        FeatureCategory::VulkanFeatures,
+        "Write program descriptors directly into a per-context ring of descriptor buffers "
+        "(VK_EXT_descriptor_buffer) instead of allocating and caching descriptor sets",
+        &members,
+    };
+
+    FeatureInfo useDescriptorUpdateTemplates = {
+        "useDescriptorUpdateTemplates",
+        FeatureCategory::VulkanFeatures,
+        "Write program descriptor sets with a VkDescriptorUpdateTemplate created per "
+        "descriptor set at link time instead of building VkWriteDescriptorSet arrays",
+        &members,
+    };
+
+    FeatureInfo supportsPushDescriptor = {
+        "supportsPushDescriptor",
+        FeatureCategory::VulkanFeatures,
+        "VkDevice supports the VK_KHR_push_descriptor extension",
+        &members,
+    };
+
+    FeatureInfo usePushDescriptorsForDefaultUniforms = {
+        "usePushDescriptorsForDefaultUniforms",
+        FeatureCategory::VulkanFeatures,
+        "Push the default uniforms (and emulated transform feedback) descriptors with "
+        "vkCmdPushDescriptorSetKHR instead of allocating and caching a descriptor set",
+        &members,
+    };
+
+    FeatureInfo supportsMultiDraw = {
+        "supportsMultiDraw",
+        FeatureCategory::VulkanFeatures,
+        "VkDevice supports the VK_EXT_multi_draw extension, which is used to record "
+        "glMultiDraw* calls as a single draw command when possible",
+        &members,
+    };
+
+    FeatureInfo usePipelineCacheDiskStore = {
+        "usePipelineCacheDiskStore",
+        FeatureCategory::VulkanFeatures,
+        "Keep the pipeline cache in a file in the directory given by "
+        "ANGLE_VK_PIPELINE_CACHE_DIR instead of the blob cache.  Syncs append only the new "
+        "pipeline cache data to the file, without compression",
+        &members,
+    };
+
 };
 
 inline FeaturesVk::FeaturesVk()  = default;
@@ -66,7 +66,8 @@ struct FrontendFeatures : FeatureSetBase
     FeatureInfo singleThreadedTextureDecompression = {
         "singleThreadedTextureDecompression",
         FeatureCategory::FrontendWorkarounds,
-        "Disables multi-threaded decompression of compressed texture formats",
+        "Disables multi-threaded decompression of compressed texture formats and "
+        "multi-threaded conversion of layered texture uploads",
         &members,
     };
 
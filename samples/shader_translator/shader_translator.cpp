@@ -37,6 +37,7 @@ static bool CompileFile(char *fileName, ShHandle compiler, const ShCompileOption
 static void LogMsg(const char *msg, const char *name, const int num, const char *logName);
 static void PrintVariable(const std::string &prefix, size_t index, const sh::ShaderVariable &var);
 static void PrintActiveVariables(ShHandle compiler);
+static void PrintCompileProfile(ShHandle compiler);
 
 // If NUM_SOURCE_STRINGS is set to a value > 1, the input file data is
 // broken into that many chunks. This will affect file/line numbering in
@@ -114,6 +115,9 @@ int main(int argc, char *argv[])
                 case 'u':
                     printActiveVariables = true;
                     break;
+                case 'p':
+                    compileOptions.profileCompilation = true;
+                    break;
                 case 's':
                     if (argv[0][2] == '=')
                     {
@@ -387,6 +391,13 @@ int main(int argc, char *argv[])
                     LogMsg("END", "COMPILER", numCompiles, "VARIABLES");
                     printf("\n\n");
                 }
+                if (compileOptions.profileCompilation)
+                {
+                    LogMsg("BEGIN", "COMPILER", numCompiles, "PROFILE");
+                    PrintCompileProfile(compiler);
+                    LogMsg("END", "COMPILER", numCompiles, "PROFILE");
+                    printf("\n\n");
+                }
                 if (!compiled)
                     failCode = EFailCompile;
                 ++numCompiles;
@@ -445,11 +456,12 @@ void usage()
 {
     // clang-format off
     printf(
-        "Usage: translate [-i -o -u -l -b=e -b=g -b=h9 -x=i -x=d] file1 file2 ...\n"
+        "Usage: translate [-i -o -u -p -l -b=e -b=g -b=h9 -x=i -x=d] file1 file2 ...\n"
         "Where: filename : filename ending in .frag*, .vert*, .comp*, .geom*, .tcs* or .tes*\n"
         "       -i       : print intermediate tree\n"
         "       -o       : print translated code\n"
         "       -u       : print active attribs, uniforms, varyings and program outputs\n"
+        "       -p       : print the time and memory taken by each compilation stage as JSON\n"
         "       -s=e2    : use GLES2 spec (this is by default)\n"
         "       -s=e3    : use GLES3 spec\n"
         "       -s=e31   : use GLES31 spec (in development)\n"
@@ -809,6 +821,25 @@ static void PrintActiveVariables(ShHandle compiler)
     }
 }
 
+static void PrintCompileProfile(ShHandle compiler)
+{
+    // Times are in milliseconds, relative to the start of the compilation.  Passes are one level
+    // deeper than the stage they are part of, and their pool bytes are included in the stage's.
+    const std::vector<sh::CompileStageProfile> &profile = sh::GetCompileProfile(compiler);
+    const double startTime = profile.empty() ? 0 : profile[0].startTime;
+
+    printf("{\n  \"stages\": [");
+    for (size_t i = 0; i < profile.size(); ++i)
+    {
+        const sh::CompileStageProfile &stage = profile[i];
+        printf("%s\n    {\"name\": \"%s\", \"depth\": %d, \"startMs\": %.3f, \"durationMs\": %.3f, "
+               "\"poolBytes\": %zu}",
+               i == 0 ? "" : ",", stage.name, stage.depth, (stage.startTime - startTime) * 1000.0,
+               stage.duration * 1000.0, stage.poolBytes);
+    }
+    printf("\n  ]\n}\n");
+}
+
 static bool ReadShaderSource(const char *fileName, ShaderSource &source)
 {
     FILE *in = fopen(fileName, "rb");
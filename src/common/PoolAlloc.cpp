@@ -13,6 +13,9 @@
 #include <stdint.h>
 #include <stdio.h>
 
+#include <algorithm>
+#include <atomic>
+
 #include "common/angleutils.h"
 #include "common/debug.h"
 #include "common/mathutil.h"
@@ -153,6 +156,63 @@ class PageHeader
     Allocation *lastAllocation;
 #    endif
 };
+
+namespace
+{
+constexpr size_t kDefaultThreadPageCacheLimit = 1024 * 1024;
+std::atomic<size_t> gThreadPageCacheLimit(kDefaultThreadPageCacheLimit);
+
+// Pages of kDefaultPageSize released by the allocators used on a thread, for the next allocators
+// used on the same thread to reuse.  This avoids allocating and freeing the same pages for every
+// shader the compiler translates.
+class ThreadPageCache : angle::NonCopyable
+{
+  public:
+    ~ThreadPageCache() { trim(0); }
+
+    PageHeader *take()
+    {
+        PageHeader *page = mPages;
+        if (page != nullptr)
+        {
+            mPages = page->nextPage;
+            --mPageCount;
+        }
+        return page;
+    }
+
+    void put(PageHeader *page)
+    {
+        page->nextPage = mPages;
+        mPages         = page;
+        ++mPageCount;
+
+        trim(gThreadPageCacheLimit.load(std::memory_order_relaxed) /
+             PoolAllocator::kDefaultPageSize);
+    }
+
+  private:
+    void trim(size_t maxPageCount)
+    {
+        while (mPageCount > maxPageCount)
+        {
+            PageHeader *page = mPages;
+            mPages           = page->nextPage;
+            --mPageCount;
+            delete[] reinterpret_cast<char *>(page);
+        }
+    }
+
+    PageHeader *mPages = nullptr;
+    size_t mPageCount  = 0;
+};
+
+ThreadPageCache &GetThreadPageCache()
+{
+    thread_local ThreadPageCache cache;
+    return cache;
+}
+}  // anonymous namespace
 #endif
 
 //
@@ -165,8 +225,8 @@ PoolAllocator::PoolAllocator(int growthIncrement, int allocationAlignment)
       mPageSize(growthIncrement),
       mFreeList(nullptr),
       mInUseList(nullptr),
+      mInUseBytes(0),
       mNumCalls(0),
-      mTotalBytes(0),
 #endif
       mLocked(false)
 {
@@ -300,6 +360,10 @@ void PoolAllocator::pop(ReleaseStrategy releaseStrategy)
     PageHeader *page   = mStack.back().page;
     mCurrentPageOffset = mStack.back().offset;
 
+    const bool releaseToThreadCache = releaseStrategy == ReleaseStrategy::AllToThreadCache &&
+                                      mPageSize == static_cast<size_t>(kDefaultPageSize) &&
+                                      GetThreadPageCacheLimit() > 0;
+
     while (mInUseList != page)
     {
         // Grab the pageCount before calling the destructor.  While the destructor doesn't actually
@@ -309,8 +373,10 @@ void PoolAllocator::pop(ReleaseStrategy releaseStrategy)
 
         // invoke destructor to free allocation list
         mInUseList->~PageHeader();
+        mInUseBytes -= pageCount * mPageSize;
 
-        if (pageCount > 1 || releaseStrategy == ReleaseStrategy::All)
+        if (pageCount > 1 ||
+            (releaseStrategy != ReleaseStrategy::OnlyMultiPage && !releaseToThreadCache))
         {
             delete[] reinterpret_cast<char *>(mInUseList);
         }
@@ -321,8 +387,15 @@ void PoolAllocator::pop(ReleaseStrategy releaseStrategy)
             // was last used. (crbug.com/1419798)
             __asan_unpoison_memory_region(mInUseList, mPageSize);
 #    endif
-            mInUseList->nextPage = mFreeList;
-            mFreeList            = mInUseList;
+            if (releaseToThreadCache)
+            {
+                GetThreadPageCache().put(mInUseList);
+            }
+            else
+            {
+                mInUseList->nextPage = mFreeList;
+                mFreeList            = mInUseList;
+            }
         }
         mInUseList = nextInUse;
     }
@@ -351,12 +424,13 @@ void *PoolAllocator::allocate(size_t numBytes)
 {
     ASSERT(!mLocked);
 
+    mStats.allocatedBytes += numBytes;
+
 #if !defined(ANGLE_DISABLE_POOL_ALLOC)
     //
     // Just keep some interesting statistics.
     //
     ++mNumCalls;
-    mTotalBytes += numBytes;
 
     uint8_t *currentPagePtr = reinterpret_cast<uint8_t *>(mInUseList) + mCurrentPageOffset;
 
@@ -399,8 +473,10 @@ void *PoolAllocator::allocate(size_t numBytes)
         }
 
         // Use placement-new to initialize header
-        new (memory) PageHeader(mInUseList, (numBytesToAlloc + mPageSize - 1) / mPageSize);
+        const size_t pageCount = (numBytesToAlloc + mPageSize - 1) / mPageSize;
+        new (memory) PageHeader(mInUseList, pageCount);
         mInUseList = memory;
+        onPagesAdded(pageCount, false);
 
         // Make next allocation come from a new page
         mCurrentPageOffset = mPageSize;
@@ -429,15 +505,20 @@ void *PoolAllocator::allocate(size_t numBytes)
 #if !defined(ANGLE_DISABLE_POOL_ALLOC)
 uint8_t *PoolAllocator::allocateNewPage(size_t numBytes)
 {
-    // Need a simple page to allocate from.  Pick a page from the free list, if any.  Otherwise need
-    // to make the allocation.
-    PageHeader *memory;
-    if (mFreeList)
+    // Need a simple page to allocate from.  Pick a page from the free list, or the page cache of
+    // the thread, if any.  Otherwise need to make the allocation.
+    PageHeader *memory = mFreeList;
+    if (memory != nullptr)
     {
-        memory    = mFreeList;
         mFreeList = mFreeList->nextPage;
     }
-    else
+    else if (mPageSize == static_cast<size_t>(kDefaultPageSize))
+    {
+        memory = GetThreadPageCache().take();
+    }
+
+    const bool reused = memory != nullptr;
+    if (!reused)
     {
         memory = reinterpret_cast<PageHeader *>(::new char[mPageSize]);
         if (memory == nullptr)
@@ -448,6 +529,7 @@ uint8_t *PoolAllocator::allocateNewPage(size_t numBytes)
     // Use placement-new to initialize header
     new (memory) PageHeader(mInUseList, 1);
     mInUseList = memory;
+    onPagesAdded(1, reused);
 
     // Leave room for the page header.
     mCurrentPageOffset      = mPageHeaderSkip;
@@ -463,6 +545,13 @@ uint8_t *PoolAllocator::allocateNewPage(size_t numBytes)
     return reinterpret_cast<uint8_t *>(mInUseList) + mPageHeaderSkip + preAllocationPadding;
 }
 
+void PoolAllocator::onPagesAdded(size_t pageCount, bool reused)
+{
+    mInUseBytes += pageCount * mPageSize;
+    mStats.peakBytes = std::max(mStats.peakBytes, mInUseBytes);
+    (reused ? mStats.pagesReused : mStats.pagesAllocated) += pageCount;
+}
+
 void *PoolAllocator::initializeAllocation(uint8_t *memory, size_t numBytes)
 {
 #    if defined(ANGLE_POOL_ALLOC_GUARD_BLOCKS)
@@ -486,6 +575,32 @@ void PoolAllocator::unlock()
     mLocked = false;
 }
 
+void PoolAllocator::resetStats()
+{
+    mStats = {};
+#if !defined(ANGLE_DISABLE_POOL_ALLOC)
+    mStats.peakBytes = mInUseBytes;
+#endif
+}
+
+// static
+void PoolAllocator::SetThreadPageCacheLimit(size_t limitBytes)
+{
+#if !defined(ANGLE_DISABLE_POOL_ALLOC)
+    gThreadPageCacheLimit.store(limitBytes, std::memory_order_relaxed);
+#endif
+}
+
+// static
+size_t PoolAllocator::GetThreadPageCacheLimit()
+{
+#if !defined(ANGLE_DISABLE_POOL_ALLOC)
+    return gThreadPageCacheLimit.load(std::memory_order_relaxed);
+#else
+    return 0;
+#endif
+}
+
 //
 // Check all allocations in a list for damage by calling check on each.
 //
@@ -60,14 +60,33 @@ class PoolAllocator : angle::NonCopyable
     {
         OnlyMultiPage,
         All,
+        // Like All, but single pages of kDefaultPageSize are given to the page cache of the
+        // calling thread, for the allocators used next on this thread to reuse.
+        AllToThreadCache,
+    };
+
+    // Statistics of the pages used by the allocator since the last resetStats().
+    struct Stats
+    {
+        // Most memory held in pages at once, including the pages in use when the statistics were
+        // reset.
+        size_t peakBytes = 0;
+        // Pages that were newly allocated, and pages that were reused from the free list or the
+        // page cache of the thread.
+        size_t pagesAllocated = 0;
+        size_t pagesReused    = 0;
+        // Bytes requested through allocate(), excluding padding and guard blocks.
+        size_t allocatedBytes = 0;
     };
 
     static const int kDefaultAlignment = sizeof(void *);
+    static const int kDefaultPageSize  = 8 * 1024;
     //
     // Create PoolAllocator. If alignment is set to 1 byte then fastAllocate()
     //  function can be used to make allocations with less overhead.
     //
-    PoolAllocator(int growthIncrement = 8 * 1024, int allocationAlignment = kDefaultAlignment);
+    PoolAllocator(int growthIncrement = kDefaultPageSize,
+                  int allocationAlignment = kDefaultAlignment);
 
     //
     // Don't call the destructor just to free up the memory, call pop()
@@ -138,6 +157,16 @@ class PoolAllocator : angle::NonCopyable
     void lock();
     void unlock();
 
+    const Stats &getStats() const { return mStats; }
+    void resetStats();
+
+    //
+    // Set the most memory the page cache of each thread holds.  Pages given to a full cache are
+    // freed, and a limit of 0 disables the caches.
+    //
+    static void SetThreadPageCacheLimit(size_t limitBytes);
+    static size_t GetThreadPageCacheLimit();
+
   private:
     size_t mAlignment;  // all returned allocations will be aligned at
                         // this granularity, which will be a power of 2
@@ -153,6 +182,8 @@ class PoolAllocator : angle::NonCopyable
     uint8_t *allocateNewPage(size_t numBytes);
     // Track allocations if and only if we're using guard blocks
     void *initializeAllocation(uint8_t *memory, size_t numBytes);
+    // Update the statistics with pages added to mInUseList
+    void onPagesAdded(size_t pageCount, bool reused);
 
     // Granularity of allocation from the OS
     size_t mPageSize;
@@ -171,14 +202,16 @@ class PoolAllocator : angle::NonCopyable
     PageHeader *mInUseList;
     // Stack of where to allocate from, to partition pool
     AllocStack mStack;
+    // Memory held in mInUseList
+    size_t mInUseBytes;
 
-    int mNumCalls;       // just an interesting statistic
-    size_t mTotalBytes;  // just an interesting statistic
+    int mNumCalls;  // just an interesting statistic
 
 #else  // !defined(ANGLE_DISABLE_POOL_ALLOC)
     std::vector<std::vector<void *>> mStack;
 #endif
 
+    Stats mStats;
     bool mLocked;
 };
 
@@ -50,6 +50,61 @@ TEST(PoolAllocatorTest, Interface)
     poolAllocator.popAll();
 }
 
+#if !defined(ANGLE_DISABLE_POOL_ALLOC)
+// Verify that pages released to the page cache of the thread are reused by the next allocators,
+// up to the limit of the cache
+TEST(PoolAllocatorTest, ThreadPageCache)
+{
+    // Every allocation takes a page of its own.
+    constexpr size_t kAllocationSize = PoolAllocator::kDefaultPageSize / 2;
+    constexpr size_t kPageCount      = 8;
+    const size_t defaultLimit        = PoolAllocator::GetThreadPageCacheLimit();
+
+    auto allocatePages = [&](PoolAllocator *poolAllocator) {
+        for (size_t i = 0; i < kPageCount; ++i)
+        {
+            EXPECT_NE(nullptr, poolAllocator->allocate(kAllocationSize));
+        }
+    };
+
+    PoolAllocator::SetThreadPageCacheLimit(kPageCount * PoolAllocator::kDefaultPageSize);
+    {
+        PoolAllocator poolAllocator;
+        poolAllocator.push();
+        allocatePages(&poolAllocator);
+        EXPECT_EQ(kPageCount, poolAllocator.getStats().pagesAllocated +
+                                  poolAllocator.getStats().pagesReused);
+        EXPECT_EQ(kPageCount * PoolAllocator::kDefaultPageSize,
+                  poolAllocator.getStats().peakBytes);
+        EXPECT_EQ(kPageCount * kAllocationSize, poolAllocator.getStats().allocatedBytes);
+        poolAllocator.pop(PoolAllocator::ReleaseStrategy::AllToThreadCache);
+    }
+    {
+        PoolAllocator poolAllocator;
+        allocatePages(&poolAllocator);
+        EXPECT_EQ(0u, poolAllocator.getStats().pagesAllocated);
+        EXPECT_EQ(kPageCount, poolAllocator.getStats().pagesReused);
+    }
+
+    // Only two pages are kept by the cache with a smaller limit.
+    PoolAllocator::SetThreadPageCacheLimit(2 * PoolAllocator::kDefaultPageSize);
+    {
+        PoolAllocator poolAllocator;
+        poolAllocator.push();
+        allocatePages(&poolAllocator);
+        poolAllocator.pop(PoolAllocator::ReleaseStrategy::AllToThreadCache);
+    }
+    {
+        PoolAllocator poolAllocator;
+        allocatePages(&poolAllocator);
+        EXPECT_EQ(kPageCount - 2, poolAllocator.getStats().pagesAllocated);
+        EXPECT_EQ(2u, poolAllocator.getStats().pagesReused);
+    }
+
+    PoolAllocator::SetThreadPageCacheLimit(defaultLimit);
+}
+#endif
+
 #if !defined(ANGLE_POOL_ALLOC_GUARD_BLOCKS)
 // Verify allocations are correctly aligned for different alignments
 class PoolAllocatorAlignmentTest : public testing::TestWithParam<int>
@@ -140,6 +140,8 @@ struct PerfMonitorTriplet
     FN(pipelineCreationTotalCacheHitsDurationNs)   \
     FN(pipelineCreationTotalCacheMissesDurationNs) \
     FN(monolithicPipelineCreation)                 \
+    FN(graphicsPipelinePrecompileHits)             \
+    FN(graphicsPipelinePrecompileMisses)           \
     FN(descriptorSetAllocations)                   \
     FN(descriptorSetCacheTotalSize)                \
     FN(descriptorSetCacheKeySizeBytes)             \
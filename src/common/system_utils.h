@@ -49,6 +49,9 @@ Optional<std::string> GetTempDirectory();
 Optional<std::string> CreateTemporaryFileInDirectory(const std::string &directory);
 Optional<std::string> CreateTemporaryFile();
 
+// Renames |oldPath| to |newPath|, atomically replacing |newPath| if it already exists.
+bool RenameFile(const char *oldPath, const char *newPath);
+
 #if defined(ANGLE_PLATFORM_POSIX)
 // Same as CreateTemporaryFileInDirectory(), but allows for supplying an extension.
 Optional<std::string> CreateTemporaryFileInDirectoryWithExtension(const std::string &directory,
@@ -191,6 +194,58 @@ bool UnprotectMemory(uintptr_t start, size_t size);
 
 size_t GetPageSize();
 
+// Maps the file at |path| into memory for reading.  Returns nullptr if the file cannot be opened or
+// is empty.  The mapping must be released with UnmapFile().
+const uint8_t *MapFileForReading(const char *path, size_t *sizeOut);
+void UnmapFile(const uint8_t *data, size_t size);
+
+class MemoryMappedFile : angle::NonCopyable
+{
+  public:
+    MemoryMappedFile() {}
+    ~MemoryMappedFile() { close(); }
+
+    [[nodiscard]] bool open(const char *path)
+    {
+        close();
+        mData = MapFileForReading(path, &mSize);
+        return mData != nullptr;
+    }
+
+    void close()
+    {
+        if (mData)
+        {
+            UnmapFile(mData, mSize);
+            mData = nullptr;
+            mSize = 0;
+        }
+    }
+
+    const uint8_t *data() const { return mData; }
+    size_t size() const { return mSize; }
+
+  private:
+    const uint8_t *mData = nullptr;
+    size_t mSize         = 0;
+};
+
+// Takes an exclusive, advisory lock on the file at |path|, which is created if needed, and holds it
+// until destroyed.  Waits while another process, or another ScopedFileLock of this process, holds
+// the lock.  Used to serialize writers of files that are shared between processes.
+class ScopedFileLock : angle::NonCopyable
+{
+  public:
+    explicit ScopedFileLock(const char *path);
+    ~ScopedFileLock();
+
+    bool isLocked() const { return mHandle != -1; }
+
+  private:
+    // File descriptor on POSIX, HANDLE on Windows.
+    intptr_t mHandle = -1;
+};
+
 // Return type of the PageFaultCallback
 enum class PageFaultHandlerRangeType
 {
@@ -13,11 +13,14 @@
 #include <iostream>
 
 #include <dlfcn.h>
+#include <fcntl.h>
 #include <grp.h>
 #include <inttypes.h>
 #include <pwd.h>
+#include <errno.h>
 #include <signal.h>
 #include <string.h>
+#include <sys/file.h>
 #include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
@@ -354,6 +357,11 @@ Optional<std::string> CreateTemporaryFileInDirectoryWithExtension(const std::str
     return Optional<std::string>::Invalid();
 }
 
+bool RenameFile(const char *oldPath, const char *newPath)
+{
+    return rename(oldPath, newPath) == 0;
+}
+
 double GetCurrentProcessCpuTime()
 {
 #ifdef ANGLE_PLATFORM_FUCHSIA
@@ -478,6 +486,72 @@ size_t GetPageSize()
     return static_cast<size_t>(pageSize);
 }
 
+const uint8_t *MapFileForReading(const char *path, size_t *sizeOut)
+{
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        return nullptr;
+    }
+
+    struct stat info;
+    void *data = MAP_FAILED;
+    if (fstat(fd, &info) == 0 && info.st_size > 0)
+    {
+        data = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+
+    // The mapping stays valid after the file descriptor is closed.
+    close(fd);
+
+    if (data == MAP_FAILED)
+    {
+        return nullptr;
+    }
+
+    *sizeOut = static_cast<size_t>(info.st_size);
+    return static_cast<const uint8_t *>(data);
+}
+
+void UnmapFile(const uint8_t *data, size_t size)
+{
+    munmap(const_cast<uint8_t *>(data), size);
+}
+
+ScopedFileLock::ScopedFileLock(const char *path)
+{
+    int fd = open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (fd < 0)
+    {
+        return;
+    }
+
+    // flock() locks are owned by the open file description, so they also serialize threads of
+    // the same process that open the file separately.
+    int result = 0;
+    do
+    {
+        result = flock(fd, LOCK_EX);
+    } while (result != 0 && errno == EINTR);
+
+    if (result != 0)
+    {
+        close(fd);
+        return;
+    }
+
+    mHandle = fd;
+}
+
+ScopedFileLock::~ScopedFileLock()
+{
+    // Closing the file releases the lock.
+    if (isLocked())
+    {
+        close(static_cast<int>(mHandle));
+    }
+}
+
 PageFaultHandler *CreatePageFaultHandler(PageFaultCallback callback)
 {
     gPosixPageFaultHandler = new PosixPageFaultHandler(callback);
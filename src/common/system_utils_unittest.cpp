@@ -12,8 +12,10 @@
 #include "common/system_utils.h"
 #include "util/test_utils.h"
 
+#include <atomic>
 #include <fstream>
 #include <sstream>
+#include <thread>
 #include <vector>
 
 #if defined(ANGLE_PLATFORM_POSIX)
@@ -214,9 +216,15 @@ TEST(SystemUtils, IsFullPath)
 #if defined(ANGLE_PLATFORM_ANDROID)
 #    define MAYBE_CreateAndDeleteTemporaryFile DISABLED_CreateAndDeleteTemporaryFile
 #    define MAYBE_CreateAndDeleteFileInTempDir DISABLED_CreateAndDeleteFileInTempDir
+#    define MAYBE_MemoryMappedFile DISABLED_MemoryMappedFile
+#    define MAYBE_RenameFile DISABLED_RenameFile
+#    define MAYBE_ScopedFileLock DISABLED_ScopedFileLock
 #else
 #    define MAYBE_CreateAndDeleteTemporaryFile CreateAndDeleteTemporaryFile
 #    define MAYBE_CreateAndDeleteFileInTempDir CreateAndDeleteFileInTempDir
+#    define MAYBE_MemoryMappedFile MemoryMappedFile
+#    define MAYBE_RenameFile RenameFile
+#    define MAYBE_ScopedFileLock ScopedFileLock
 #endif  // defined(ANGLE_PLATFORM_ANDROID)
 
 // Test creating/using temporary file
@@ -282,6 +290,98 @@ TEST(SystemUtils, MAYBE_CreateAndDeleteFileInTempDir)
     EXPECT_TRUE(DeleteSystemFile(path.value().c_str()));
 }
 
+// Test mapping a file into memory for reading
+TEST(SystemUtils, MAYBE_MemoryMappedFile)
+{
+    Optional<std::string> path = CreateTemporaryFile();
+    ASSERT_TRUE(path.valid());
+
+    // Empty files cannot be mapped.
+    MemoryMappedFile mappedFile;
+    EXPECT_FALSE(mappedFile.open(path.value().c_str()));
+    EXPECT_EQ(mappedFile.data(), nullptr);
+
+    const std::string testContents = "test output";
+
+    std::ofstream out;
+    out.open(path.value(), std::ios::binary);
+    ASSERT_TRUE(out.is_open());
+    out << testContents;
+    out.close();
+
+    ASSERT_TRUE(mappedFile.open(path.value().c_str()));
+    ASSERT_EQ(mappedFile.size(), testContents.size());
+    EXPECT_EQ(std::string(reinterpret_cast<const char *>(mappedFile.data()), mappedFile.size()),
+              testContents);
+
+    // The file must be unmapped before it can be deleted on some platforms.
+    mappedFile.close();
+    EXPECT_EQ(mappedFile.data(), nullptr);
+    EXPECT_TRUE(DeleteSystemFile(path.value().c_str()));
+}
+
+// Test that renaming a file replaces the destination if it exists
+TEST(SystemUtils, MAYBE_RenameFile)
+{
+    Optional<std::string> source = CreateTemporaryFile();
+    Optional<std::string> dest   = CreateTemporaryFile();
+    ASSERT_TRUE(source.valid());
+    ASSERT_TRUE(dest.valid());
+
+    std::ofstream out;
+    out.open(source.value());
+    ASSERT_TRUE(out.is_open());
+    out << "new contents";
+    out.close();
+
+    out.open(dest.value());
+    ASSERT_TRUE(out.is_open());
+    out << "old contents";
+    out.close();
+
+    ASSERT_TRUE(RenameFile(source.value().c_str(), dest.value().c_str()));
+
+    std::ifstream in;
+    in.open(source.value());
+    EXPECT_FALSE(in.is_open());
+
+    in.open(dest.value());
+    ASSERT_TRUE(in.is_open());
+    std::ostringstream sstr;
+    sstr << in.rdbuf();
+    EXPECT_EQ(sstr.str(), "new contents");
+    in.close();
+
+    EXPECT_TRUE(DeleteSystemFile(dest.value().c_str()));
+}
+
+// Test that a file lock is only held by one ScopedFileLock at a time
+TEST(SystemUtils, MAYBE_ScopedFileLock)
+{
+    Optional<std::string> path = CreateTemporaryFile();
+    ASSERT_TRUE(path.valid());
+
+    std::atomic<bool> otherThreadLocked(false);
+    std::thread otherThread;
+    {
+        ScopedFileLock lock(path.value().c_str());
+        ASSERT_TRUE(lock.isLocked());
+
+        otherThread = std::thread([&]() {
+            ScopedFileLock otherLock(path.value().c_str());
+            EXPECT_TRUE(otherLock.isLocked());
+            otherThreadLocked = true;
+        });
+
+        angle::Sleep(100);
+        EXPECT_FALSE(otherThreadLocked);
+    }
+
+    otherThread.join();
+    EXPECT_TRUE(otherThreadLocked);
+    EXPECT_TRUE(DeleteSystemFile(path.value().c_str()));
+}
+
 // Test retrieving page size
 TEST(SystemUtils, PageSize)
 {
@@ -232,6 +232,13 @@ Optional<std::string> CreateTemporaryFileInDirectory(const std::string &director
     return std::string(fileName);
 }
 
+bool RenameFile(const char *oldPath, const char *newPath)
+{
+    // Unlike rename(), MoveFileEx can replace an existing file.
+    return MoveFileExW(Widen(oldPath).c_str(), Widen(newPath).c_str(),
+                       MOVEFILE_REPLACE_EXISTING) != 0;
+}
+
 std::string GetLibraryPath(void *libraryHandle)
 {
     if (!libraryHandle)
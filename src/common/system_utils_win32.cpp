@@ -222,6 +222,74 @@ size_t GetPageSize()
     return static_cast<size_t>(info.dwPageSize);
 }
 
+const uint8_t *MapFileForReading(const char *path, size_t *sizeOut)
+{
+    HANDLE file = CreateFileW(Widen(path).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return nullptr;
+    }
+
+    LARGE_INTEGER fileSize;
+    void *data = nullptr;
+    if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0)
+    {
+        HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping != nullptr)
+        {
+            data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            // The view keeps the mapping alive.
+            CloseHandle(mapping);
+        }
+    }
+    CloseHandle(file);
+
+    if (data == nullptr)
+    {
+        return nullptr;
+    }
+
+    *sizeOut = static_cast<size_t>(fileSize.QuadPart);
+    return static_cast<const uint8_t *>(data);
+}
+
+void UnmapFile(const uint8_t *data, size_t size)
+{
+    UnmapViewOfFile(data);
+}
+
+ScopedFileLock::ScopedFileLock(const char *path)
+{
+    HANDLE file = CreateFileW(Widen(path).c_str(), GENERIC_READ | GENERIC_WRITE,
+                              FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+                              OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return;
+    }
+
+    OVERLAPPED overlapped = {};
+    if (!LockFileEx(file, LOCKFILE_EXCLUSIVE_LOCK, 0, MAXDWORD, MAXDWORD, &overlapped))
+    {
+        CloseHandle(file);
+        return;
+    }
+
+    mHandle = reinterpret_cast<intptr_t>(file);
+}
+
+ScopedFileLock::~ScopedFileLock()
+{
+    if (isLocked())
+    {
+        HANDLE file           = reinterpret_cast<HANDLE>(mHandle);
+        OVERLAPPED overlapped = {};
+        UnlockFileEx(file, 0, MAXDWORD, MAXDWORD, &overlapped);
+        CloseHandle(file);
+    }
+}
+
 PageFaultHandler *CreatePageFaultHandler(PageFaultCallback callback)
 {
     gWin32PageFaultHandler = new Win32PageFaultHandler(callback);
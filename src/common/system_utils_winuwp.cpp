@@ -104,6 +104,24 @@ size_t GetPageSize()
     return 4096;
 }
 
+const uint8_t *MapFileForReading(const char *path, size_t *sizeOut)
+{
+    UNIMPLEMENTED();
+    return nullptr;
+}
+
+void UnmapFile(const uint8_t *data, size_t size)
+{
+    UNIMPLEMENTED();
+}
+
+ScopedFileLock::ScopedFileLock(const char *path)
+{
+    UNIMPLEMENTED();
+}
+
+ScopedFileLock::~ScopedFileLock() {}
+
 PageFaultHandler *CreatePageFaultHandler(PageFaultCallback callback)
 {
     return new UwpPageFaultHandler(callback);
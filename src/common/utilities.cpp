@@ -12,8 +12,34 @@
 #include "common/platform.h"
 #include "common/string_utils.h"
 
+#include <algorithm>
+#include <limits>
 #include <set>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    include <emmintrin.h>
+#    define ANGLE_INDEX_RANGE_USE_SSE2
+// AVX2 is not part of the baseline, so its kernels are compiled for it with the target attribute
+// (MSVC allows any intrinsics without it) and selected at runtime.
+#    if defined(_MSC_VER) || defined(__clang__) || defined(__GNUC__)
+#        include <immintrin.h>
+#        if defined(_MSC_VER)
+#            include <intrin.h>
+#        else
+#            include <cpuid.h>
+#        endif
+#        if defined(__clang__) || defined(__GNUC__)
+#            define ANGLE_INDEX_RANGE_AVX2_FUNCTION __attribute__((target("avx2")))
+#        else
+#            define ANGLE_INDEX_RANGE_AVX2_FUNCTION
+#        endif
+#        define ANGLE_INDEX_RANGE_USE_AVX2
+#    endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#    include <arm_neon.h>
+#    define ANGLE_INDEX_RANGE_USE_NEON
+#endif
+
 #if defined(ANGLE_ENABLE_WINDOWS_UWP)
 #    include <windows.applicationmodel.core.h>
 #    include <windows.graphics.display.h>
@@ -23,74 +49,481 @@
 
 namespace
 {
+// SSE2 is part of the baseline on x64 and NEON on arm64, so neither needs a runtime check.  AVX2 is
+// used on top of SSE2 when the CPU and OS support it.
+#if defined(ANGLE_INDEX_RANGE_USE_SSE2)
+// SSE2 only has unsigned min/max for bytes.  16- and 32-bit indices are biased by the sign bit so
+// that signed comparisons order them like unsigned ones.
+template <typename T>
+struct IndexRangeSSE2Traits;
 
-template <class IndexType>
-gl::IndexRange ComputeTypedIndexRange(const IndexType *indices,
-                                      size_t count,
-                                      bool primitiveRestartEnabled,
-                                      GLuint primitiveRestartIndex)
+template <>
+struct IndexRangeSSE2Traits<GLubyte>
 {
-    ASSERT(count > 0);
+    static constexpr size_t kLanes = 16;
+    static __m128i Load(const GLubyte *indices)
+    {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i *>(indices));
+    }
+    static __m128i Splat(GLubyte value) { return _mm_set1_epi8(static_cast<char>(value)); }
+    static __m128i Min(__m128i a, __m128i b) { return _mm_min_epu8(a, b); }
+    static __m128i Max(__m128i a, __m128i b) { return _mm_max_epu8(a, b); }
+    static __m128i CmpEq(__m128i a, __m128i b) { return _mm_cmpeq_epi8(a, b); }
+    static GLubyte Unbias(GLubyte value) { return value; }
+};
+
+template <>
+struct IndexRangeSSE2Traits<GLushort>
+{
+    static constexpr size_t kLanes = 8;
+    static __m128i Load(const GLushort *indices)
+    {
+        return _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(indices)),
+                             _mm_set1_epi16(static_cast<short>(0x8000)));
+    }
+    static __m128i Splat(GLushort value)
+    {
+        return _mm_set1_epi16(static_cast<short>(value ^ 0x8000));
+    }
+    static __m128i Min(__m128i a, __m128i b) { return _mm_min_epi16(a, b); }
+    static __m128i Max(__m128i a, __m128i b) { return _mm_max_epi16(a, b); }
+    static __m128i CmpEq(__m128i a, __m128i b) { return _mm_cmpeq_epi16(a, b); }
+    static GLushort Unbias(GLushort value) { return value ^ 0x8000; }
+};
+
+template <>
+struct IndexRangeSSE2Traits<GLuint>
+{
+    static constexpr size_t kLanes = 4;
+    static __m128i Load(const GLuint *indices)
+    {
+        return _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(indices)),
+                             _mm_set1_epi32(static_cast<int>(0x80000000u)));
+    }
+    static __m128i Splat(GLuint value)
+    {
+        return _mm_set1_epi32(static_cast<int>(value ^ 0x80000000u));
+    }
+    static __m128i Min(__m128i a, __m128i b)
+    {
+        const __m128i aGreater = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(aGreater, b), _mm_andnot_si128(aGreater, a));
+    }
+    static __m128i Max(__m128i a, __m128i b)
+    {
+        const __m128i aGreater = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(aGreater, a), _mm_andnot_si128(aGreater, b));
+    }
+    static __m128i CmpEq(__m128i a, __m128i b) { return _mm_cmpeq_epi32(a, b); }
+    static GLuint Unbias(GLuint value) { return value ^ 0x80000000u; }
+};
+
+template <class IndexType, bool kPrimitiveRestartEnabled>
+size_t AccumulateSSE2IndexRange(const IndexType *indices,
+                                size_t count,
+                                IndexType *minIndexInOut,
+                                IndexType *maxIndexInOut,
+                                size_t *primitiveRestartCountInOut)
+{
+    using Traits = IndexRangeSSE2Traits<IndexType>;
 
-    IndexType minIndex                = 0;
-    IndexType maxIndex                = 0;
-    size_t nonPrimitiveRestartIndices = 0;
+    const size_t vectorCount = count - count % Traits::kLanes;
+    if (vectorCount == 0)
+    {
+        return 0;
+    }
 
-    if (primitiveRestartEnabled)
+    // The restart index is the largest value of the type, so it never lowers the minimum.  Xoring
+    // it with its comparison mask turns it into the smallest value, so it doesn't raise the maximum
+    // either.  Restart indices are counted by summing one per byte of them into two 64-bit lanes.
+    const __m128i restartIndex = Traits::Splat(std::numeric_limits<IndexType>::max());
+    const __m128i zero         = _mm_setzero_si128();
+    const __m128i byteOne      = _mm_set1_epi8(1);
+    __m128i minIndex           = Traits::Splat(std::numeric_limits<IndexType>::max());
+    __m128i maxIndex           = Traits::Splat(0);
+    __m128i restartByteCount   = zero;
+
+    for (size_t i = 0; i < vectorCount; i += Traits::kLanes)
     {
-        // Find the first non-primitive restart index to initialize the min and max values
-        size_t i = 0;
-        for (; i < count; i++)
+        __m128i value = Traits::Load(indices + i);
+        minIndex      = Traits::Min(minIndex, value);
+        if (kPrimitiveRestartEnabled)
         {
-            if (indices[i] != primitiveRestartIndex)
-            {
-                minIndex = indices[i];
-                maxIndex = indices[i];
-                nonPrimitiveRestartIndices++;
-                break;
-            }
+            const __m128i isRestart    = Traits::CmpEq(value, restartIndex);
+            const __m128i restartBytes = _mm_and_si128(isRestart, byteOne);
+            restartByteCount = _mm_add_epi64(restartByteCount, _mm_sad_epu8(restartBytes, zero));
+            value            = _mm_xor_si128(value, isRestart);
         }
+        maxIndex = Traits::Max(maxIndex, value);
+    }
+
+    alignas(16) IndexType minLanes[Traits::kLanes];
+    alignas(16) IndexType maxLanes[Traits::kLanes];
+    _mm_store_si128(reinterpret_cast<__m128i *>(minLanes), minIndex);
+    _mm_store_si128(reinterpret_cast<__m128i *>(maxLanes), maxIndex);
+    for (size_t lane = 0; lane < Traits::kLanes; ++lane)
+    {
+        *minIndexInOut = std::min(*minIndexInOut, Traits::Unbias(minLanes[lane]));
+        *maxIndexInOut = std::max(*maxIndexInOut, Traits::Unbias(maxLanes[lane]));
+    }
+    alignas(16) uint64_t restartByteCounts[2];
+    _mm_store_si128(reinterpret_cast<__m128i *>(restartByteCounts), restartByteCount);
+    *primitiveRestartCountInOut +=
+        static_cast<size_t>(restartByteCounts[0] + restartByteCounts[1]) / sizeof(IndexType);
+
+    return vectorCount;
+}
 
-        // Loop over the rest of the indices
-        for (; i < count; i++)
+#    if defined(ANGLE_INDEX_RANGE_USE_AVX2)
+bool SupportsAVX2()
+{
+    static const bool supports = []() {
+        // AVX2 needs CPUID.7.0:EBX[5], and the OS must save the YMM registers, which is checked
+        // through OSXSAVE (CPUID.1:ECX[27]) and XCR0.
+#        if defined(_MSC_VER)
+        int info[4];
+        __cpuid(info, 0);
+        if (info[0] < 7)
         {
-            if (indices[i] != primitiveRestartIndex)
-            {
-                if (minIndex > indices[i])
-                {
-                    minIndex = indices[i];
-                }
-                if (maxIndex < indices[i])
-                {
-                    maxIndex = indices[i];
-                }
-                nonPrimitiveRestartIndices++;
-            }
+            return false;
+        }
+        __cpuid(info, 1);
+        const bool osxsave = ((info[2] >> 27) & 1) != 0;
+        __cpuidex(info, 7, 0);
+        const bool avx2 = ((info[1] >> 5) & 1) != 0;
+        if (!osxsave || !avx2)
+        {
+            return false;
+        }
+        const uint64_t xcr0 = _xgetbv(0);
+#        else
+        unsigned int eax, ebx, ecx, edx;
+        if (__get_cpuid_max(0, nullptr) < 7)
+        {
+            return false;
+        }
+        __cpuid(1, eax, ebx, ecx, edx);
+        const bool osxsave = ((ecx >> 27) & 1) != 0;
+        __cpuid_count(7, 0, eax, ebx, ecx, edx);
+        const bool avx2 = ((ebx >> 5) & 1) != 0;
+        if (!osxsave || !avx2)
+        {
+            return false;
         }
+        // xgetbv is encoded directly, as its intrinsic needs the xsave target.
+        unsigned int xcr0Low, xcr0High;
+        __asm__(".byte 0x0f, 0x01, 0xd0" : "=a"(xcr0Low), "=d"(xcr0High) : "c"(0));
+        const uint64_t xcr0 = (static_cast<uint64_t>(xcr0High) << 32) | xcr0Low;
+#        endif
+        // The XMM and YMM state.
+        return (xcr0 & 0x6) == 0x6;
+    }();
+    return supports;
+}
+
+// AVX2 has unsigned min/max for all lane sizes, so unlike with SSE2 nothing needs to be biased.
+template <typename T>
+struct IndexRangeAVX2Traits;
+
+template <>
+struct IndexRangeAVX2Traits<GLubyte>
+{
+    static constexpr size_t kLanes = 32;
+    ANGLE_INDEX_RANGE_AVX2_FUNCTION static __m256i Splat(GLubyte value)
+    {
+        return _mm256_set1_epi8(static_cast<char>(value));
+    }
+    ANGLE_INDEX_RANGE_AVX2_FUNCTION static __m256i Min(__m256i a, __m256i b)
+    {
+        return _mm256_min_epu8(a, b);
+    }
+    ANGLE_INDEX_RANGE_AVX2_FUNCTION static __m256i Max(__m256i a, __m256i b)
+    {
+        return _mm256_max_epu8(a, b);
     }
-    else
+    ANGLE_INDEX_RANGE_AVX2_FUNCTION static __m256i CmpEq(__m256i a, __m256i b)
     {
-        minIndex                   = indices[0];
-        maxIndex                   = indices[0];
-        nonPrimitiveRestartIndices = count;
+        return _mm256_cmpeq_epi8(a, b);
+    }
+};
 
-        for (size_t i = 1; i < count; i++)
+template <>
+struct IndexRangeAVX2Traits<GLushort>
+{
+    static constexpr size_t kLanes = 16;
+    ANGLE_INDEX_RANGE_AVX2_FUNCTION static __m256i Splat(GLushort value)
+    {
+        return _mm256_set1_epi16(static_cast<short>(value));
+    }
+    ANGLE_INDEX_RANGE_AVX2_FUNCTION static __m256i Min(__m256i a, __m256i b)
+    {
+        return _mm256_min_epu16(a, b);
+    }
+    ANGLE_INDEX_RANGE_AVX2_FUNCTION static __m256i Max(__m256i a, __m256i b)
+    {
+        return _mm256_max_epu16(a, b);
+    }
+    ANGLE_INDEX_RANGE_AVX2_FUNCTION static __m256i CmpEq(__m256i a, __m256i b)
+    {
+        return _mm256_cmpeq_epi16(a, b);
+    }
+};
+
+template <>
+struct IndexRangeAVX2Traits<GLuint>
+{
+    static constexpr size_t kLanes = 8;
+    ANGLE_INDEX_RANGE_AVX2_FUNCTION static __m256i Splat(GLuint value)
+    {
+        return _mm256_set1_epi32(static_cast<int>(value));
+    }
+    ANGLE_INDEX_RANGE_AVX2_FUNCTION static __m256i Min(__m256i a, __m256i b)
+    {
+        return _mm256_min_epu32(a, b);
+    }
+    ANGLE_INDEX_RANGE_AVX2_FUNCTION static __m256i Max(__m256i a, __m256i b)
+    {
+        return _mm256_max_epu32(a, b);
+    }
+    ANGLE_INDEX_RANGE_AVX2_FUNCTION static __m256i CmpEq(__m256i a, __m256i b)
+    {
+        return _mm256_cmpeq_epi32(a, b);
+    }
+};
+
+// Same as AccumulateSSE2IndexRange, over twice as many lanes.
+template <class IndexType, bool kPrimitiveRestartEnabled>
+ANGLE_INDEX_RANGE_AVX2_FUNCTION size_t AccumulateAVX2IndexRange(const IndexType *indices,
+                                                                size_t count,
+                                                                IndexType *minIndexInOut,
+                                                                IndexType *maxIndexInOut,
+                                                                size_t *primitiveRestartCountInOut)
+{
+    using Traits = IndexRangeAVX2Traits<IndexType>;
+
+    const size_t vectorCount = count - count % Traits::kLanes;
+    if (vectorCount == 0)
+    {
+        return 0;
+    }
+
+    const __m256i restartIndex = Traits::Splat(std::numeric_limits<IndexType>::max());
+    const __m256i zero         = _mm256_setzero_si256();
+    const __m256i byteOne      = _mm256_set1_epi8(1);
+    __m256i minIndex           = Traits::Splat(std::numeric_limits<IndexType>::max());
+    __m256i maxIndex           = Traits::Splat(0);
+    __m256i restartByteCount   = zero;
+
+    for (size_t i = 0; i < vectorCount; i += Traits::kLanes)
+    {
+        __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(indices + i));
+        minIndex      = Traits::Min(minIndex, value);
+        if (kPrimitiveRestartEnabled)
         {
-            if (minIndex > indices[i])
-            {
-                minIndex = indices[i];
-            }
-            if (maxIndex < indices[i])
-            {
-                maxIndex = indices[i];
-            }
+            const __m256i isRestart    = Traits::CmpEq(value, restartIndex);
+            const __m256i restartBytes = _mm256_and_si256(isRestart, byteOne);
+            restartByteCount =
+                _mm256_add_epi64(restartByteCount, _mm256_sad_epu8(restartBytes, zero));
+            value = _mm256_xor_si256(value, isRestart);
         }
+        maxIndex = Traits::Max(maxIndex, value);
+    }
+
+    alignas(32) IndexType minLanes[Traits::kLanes];
+    alignas(32) IndexType maxLanes[Traits::kLanes];
+    _mm256_store_si256(reinterpret_cast<__m256i *>(minLanes), minIndex);
+    _mm256_store_si256(reinterpret_cast<__m256i *>(maxLanes), maxIndex);
+    for (size_t lane = 0; lane < Traits::kLanes; ++lane)
+    {
+        *minIndexInOut = std::min(*minIndexInOut, minLanes[lane]);
+        *maxIndexInOut = std::max(*maxIndexInOut, maxLanes[lane]);
+    }
+    alignas(32) uint64_t restartByteCounts[4];
+    _mm256_store_si256(reinterpret_cast<__m256i *>(restartByteCounts), restartByteCount);
+    const uint64_t restartByteTotal =
+        restartByteCounts[0] + restartByteCounts[1] + restartByteCounts[2] + restartByteCounts[3];
+    *primitiveRestartCountInOut += static_cast<size_t>(restartByteTotal) / sizeof(IndexType);
+
+    return vectorCount;
+}
+#    endif  // defined(ANGLE_INDEX_RANGE_USE_AVX2)
+
+template <class IndexType, bool kPrimitiveRestartEnabled>
+size_t AccumulateVectorIndexRange(const IndexType *indices,
+                                  size_t count,
+                                  IndexType *minIndexInOut,
+                                  IndexType *maxIndexInOut,
+                                  size_t *primitiveRestartCountInOut)
+{
+    size_t processed = 0;
+#    if defined(ANGLE_INDEX_RANGE_USE_AVX2)
+    if (SupportsAVX2())
+    {
+        processed = AccumulateAVX2IndexRange<IndexType, kPrimitiveRestartEnabled>(
+            indices, count, minIndexInOut, maxIndexInOut, primitiveRestartCountInOut);
+    }
+#    endif
+
+    // SSE2 handles all indices without AVX2, or those that don't fill an AVX2 vector.
+    processed += AccumulateSSE2IndexRange<IndexType, kPrimitiveRestartEnabled>(
+        indices + processed, count - processed, minIndexInOut, maxIndexInOut,
+        primitiveRestartCountInOut);
+    return processed;
+}
+#elif defined(ANGLE_INDEX_RANGE_USE_NEON)
+template <typename T>
+struct IndexRangeNEONTraits;
+
+template <>
+struct IndexRangeNEONTraits<GLubyte>
+{
+    using Vector                   = uint8x16_t;
+    static constexpr size_t kLanes = 16;
+    static Vector Load(const GLubyte *indices) { return vld1q_u8(indices); }
+    static Vector Splat(GLubyte value) { return vdupq_n_u8(value); }
+    static Vector Min(Vector a, Vector b) { return vminq_u8(a, b); }
+    static Vector Max(Vector a, Vector b) { return vmaxq_u8(a, b); }
+    static Vector CmpEq(Vector a, Vector b) { return vceqq_u8(a, b); }
+    static Vector Xor(Vector a, Vector b) { return veorq_u8(a, b); }
+    static size_t CountSet(Vector mask) { return vaddvq_u8(vshrq_n_u8(mask, 7)); }
+    static GLubyte ReduceMin(Vector v) { return vminvq_u8(v); }
+    static GLubyte ReduceMax(Vector v) { return vmaxvq_u8(v); }
+};
+
+template <>
+struct IndexRangeNEONTraits<GLushort>
+{
+    using Vector                   = uint16x8_t;
+    static constexpr size_t kLanes = 8;
+    static Vector Load(const GLushort *indices) { return vld1q_u16(indices); }
+    static Vector Splat(GLushort value) { return vdupq_n_u16(value); }
+    static Vector Min(Vector a, Vector b) { return vminq_u16(a, b); }
+    static Vector Max(Vector a, Vector b) { return vmaxq_u16(a, b); }
+    static Vector CmpEq(Vector a, Vector b) { return vceqq_u16(a, b); }
+    static Vector Xor(Vector a, Vector b) { return veorq_u16(a, b); }
+    static size_t CountSet(Vector mask) { return vaddvq_u16(vshrq_n_u16(mask, 15)); }
+    static GLushort ReduceMin(Vector v) { return vminvq_u16(v); }
+    static GLushort ReduceMax(Vector v) { return vmaxvq_u16(v); }
+};
+
+template <>
+struct IndexRangeNEONTraits<GLuint>
+{
+    using Vector                   = uint32x4_t;
+    static constexpr size_t kLanes = 4;
+    static Vector Load(const GLuint *indices) { return vld1q_u32(indices); }
+    static Vector Splat(GLuint value) { return vdupq_n_u32(value); }
+    static Vector Min(Vector a, Vector b) { return vminq_u32(a, b); }
+    static Vector Max(Vector a, Vector b) { return vmaxq_u32(a, b); }
+    static Vector CmpEq(Vector a, Vector b) { return vceqq_u32(a, b); }
+    static Vector Xor(Vector a, Vector b) { return veorq_u32(a, b); }
+    static size_t CountSet(Vector mask) { return vaddvq_u32(vshrq_n_u32(mask, 31)); }
+    static GLuint ReduceMin(Vector v) { return vminvq_u32(v); }
+    static GLuint ReduceMax(Vector v) { return vmaxvq_u32(v); }
+};
+
+template <class IndexType, bool kPrimitiveRestartEnabled>
+size_t AccumulateVectorIndexRange(const IndexType *indices,
+                                  size_t count,
+                                  IndexType *minIndexInOut,
+                                  IndexType *maxIndexInOut,
+                                  size_t *primitiveRestartCountInOut)
+{
+    using Traits = IndexRangeNEONTraits<IndexType>;
+    using Vector = typename Traits::Vector;
+
+    const size_t vectorCount = count - count % Traits::kLanes;
+    if (vectorCount == 0)
+    {
+        return 0;
+    }
+
+    // The restart index is the largest value of the type, so it never lowers the minimum.  Xoring
+    // it with its comparison mask turns it into zero, so it doesn't raise the maximum either.
+    const Vector restartIndex = Traits::Splat(std::numeric_limits<IndexType>::max());
+    Vector minIndex           = Traits::Splat(std::numeric_limits<IndexType>::max());
+    Vector maxIndex           = Traits::Splat(0);
+    size_t restartCount       = 0;
+
+    for (size_t i = 0; i < vectorCount; i += Traits::kLanes)
+    {
+        Vector value = Traits::Load(indices + i);
+        minIndex     = Traits::Min(minIndex, value);
+        if (kPrimitiveRestartEnabled)
+        {
+            const Vector isRestart = Traits::CmpEq(value, restartIndex);
+            restartCount += Traits::CountSet(isRestart);
+            value = Traits::Xor(value, isRestart);
+        }
+        maxIndex = Traits::Max(maxIndex, value);
+    }
+
+    *minIndexInOut = std::min(*minIndexInOut, Traits::ReduceMin(minIndex));
+    *maxIndexInOut = std::max(*maxIndexInOut, Traits::ReduceMax(maxIndex));
+    *primitiveRestartCountInOut += restartCount;
+
+    return vectorCount;
+}
+#else
+template <class IndexType, bool kPrimitiveRestartEnabled>
+size_t AccumulateVectorIndexRange(const IndexType *indices,
+                                  size_t count,
+                                  IndexType *minIndexInOut,
+                                  IndexType *maxIndexInOut,
+                                  size_t *primitiveRestartCountInOut)
+{
+    return 0;
+}
+#endif
+
+template <class IndexType, bool kPrimitiveRestartEnabled>
+gl::IndexRange ComputeTypedIndexRange(const IndexType *indices, size_t count)
+{
+    ASSERT(count > 0);
+
+    IndexType minIndex           = std::numeric_limits<IndexType>::max();
+    IndexType maxIndex           = 0;
+    size_t primitiveRestartCount = 0;
+
+    // Most of the indices are processed in vectors, and the rest one by one.
+    size_t i = AccumulateVectorIndexRange<IndexType, kPrimitiveRestartEnabled>(
+        indices, count, &minIndex, &maxIndex, &primitiveRestartCount);
+
+    for (; i < count; i++)
+    {
+        // The primitive restart index is always the largest value of the type.
+        if (kPrimitiveRestartEnabled && indices[i] == std::numeric_limits<IndexType>::max())
+        {
+            primitiveRestartCount++;
+            continue;
+        }
+
+        minIndex = std::min(minIndex, indices[i]);
+        maxIndex = std::max(maxIndex, indices[i]);
+    }
+
+    const size_t nonPrimitiveRestartIndices = count - primitiveRestartCount;
+    if (nonPrimitiveRestartIndices == 0)
+    {
+        return gl::IndexRange(0, 0, 0);
     }
 
     return gl::IndexRange(static_cast<size_t>(minIndex), static_cast<size_t>(maxIndex),
                           nonPrimitiveRestartIndices);
 }
 
+template <class IndexType>
+gl::IndexRange ComputeTypedIndexRange(const IndexType *indices,
+                                      size_t count,
+                                      bool primitiveRestartEnabled,
+                                      GLuint primitiveRestartIndex)
+{
+    ASSERT(primitiveRestartIndex == std::numeric_limits<IndexType>::max());
+
+    return primitiveRestartEnabled ? ComputeTypedIndexRange<IndexType, true>(indices, count)
+                                   : ComputeTypedIndexRange<IndexType, false>(indices, count);
+}
+
 }  // anonymous namespace
 
 namespace gl
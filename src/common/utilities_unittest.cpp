@@ -205,4 +205,58 @@ TEST(Utilities, ConstStrLen)
     EXPECT_EQ(3u, n2);
 }
 
+template <typename IndexType>
+void TestComputeIndexRange(gl::DrawElementsType type)
+{
+    const IndexType restartIndex = static_cast<IndexType>(gl::GetPrimitiveRestartIndex(type));
+
+    // Use enough indices to cover the AVX2 and SSE2 vectors and the remainder.
+    std::vector<IndexType> indices;
+    for (size_t index = 0; index < 77; ++index)
+    {
+        indices.push_back(static_cast<IndexType>(10 + (index * 37) % 100));
+    }
+
+    gl::IndexRange range = gl::ComputeIndexRange(type, indices.data(), indices.size(), false);
+    EXPECT_EQ(10u, range.start);
+    EXPECT_EQ(109u, range.end);
+    EXPECT_EQ(indices.size(), range.vertexIndexCount);
+
+    // Restart indices are excluded from the range only when primitive restart is enabled.
+    indices[3]  = restartIndex;
+    indices[40] = restartIndex;
+    indices[76] = restartIndex;
+
+    range = gl::ComputeIndexRange(type, indices.data(), indices.size(), false);
+    EXPECT_EQ(static_cast<size_t>(restartIndex), range.end);
+    EXPECT_EQ(indices.size(), range.vertexIndexCount);
+
+    range = gl::ComputeIndexRange(type, indices.data(), indices.size(), true);
+    EXPECT_EQ(10u, range.start);
+    EXPECT_EQ(109u, range.end);
+    EXPECT_EQ(indices.size() - 3, range.vertexIndexCount);
+
+    // Only restart indices.
+    std::fill(indices.begin(), indices.end(), restartIndex);
+    range = gl::ComputeIndexRange(type, indices.data(), indices.size(), true);
+    EXPECT_EQ(0u, range.start);
+    EXPECT_EQ(0u, range.end);
+    EXPECT_EQ(0u, range.vertexIndexCount);
+
+    // The largest index below the restart index.
+    indices[50] = static_cast<IndexType>(restartIndex - 1);
+    range       = gl::ComputeIndexRange(type, indices.data(), indices.size(), true);
+    EXPECT_EQ(static_cast<size_t>(restartIndex - 1), range.start);
+    EXPECT_EQ(static_cast<size_t>(restartIndex - 1), range.end);
+    EXPECT_EQ(1u, range.vertexIndexCount);
+}
+
+// Test ComputeIndexRange with and without primitive restart.
+TEST(Utilities, ComputeIndexRange)
+{
+    TestComputeIndexRange<GLubyte>(gl::DrawElementsType::UnsignedByte);
+    TestComputeIndexRange<GLushort>(gl::DrawElementsType::UnsignedShort);
+    TestComputeIndexRange<GLuint>(gl::DrawElementsType::UnsignedInt);
+}
+
 }  // anonymous namespace
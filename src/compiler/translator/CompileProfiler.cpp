@@ -0,0 +1,101 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// CompileProfiler.cpp: Records the time and pool memory taken by each stage and pass of a
+// compilation.
+
+#include "compiler/translator/CompileProfiler.h"
+
+#include "common/system_utils.h"
+#include "compiler/translator/PoolAlloc.h"
+
+namespace sh
+{
+namespace
+{
+size_t GetPoolAllocatedBytes()
+{
+    return GetGlobalPoolAllocator()->getStats().allocatedBytes;
+}
+}  // anonymous namespace
+
+TCompileProfiler::TCompileProfiler() : mEnabled(false), mPassStartTime(0), mPassStartPoolBytes(0) {}
+
+TCompileProfiler::~TCompileProfiler() = default;
+
+void TCompileProfiler::reset(bool enabled)
+{
+    ASSERT(mOpenStages.empty());
+    mEnabled = enabled;
+    mStages.clear();
+
+    if (mEnabled)
+    {
+        mPassStartTime      = angle::GetCurrentSystemTime();
+        mPassStartPoolBytes = GetPoolAllocatedBytes();
+    }
+}
+
+void TCompileProfiler::beginStage(const char *name)
+{
+    if (!mEnabled)
+    {
+        return;
+    }
+
+    // The record is added now so it precedes those of the passes of the stage.
+    CompileStageProfile stage;
+    stage.name  = name;
+    stage.depth = static_cast<int>(mOpenStages.size());
+    mOpenStages.push_back(mStages.size());
+    mStages.push_back(stage);
+
+    mPassStartTime      = angle::GetCurrentSystemTime();
+    mPassStartPoolBytes = GetPoolAllocatedBytes();
+
+    mStages.back().startTime = mPassStartTime;
+    mOpenStagesPoolBytes.push_back(mPassStartPoolBytes);
+}
+
+void TCompileProfiler::endStage()
+{
+    if (!mEnabled)
+    {
+        return;
+    }
+
+    ASSERT(!mOpenStages.empty());
+    CompileStageProfile *stage = &mStages[mOpenStages.back()];
+    finishRecord(stage, stage->startTime, mOpenStagesPoolBytes.back());
+    mOpenStages.pop_back();
+    mOpenStagesPoolBytes.pop_back();
+
+    // The next pass of the enclosing stage starts here.
+    mPassStartTime      = stage->startTime + stage->duration;
+    mPassStartPoolBytes = GetPoolAllocatedBytes();
+}
+
+void TCompileProfiler::recordPass(const char *name)
+{
+    CompileStageProfile pass;
+    pass.name  = name;
+    pass.depth = static_cast<int>(mOpenStages.size());
+    finishRecord(&pass, mPassStartTime, mPassStartPoolBytes);
+    mStages.push_back(pass);
+
+    mPassStartTime      = pass.startTime + pass.duration;
+    mPassStartPoolBytes = GetPoolAllocatedBytes();
+}
+
+void TCompileProfiler::finishRecord(CompileStageProfile *record,
+                                    double startTime,
+                                    size_t startPoolBytes)
+{
+    record->startTime = startTime;
+    record->duration  = angle::GetCurrentSystemTime() - startTime;
+    record->poolBytes = GetPoolAllocatedBytes() - startPoolBytes;
+}
+}  // namespace sh
@@ -0,0 +1,79 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// CompileProfiler.h: Records the time and pool memory taken by each stage and pass of a
+// compilation, when the profileCompilation option is set.
+
+#ifndef COMPILER_TRANSLATOR_COMPILEPROFILER_H_
+#define COMPILER_TRANSLATOR_COMPILEPROFILER_H_
+
+#include <vector>
+
+#include "GLSLANG/ShaderLang.h"
+#include "common/angleutils.h"
+
+namespace sh
+{
+// Stages nest, and contain passes.  A pass is recorded when it ends, and is considered to have
+// started when the previous pass ended, or when the profile was reset or the last stage began or
+// ended.  This keeps the instrumentation of the passes to a single call after each of them.
+//
+// Stages are recorded in the order they began, so every stage precedes its passes and nested
+// stages.
+class TCompileProfiler : angle::NonCopyable
+{
+  public:
+    TCompileProfiler();
+    ~TCompileProfiler();
+
+    // Clears the previous profile, and starts the first pass.  Nothing is recorded unless
+    // |enabled|.
+    void reset(bool enabled);
+
+    void beginStage(const char *name);
+    void endStage();
+
+    void endPass(const char *name)
+    {
+        if (mEnabled)
+        {
+            recordPass(name);
+        }
+    }
+
+    const std::vector<CompileStageProfile> &getStages() const { return mStages; }
+
+  private:
+    void recordPass(const char *name);
+    void finishRecord(CompileStageProfile *record, double startTime, size_t startPoolBytes);
+
+    bool mEnabled;
+    std::vector<CompileStageProfile> mStages;
+
+    // The stages that have begun and not ended, as indices in |mStages|.
+    std::vector<size_t> mOpenStages;
+    std::vector<size_t> mOpenStagesPoolBytes;
+
+    // Where the next pass starts.
+    double mPassStartTime;
+    size_t mPassStartPoolBytes;
+};
+
+class [[nodiscard]] TScopedCompileStage : angle::NonCopyable
+{
+  public:
+    TScopedCompileStage(TCompileProfiler *profiler, const char *name) : mProfiler(profiler)
+    {
+        mProfiler->beginStage(name);
+    }
+    ~TScopedCompileStage() { mProfiler->endStage(); }
+
+  private:
+    TCompileProfiler *mProfiler;
+};
+}  // namespace sh
+
+#endif  // COMPILER_TRANSLATOR_COMPILEPROFILER_H_
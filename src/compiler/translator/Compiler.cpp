@@ -239,19 +239,24 @@ namespace
 class [[nodiscard]] TScopedPoolAllocator
 {
   public:
-    TScopedPoolAllocator(angle::PoolAllocator *allocator) : mAllocator(allocator)
+    TScopedPoolAllocator(angle::PoolAllocator *allocator, angle::PoolAllocator::Stats *statsOut)
+        : mAllocator(allocator), mStatsOut(statsOut)
     {
         mAllocator->push();
+        mAllocator->resetStats();
         SetGlobalPoolAllocator(mAllocator);
     }
     ~TScopedPoolAllocator()
     {
         SetGlobalPoolAllocator(nullptr);
-        mAllocator->pop(angle::PoolAllocator::ReleaseStrategy::All);
+        *mStatsOut = mAllocator->getStats();
+        // The pages are kept by the thread for the next compilation on it to reuse.
+        mAllocator->pop(angle::PoolAllocator::ReleaseStrategy::AllToThreadCache);
     }
 
   private:
     angle::PoolAllocator *mAllocator;
+    angle::PoolAllocator::Stats *mStatsOut;
 };
 
 class [[nodiscard]] TScopedSymbolTableLevel
@@ -429,6 +434,7 @@ TIntermBlock *TCompiler::compileTreeForTesting(const char *const shaderStrings[]
                                                size_t numStrings,
                                                const ShCompileOptions &compileOptions)
 {
+    mProfiler.reset(compileOptions.profileCompilation);
     return compileTreeImpl(shaderStrings, numStrings, compileOptions);
 }
 
@@ -495,11 +501,13 @@ TIntermBlock *TCompiler::compileTreeImpl(const char *const shaderStrings[],
     {
         return nullptr;
     }
+    mProfiler.endPass("Parse");
 
     if (!postParseChecks(parseContext))
     {
         return nullptr;
     }
+    mProfiler.endPass("postParseChecks");
 
     setASTMetadata(parseContext);
 
@@ -509,6 +517,7 @@ TIntermBlock *TCompiler::compileTreeImpl(const char *const shaderStrings[],
     }
 
     TIntermBlock *root = parseContext.getTreeRoot();
+    TScopedCompileStage transformStage(&mProfiler, "Transform");
     if (!checkAndSimplifyAST(root, parseContext, compileOptions))
     {
         return nullptr;
@@ -604,6 +613,8 @@ void TCompiler::setASTMetadata(const TParseContext &parseContext)
 
     mUsesDerivatives = parseContext.usesDerivatives();
 
+    mASTNodeKinds = parseContext.getASTNodeKinds();
+
     if (mShaderType == GL_FRAGMENT_SHADER)
     {
         mAdvancedBlendEquations       = parseContext.getAdvancedBlendEquations();
@@ -722,6 +733,13 @@ bool TCompiler::validateAST(TIntermNode *root)
     return true;
 }
 
+bool TCompiler::mayContainASTNodes(TIntermNode *root, ASTNodeKindSet kinds) const
+{
+    // Verify that no transformation introduced nodes without recording their kind.
+    ASSERT(!mCompileOptions.validateAST || (FindASTNodeKinds(root) & ~mASTNodeKinds).none());
+    return (mASTNodeKinds & kinds).any();
+}
+
 bool TCompiler::disableValidateFunctionCall()
 {
     bool wasEnabled                          = mValidateASTOptions.validateFunctionCall;
@@ -769,6 +787,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     {
         return false;
     }
+    mProfiler.endPass("limitExpressionComplexity");
 
     if (!validateAST(root))
     {
@@ -791,6 +810,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
             mDiagnostics.globalError("internal compiler error translating pixel local storage");
             return false;
         }
+        mProfiler.endPass("RewritePixelLocalStorage");
     }
 
     if (shouldRunLoopAndIndexingValidation(compileOptions) &&
@@ -798,11 +818,13 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     {
         return false;
     }
+    mProfiler.endPass("ValidateLimitations");
 
     if (!ValidateFragColorAndFragData(mShaderType, mShaderVersion, mSymbolTable, &mDiagnostics))
     {
         return false;
     }
+    mProfiler.endPass("ValidateFragColorAndFragData");
 
     // Fold expressions that could not be folded before validation that was done as a part of
     // parsing.
@@ -810,6 +832,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     {
         return false;
     }
+    mProfiler.endPass("FoldExpressions");
     // Folding should only be able to generate warnings.
     ASSERT(mDiagnostics.numErrors() == 0);
 
@@ -829,6 +852,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        mProfiler.endPass("ValidateClipCullDistance");
         mMetadataFlags[MetadataFlags::HasClipDistance] = isClipDistanceUsed;
     }
 
@@ -837,6 +861,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     {
         return false;
     }
+    mProfiler.endPass("ValidateBarrierFunctionCall");
 
     // We prune no-ops to work around driver bugs and to keep AST processing and output simple.
     // The following kinds of no-ops are pruned:
@@ -850,6 +875,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     {
         return false;
     }
+    mProfiler.endPass("PruneNoOps");
     mValidateASTOptions.validateNoStatementsAfterBranch = true;
 
     // We need to generate globals early if we have non constant initializers enabled
@@ -873,29 +899,37 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // This is because MSL doesn't allow statically initialized non-const globals.
     bool forceDeferNonConstGlobalInitializers = getOutputType() == SH_MSL_METAL_OUTPUT;
 
-    if (enableNonConstantInitializers &&
-        !DeferGlobalInitializers(this, root, initializeLocalsAndGlobals, canUseLoopsToInitialize,
-                                 highPrecisionSupported, forceDeferNonConstGlobalInitializers,
-                                 &mSymbolTable))
+    if (enableNonConstantInitializers)
     {
-        return false;
+        if (!DeferGlobalInitializers(this, root, initializeLocalsAndGlobals,
+                                     canUseLoopsToInitialize, highPrecisionSupported,
+                                     forceDeferNonConstGlobalInitializers, &mSymbolTable))
+        {
+            return false;
+        }
+        mProfiler.endPass("DeferGlobalInitializers");
+        // Deferred globals may be initialized with loops over their array elements.
+        addASTNodeKinds(ASTNodeKindSet{ASTNodeKind::Loop, ASTNodeKind::IndirectIndex});
     }
 
     if (!SeparateStructFromFunctionDeclarations(*this, *root))
     {
         return false;
     }
+    mProfiler.endPass("SeparateStructFromFunctionDeclarations");
 
     // Create the function DAG and check there is no recursion
     if (!initCallDag(root))
     {
         return false;
     }
+    mProfiler.endPass("CallDAG");
 
     if (compileOptions.limitCallStackDepth && !checkCallDepth())
     {
         return false;
     }
+    mProfiler.endPass("checkCallDepth");
 
     // Checks which functions are used and if "main" exists
     mFunctionMetadata.clear();
@@ -904,11 +938,13 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     {
         return false;
     }
+    mProfiler.endPass("tagUsedFunctions");
 
     if (!pruneUnusedFunctions(root))
     {
         return false;
     }
+    mProfiler.endPass("pruneUnusedFunctions");
 
     if (IsSpecWithFunctionBodyNewScope(mShaderSpec, mShaderVersion))
     {
@@ -916,12 +952,14 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        mProfiler.endPass("ReplaceShadowingVariables");
     }
 
     if (mShaderVersion >= 310 && !ValidateVaryingLocations(root, &mDiagnostics, mShaderType))
     {
         return false;
     }
+    mProfiler.endPass("ValidateVaryingLocations");
 
     // anglebug.com/42265954: The ESSL spec has a bug with images as function arguments. The
     // recommended workaround is to inline functions that accept image arguments.
@@ -931,6 +969,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     {
         return false;
     }
+    mProfiler.endPass("MonomorphizeUnsupportedFunctions");
 
     if (mShaderVersion >= 300 && mShaderType == GL_FRAGMENT_SHADER &&
         !ValidateOutputs(root, getExtensionBehavior(), mResources, hasPixelLocalStorageUniforms(),
@@ -938,14 +977,17 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     {
         return false;
     }
+    mProfiler.endPass("ValidateOutputs");
 
     // Clamping uniform array bounds needs to happen after validateLimitations pass.
-    if (compileOptions.clampIndirectArrayBounds)
+    if (compileOptions.clampIndirectArrayBounds &&
+        mayContainASTNodes(root, ASTNodeKindSet{ASTNodeKind::IndirectIndex}))
     {
         if (!ClampIndirectIndices(this, root, &mSymbolTable))
         {
             return false;
         }
+        mProfiler.endPass("ClampIndirectIndices");
     }
 
     if (compileOptions.initializeBuiltinsForInstancedMultiview &&
@@ -958,31 +1000,39 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        mProfiler.endPass("DeclareAndInitBuiltinsForInstancedMultiview");
     }
 
     // This pass might emit short circuits so keep it before the short circuit unfolding
-    if (compileOptions.rewriteDoWhileLoops)
+    if (compileOptions.rewriteDoWhileLoops &&
+        mayContainASTNodes(root, ASTNodeKindSet{ASTNodeKind::DoWhileLoop}))
     {
         if (!RewriteDoWhile(this, root, &mSymbolTable))
         {
             return false;
         }
+        mProfiler.endPass("RewriteDoWhile");
     }
 
-    if (compileOptions.addAndTrueToLoopCondition)
+    if (compileOptions.addAndTrueToLoopCondition &&
+        mayContainASTNodes(root, ASTNodeKindSet{ASTNodeKind::Loop}))
     {
         if (!AddAndTrueToLoopCondition(this, root))
         {
             return false;
         }
+        mProfiler.endPass("AddAndTrueToLoopCondition");
+        addASTNodeKinds(ASTNodeKindSet{ASTNodeKind::ShortCircuitOperator});
     }
 
-    if (compileOptions.unfoldShortCircuit)
+    if (compileOptions.unfoldShortCircuit &&
+        mayContainASTNodes(root, ASTNodeKindSet{ASTNodeKind::ShortCircuitOperator}))
     {
         if (!UnfoldShortCircuitAST(this, root))
         {
             return false;
         }
+        mProfiler.endPass("UnfoldShortCircuitAST");
     }
 
     if (compileOptions.regenerateStructNames)
@@ -991,6 +1041,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        mProfiler.endPass("RegenerateStructNames");
     }
 
     if (mShaderType == GL_VERTEX_SHADER &&
@@ -1002,6 +1053,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
             {
                 return false;
             }
+            mProfiler.endPass("EmulateGLDrawID");
         }
     }
 
@@ -1016,6 +1068,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
             {
                 return false;
             }
+            mProfiler.endPass("EmulateGLBaseVertexBaseInstance");
         }
     }
 
@@ -1029,27 +1082,35 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        mProfiler.endPass("EmulateGLFragColorBroadcast");
     }
 
     // Split multi declarations and remove calls to array length().
     // Note that SimplifyLoopConditions needs to be run before any other AST transformations
     // that may need to generate new statements from loop conditions or loop expressions.
-    if (!SimplifyLoopConditions(this, root,
+    if (mayContainASTNodes(root, ASTNodeKindSet{ASTNodeKind::Loop}) &&
+        mayContainASTNodes(root, ASTNodeKindSet{ASTNodeKind::MultiDeclaration,
+                                                ASTNodeKind::ArrayLengthMethod}) &&
+        !SimplifyLoopConditions(this, root,
                                 IntermNodePatternMatcher::kMultiDeclaration |
                                     IntermNodePatternMatcher::kArrayLengthMethod,
                                 &getSymbolTable()))
     {
         return false;
     }
+    mProfiler.endPass("SimplifyLoopConditions");
 
     // Note that separate declarations need to be run before other AST transformations that
     // generate new statements from expressions.
-    if (!SeparateDeclarations(*this, *root))
+    if (mayContainASTNodes(root, ASTNodeKindSet{ASTNodeKind::MultiDeclaration}) &&
+        !SeparateDeclarations(*this, *root))
     {
         return false;
     }
+    mProfiler.endPass("SeparateDeclarations");
 
-    if (IsWebGLBasedSpec(mShaderSpec))
+    if (IsWebGLBasedSpec(mShaderSpec) &&
+        mayContainASTNodes(root, ASTNodeKindSet{ASTNodeKind::Loop}))
     {
         // Remove infinite loops, they are not supposed to exist in shaders.
         bool anyInfiniteLoops = false;
@@ -1057,6 +1118,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        mProfiler.endPass("PruneInfiniteLoops");
 
         // If requested, reject shaders with infinite loops.  If not requested, the same loops are
         // removed from the shader as a fallback.
@@ -1073,30 +1135,39 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        mProfiler.endPass("RescopeGlobalVariables");
     }
 
     mValidateASTOptions.validateMultiDeclarations = true;
 
-    if (!SplitSequenceOperator(this, root, IntermNodePatternMatcher::kArrayLengthMethod,
-                               &getSymbolTable()))
+    if (mayContainASTNodes(root, ASTNodeKindSet{ASTNodeKind::ArrayLengthMethod}))
     {
-        return false;
-    }
+        if (mayContainASTNodes(root, ASTNodeKindSet{ASTNodeKind::SequenceOperator}) &&
+            !SplitSequenceOperator(this, root, IntermNodePatternMatcher::kArrayLengthMethod,
+                                   &getSymbolTable()))
+        {
+            return false;
+        }
+        mProfiler.endPass("SplitSequenceOperator");
 
-    if (!RemoveArrayLengthMethod(this, root))
-    {
-        return false;
+        if (!RemoveArrayLengthMethod(this, root))
+        {
+            return false;
+        }
+        mProfiler.endPass("RemoveArrayLengthMethod");
     }
     // Fold the expressions again, because |RemoveArrayLengthMethod| can introduce new constants.
     if (!FoldExpressions(this, root, &mDiagnostics))
     {
         return false;
     }
+    mProfiler.endPass("FoldExpressions");
 
     if (!RemoveUnreferencedVariables(this, root, &mSymbolTable))
     {
         return false;
     }
+    mProfiler.endPass("RemoveUnreferencedVariables");
 
     // In case the last case inside a switch statement is a certain type of no-op, GLSL compilers in
     // drivers may not accept it. In this case we clean up the dead code from the end of switch
@@ -1104,10 +1175,12 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // left switch statements that only contained an empty declaration inside the final case in an
     // invalid state. Relies on that PruneNoOps and RemoveUnreferencedVariables have already been
     // run.
-    if (!PruneEmptyCases(this, root))
+    if (mayContainASTNodes(root, ASTNodeKindSet{ASTNodeKind::Switch}) &&
+        !PruneEmptyCases(this, root))
     {
         return false;
     }
+    mProfiler.endPass("PruneEmptyCases");
 
     // Run after RemoveUnreferencedVariables, validate that the shader does not have excessively
     // large variables.
@@ -1115,12 +1188,14 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     {
         return false;
     }
+    mProfiler.endPass("ValidateTypeSizeLimitations");
 
     // Built-in function emulation needs to happen after validateLimitations pass.
     GetGlobalPoolAllocator()->lock();
     initBuiltInFunctionEmulator(&mBuiltInFunctionEmulator, compileOptions);
     GetGlobalPoolAllocator()->unlock();
     mBuiltInFunctionEmulator.markBuiltInFunctionsForEmulation(root);
+    mProfiler.endPass("markBuiltInFunctionsForEmulation");
 
     if (compileOptions.scalarizeVecAndMatConstructorArgs)
     {
@@ -1128,6 +1203,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        mProfiler.endPass("ScalarizeVecAndMatConstructorArgs");
     }
 
     if (compileOptions.forceShaderPrecisionHighpToMediump)
@@ -1136,6 +1212,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        mProfiler.endPass("ForceShaderPrecisionToMediump");
     }
 
     ASSERT(!mVariablesCollected);
@@ -1145,12 +1222,14 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
                      mResources, mTessControlShaderOutputVertices);
     collectInterfaceBlocks();
     mVariablesCollected = true;
+    mProfiler.endPass("CollectVariables");
     if (compileOptions.useUnusedStandardSharedBlocks)
     {
         if (!useAllMembersInUnusedStandardAndSharedBlocks(root))
         {
             return false;
         }
+        mProfiler.endPass("useAllMembersInUnusedStandardAndSharedBlocks");
     }
     if (compileOptions.enforcePackingRestrictions)
     {
@@ -1177,6 +1256,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        mProfiler.endPass("initializeOutputVariables");
     }
 
     // Removing invariant declarations must be done after collecting variables.
@@ -1187,6 +1267,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        mProfiler.endPass("RemoveInvariantDeclaration");
     }
 
     // gl_Position is always written in compatibility output mode.
@@ -1199,6 +1280,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        mProfiler.endPass("initializeGLPosition");
         mGLPositionInitialized = true;
     }
 
@@ -1216,6 +1298,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     {
         return false;
     }
+    mProfiler.endPass("DeferGlobalInitializers");
 
     if (initializeLocalsAndGlobals)
     {
@@ -1236,6 +1319,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
             {
                 return false;
             }
+            mProfiler.endPass("SimplifyLoopConditions");
         }
 
         if (!InitializeUninitializedLocals(this, root, getShaderVersion(), canUseLoopsToInitialize,
@@ -1243,6 +1327,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        mProfiler.endPass("InitializeUninitializedLocals");
     }
 
     if (getShaderType() == GL_VERTEX_SHADER && compileOptions.clampPointSize)
@@ -1252,6 +1337,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        mProfiler.endPass("ClampPointSize");
     }
 
     if (getShaderType() == GL_FRAGMENT_SHADER && compileOptions.clampFragDepth)
@@ -1260,6 +1346,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        mProfiler.endPass("ClampFragDepth");
     }
 
     if (compileOptions.rewriteRepeatedAssignToSwizzled)
@@ -1268,6 +1355,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        mProfiler.endPass("RewriteRepeatedAssignToSwizzled");
     }
 
     if (compileOptions.removeDynamicIndexingOfSwizzledVector)
@@ -1276,6 +1364,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        mProfiler.endPass("RemoveDynamicIndexingOfSwizzledVector");
     }
 
     return true;
@@ -1325,7 +1414,9 @@ bool TCompiler::compile(const char *const shaderStrings[],
         compileOptions.flattenPragmaSTDGLInvariantAll = true;
     }
 
-    TScopedPoolAllocator scopedAlloc(&allocator);
+    TScopedPoolAllocator scopedAlloc(&allocator, &mPoolAllocatorStats);
+    mProfiler.reset(compileOptions.profileCompilation);
+    TScopedCompileStage compileStage(&mProfiler, "Compile");
     TIntermBlock *root = compileTreeImpl(shaderStrings, numStrings, compileOptions);
 
     if (root)
@@ -1338,6 +1429,7 @@ bool TCompiler::compile(const char *const shaderStrings[],
         if (compileOptions.objectCode)
         {
             PerformanceDiagnostics perfDiagnostics(&mDiagnostics);
+            TScopedCompileStage translateStage(&mProfiler, "Translate");
             if (!translate(root, compileOptions, &perfDiagnostics))
             {
                 return false;
@@ -19,6 +19,7 @@
 #include "common/PackedEnums.h"
 #include "compiler/translator/BuiltInFunctionEmulator.h"
 #include "compiler/translator/CallDAG.h"
+#include "compiler/translator/CompileProfiler.h"
 #include "compiler/translator/Diagnostics.h"
 #include "compiler/translator/ExtensionBehavior.h"
 #include "compiler/translator/HashNames.h"
@@ -26,6 +27,7 @@
 #include "compiler/translator/Pragma.h"
 #include "compiler/translator/SymbolTable.h"
 #include "compiler/translator/ValidateAST.h"
+#include "compiler/translator/tree_util/FindASTNodeKinds.h"
 
 namespace sh
 {
@@ -116,6 +118,8 @@ class TCompiler : public TShHandleBase
     bool isEarlyFragmentTestsSpecified() const { return mEarlyFragmentTestsSpecified; }
     MetadataFlagBits getMetadataFlags() const { return mMetadataFlags; }
     SpecConstUsageBits getSpecConstUsageBits() const { return mSpecConstUsageBits; }
+    const angle::PoolAllocator::Stats &getPoolAllocatorStats() const { return mPoolAllocatorStats; }
+    TCompileProfiler &getProfiler() { return mProfiler; }
 
     bool isComputeShaderLocalSizeDeclared() const { return mComputeShaderLocalSizeDeclared; }
     const sh::WorkGroupSize &getComputeShaderLocalSize() const { return mComputeShaderLocalSize; }
@@ -216,6 +220,13 @@ class TCompiler : public TShHandleBase
     // it's expected to no longer transform.
     void enableValidateNoMoreTransformations();
 
+    // Whether the AST may contain nodes of any of |kinds|.  Transformations that only apply to such
+    // nodes are skipped if not, which saves traversing the whole AST for each of them.  The kinds
+    // are recorded by the parser, and transformations that introduce new kinds of nodes must add
+    // them with addASTNodeKinds.
+    bool mayContainASTNodes(TIntermNode *root, ASTNodeKindSet kinds) const;
+    void addASTNodeKinds(ASTNodeKindSet kinds) { mASTNodeKinds |= kinds; }
+
     bool areClipDistanceOrCullDistanceUsed() const
     {
         return mClipDistanceSize > 0 || mCullDistanceSize > 0;
@@ -385,12 +396,20 @@ class TCompiler : public TShHandleBase
     // Fragment shader uses screen-space derivatives
     bool mUsesDerivatives;
 
+    // Kinds of nodes the AST may contain.
+    ASTNodeKindSet mASTNodeKinds;
+
     // name hashing.
     NameMap mNameMap;
 
     TPragma mPragma;
 
     ShCompileOptions mCompileOptions;
+
+    // Pages of the pool allocator used by the last compilation.
+    angle::PoolAllocator::Stats mPoolAllocatorStats;
+
+    TCompileProfiler mProfiler;
 };
 
 //
@@ -2911,6 +2911,13 @@ TIntermNode *TParseContext::addLoop(TLoopType type,
 {
     TIntermNode *node       = nullptr;
     TIntermTyped *typedCond = nullptr;
+
+    mASTNodeKinds.set(ASTNodeKind::Loop);
+    if (type == ELoopDoWhile)
+    {
+        mASTNodeKinds.set(ASTNodeKind::DoWhileLoop);
+    }
+
     if (cond)
     {
         markStaticReadIfSymbol(cond);
@@ -3692,6 +3699,8 @@ void TParseContext::parseDeclarator(TPublicType &publicType,
                                     const ImmutableString &identifier,
                                     TIntermDeclaration *declarationOut)
 {
+    mASTNodeKinds.set(ASTNodeKind::MultiDeclaration);
+
     // If the declaration starting this declarator list was empty (example: int,), some checks were
     // not performed.
     if (mDeferredNonEmptyDeclarationErrorCheck)
@@ -3732,6 +3741,8 @@ void TParseContext::parseArrayDeclarator(TPublicType &elementType,
                                          const TVector<unsigned int> &arraySizes,
                                          TIntermDeclaration *declarationOut)
 {
+    mASTNodeKinds.set(ASTNodeKind::MultiDeclaration);
+
     // If the declaration starting this declarator list was empty (example: int,), some checks were
     // not performed.
     if (mDeferredNonEmptyDeclarationErrorCheck)
@@ -3778,6 +3789,8 @@ void TParseContext::parseInitDeclarator(const TPublicType &publicType,
                                         TIntermTyped *initializer,
                                         TIntermDeclaration *declarationOut)
 {
+    mASTNodeKinds.set(ASTNodeKind::MultiDeclaration);
+
     // If the declaration starting this declarator list was empty (example: int,), some checks were
     // not performed.
     if (mDeferredNonEmptyDeclarationErrorCheck)
@@ -3811,6 +3824,8 @@ void TParseContext::parseArrayInitDeclarator(const TPublicType &elementType,
                                              TIntermTyped *initializer,
                                              TIntermDeclaration *declarationOut)
 {
+    mASTNodeKinds.set(ASTNodeKind::MultiDeclaration);
+
     // If the declaration starting this declarator list was empty (example: int,), some checks were
     // not performed.
     if (mDeferredNonEmptyDeclarationErrorCheck)
@@ -5521,6 +5536,7 @@ TIntermTyped *TParseContext::addIndexExpression(TIntermTyped *baseExpression,
     }
 
     markStaticReadIfSymbol(indexExpression);
+    mASTNodeKinds.set(ASTNodeKind::IndirectIndex);
     TIntermBinary *node = new TIntermBinary(EOpIndexIndirect, baseExpression, indexExpression);
     node->setLine(location);
     // Indirect indexing can never be constant folded.
@@ -6650,6 +6666,7 @@ TIntermSwitch *TParseContext::addSwitch(TIntermTyped *init,
     }
 
     markStaticReadIfSymbol(init);
+    mASTNodeKinds.set(ASTNodeKind::Switch);
     TIntermSwitch *node = new TIntermSwitch(init, statementList);
     node->setLine(loc);
     return node;
@@ -7166,6 +7183,10 @@ TIntermTyped *TParseContext::addBinaryMathInternal(TOperator op,
             }
             // Basic types matching should have been already checked.
             ASSERT(right->getBasicType() == EbtBool);
+            if (op != EOpLogicalXor)
+            {
+                mASTNodeKinds.set(ASTNodeKind::ShortCircuitOperator);
+            }
             break;
         case EOpAdd:
         case EOpSub:
@@ -7299,6 +7320,7 @@ TIntermTyped *TParseContext::addComma(TIntermTyped *left,
               ",");
     }
 
+    mASTNodeKinds.set(ASTNodeKind::SequenceOperator);
     TIntermBinary *commaNode = TIntermBinary::CreateComma(left, right, mShaderVersion);
     markStaticReadIfSymbol(left);
     markStaticReadIfSymbol(right);
@@ -7795,6 +7817,7 @@ TIntermTyped *TParseContext::addMethod(TFunctionLookup *fnCall, const TSourceLoc
     }
     else
     {
+        mASTNodeKinds.set(ASTNodeKind::ArrayLengthMethod);
         TIntermUnary *node = new TIntermUnary(EOpArrayLength, thisNode, nullptr);
         markStaticReadIfSymbol(thisNode);
         node->setLine(loc);
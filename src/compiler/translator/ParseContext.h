@@ -78,6 +78,7 @@ class TParseContext : angle::NonCopyable
     bool usesDerivatives() const { return mUsesDerivatives; }
     bool isEarlyFragmentTestsSpecified() const { return mEarlyFragmentTestsSpecified; }
     bool hasDiscard() const { return mHasDiscard; }
+    ASTNodeKindSet getASTNodeKinds() const { return mASTNodeKinds; }
     bool isSampleQualifierSpecified() const { return mSampleQualifierSpecified; }
 
     void setLoopNestingLevel(int loopNestintLevel) { mLoopNestingLevel = loopNestintLevel; }
@@ -773,6 +774,8 @@ class TParseContext : angle::NonCopyable
     bool mPositionOrPointSizeUsedForSeparateShaderObject;  // true if gl_Position or gl_PointSize
                                                            // has been referenced.
     bool mUsesDerivatives;  // true if screen-space derivatives are used implicitly or explicitly
+    // Kinds of nodes that some AST transformations are limited to.
+    ASTNodeKindSet mASTNodeKinds;
     TLayoutMatrixPacking mDefaultUniformMatrixPacking;
     TLayoutBlockStorage mDefaultUniformBlockStorage;
     TLayoutMatrixPacking mDefaultBufferMatrixPacking;
@@ -426,6 +426,24 @@ int GetShaderVersion(const ShHandle handle)
     return compiler->getShaderVersion();
 }
 
+void GetCompileMemoryStats(const ShHandle handle, CompileMemoryStats *statsOut)
+{
+    TCompiler *compiler = GetCompilerFromHandle(handle);
+    ASSERT(compiler);
+
+    const angle::PoolAllocator::Stats &stats = compiler->getPoolAllocatorStats();
+    statsOut->peakBytes                      = stats.peakBytes;
+    statsOut->pagesAllocated                 = stats.pagesAllocated;
+    statsOut->pagesReused                    = stats.pagesReused;
+}
+
+const std::vector<CompileStageProfile> &GetCompileProfile(const ShHandle handle)
+{
+    TCompiler *compiler = GetCompilerFromHandle(handle);
+    ASSERT(compiler);
+    return compiler->getProfiler().getStages();
+}
+
 ShShaderOutput GetShaderOutputType(const ShHandle handle)
 {
     TCompiler *compiler = GetCompilerFromHandle(handle);
@@ -13,7 +13,12 @@
 
 #include "compiler/translator/SymbolTable.h"
 
+#include <mutex>
+#include <unordered_map>
+
 #include "angle_gl.h"
+#include "common/SimpleMutex.h"
+#include "common/hash_utils.h"
 #include "compiler/translator/ImmutableString.h"
 #include "compiler/translator/IntermNode.h"
 #include "compiler/translator/StaticType.h"
@@ -56,6 +61,140 @@ bool CheckExtension(uint32_t extensionIndex, const ShBuiltInResources &resources
     const int *resourcePtr = reinterpret_cast<const int *>(&resources);
     return resourcePtr[extensionIndex] > 0;
 }
+
+// Everything the resource-dependent built-ins are created from.  ShBuiltInResources is always
+// memset and memcpy'd, so keys can be hashed and compared bytewise.
+struct BuiltInVariablesKey
+{
+    sh::GLenum shaderType;
+    ShShaderSpec spec;
+    ShBuiltInResources resources;
+};
+static_assert(sizeof(BuiltInVariablesKey) ==
+                  sizeof(sh::GLenum) + sizeof(ShShaderSpec) + sizeof(ShBuiltInResources),
+              "BuiltInVariablesKey must not have padding");
+
+struct BuiltInVariablesKeyHash
+{
+    size_t operator()(const BuiltInVariablesKey &key) const
+    {
+        return angle::ComputeGenericHash(key);
+    }
+};
+
+struct BuiltInVariablesKeyEqual
+{
+    bool operator()(const BuiltInVariablesKey &a, const BuiltInVariablesKey &b) const
+    {
+        return memcmp(&a, &b, sizeof(a)) == 0;
+    }
+};
+
+// Computes the lazily cached properties of the built-ins up front, so compilers that share them
+// on different threads only ever read them.
+void PrecomputeLazyProperties(const TSymbolTableBase &builtIns)
+{
+    builtIns.forEachSymbol([](const TSymbol *symbol) {
+        if (symbol == nullptr)
+        {
+            return;
+        }
+
+        const TFieldListCollection *fields = nullptr;
+        if (symbol->isVariable())
+        {
+            const TType &type = static_cast<const TVariable *>(symbol)->getType();
+            type.getMangledName();
+            if (type.getStruct() != nullptr)
+            {
+                fields = type.getStruct();
+            }
+            else if (type.getInterfaceBlock() != nullptr)
+            {
+                fields = type.getInterfaceBlock();
+            }
+        }
+        else if (symbol->isStruct())
+        {
+            fields = static_cast<const TStructure *>(symbol);
+        }
+        else if (symbol->isInterfaceBlock())
+        {
+            fields = static_cast<const TInterfaceBlock *>(symbol);
+        }
+
+        if (fields != nullptr)
+        {
+            fields->objectSize();
+            fields->deepestNesting();
+            fields->mangledFieldList();
+        }
+    });
+}
+
+// The resource-dependent built-ins, shared by the symbol tables of all compilers in the process.
+// Compilers are recreated with every context, and creating these built-ins was the bulk of their
+// initialization.  Each set is created once and is immutable afterwards.
+//
+// Neither this cache nor its pool are ever freed, so the memory they use lives until process exit.
+// It is bounded by kMaxBuiltInVariableSets: a set takes a few tens of kilobytes of pool memory
+// (under 64KB including the unused parts of its pool pages), so at most a few megabytes are kept.
+// Compilers whose resources don't match one of the shared sets once the cap is reached create
+// their own built-ins in their symbol table's pool, as they did before the cache existed.
+class SharedBuiltInVariables final : angle::NonCopyable
+{
+  public:
+    static SharedBuiltInVariables *Get()
+    {
+        // Intentionally leaked, as compilers may be destroyed in any order, up until process exit.
+        static SharedBuiltInVariables *sSharedBuiltIns = new SharedBuiltInVariables;
+        return sSharedBuiltIns;
+    }
+
+    // Returns the built-ins for |key|, calling |createBuiltIns| to create them the first time.
+    // Returns nullptr if too many sets of built-ins are shared already, in which case the caller
+    // should create its own.
+    template <typename CreateFunc>
+    const TSymbolTableBase *getOrCreate(const BuiltInVariablesKey &key, CreateFunc &&createBuiltIns)
+    {
+        std::lock_guard<angle::SimpleMutex> lock(mMutex);
+
+        auto iter = mBuiltIns.find(key);
+        if (iter != mBuiltIns.end())
+        {
+            return iter->second.get();
+        }
+
+        // Bound the memory kept around in case resources keep changing, such as with WebGL
+        // contexts enabling extensions one by one.
+        if (mBuiltIns.size() >= kMaxBuiltInVariableSets)
+        {
+            return nullptr;
+        }
+
+        angle::PoolAllocator *compilerAllocator = GetGlobalPoolAllocator();
+        SetGlobalPoolAllocator(&mAllocator);
+        std::unique_ptr<TSymbolTableBase> builtIns = createBuiltIns();
+        SetGlobalPoolAllocator(compilerAllocator);
+
+        const TSymbolTableBase *result = builtIns.get();
+        mBuiltIns.emplace(key, std::move(builtIns));
+        return result;
+    }
+
+  private:
+    static constexpr size_t kMaxBuiltInVariableSets = 64;
+
+    SharedBuiltInVariables() { mAllocator.push(); }
+
+    angle::SimpleMutex mMutex;
+    angle::PoolAllocator mAllocator;
+    std::unordered_map<BuiltInVariablesKey,
+                       std::unique_ptr<TSymbolTableBase>,
+                       BuiltInVariablesKeyHash,
+                       BuiltInVariablesKeyEqual>
+        mBuiltIns;
+};
 }  // namespace
 
 class TSymbolTable::TSymbolTableLevel
@@ -449,7 +588,30 @@ void TSymbolTable::initializeBuiltIns(sh::GLenum type,
 
     setDefaultPrecision(EbtAtomicCounter, EbpHigh);
 
-    initializeBuiltInVariables(type, spec, resources);
+    BuiltInVariablesKey key;
+    key.shaderType = type;
+    key.spec       = spec;
+    key.resources  = resources;
+
+    const TSymbolTableBase *sharedBuiltIns =
+        SharedBuiltInVariables::Get()->getOrCreate(key, [type, spec, &resources]() {
+            TSymbolTable builder;
+            builder.initializeBuiltInVariables(type, spec, resources);
+
+            auto builtIns =
+                std::make_unique<TSymbolTableBase>(static_cast<const TSymbolTableBase &>(builder));
+            PrecomputeLazyProperties(*builtIns);
+            return builtIns;
+        });
+
+    if (sharedBuiltIns != nullptr)
+    {
+        static_cast<TSymbolTableBase &>(*this) = *sharedBuiltIns;
+    }
+    else
+    {
+        initializeBuiltInVariables(type, spec, resources);
+    }
     mUniqueIdCounter = kLastBuiltInId + 1;
 }
 
@@ -162,6 +162,155 @@ class TSymbolTableBase
     TSymbol *m_gl_PositionTESES3_2                           = nullptr;
     TSymbol *m_gl_ClipDistance                               = nullptr;
     TSymbol *m_gl_CullDistance                               = nullptr;
+
+    // Calls |visit| with each of the symbols above, some of which may be nullptr.
+    template <typename Visitor>
+    void forEachSymbol(Visitor &&visit) const
+    {
+        visit(m_gl_DepthRangeParameters);
+        visit(m_gl_DepthRange);
+        visit(m_gl_MaxVertexAttribs);
+        visit(m_gl_MaxVertexUniformVectors);
+        visit(m_gl_MaxVertexTextureImageUnits);
+        visit(m_gl_MaxCombinedTextureImageUnits);
+        visit(m_gl_MaxTextureImageUnits);
+        visit(m_gl_MaxFragmentUniformVectors);
+        visit(m_gl_MaxVaryingVectors);
+        visit(m_gl_MaxDrawBuffers);
+        visit(m_gl_MaxDualSourceDrawBuffersEXT);
+        visit(m_gl_MaxVertexOutputVectors);
+        visit(m_gl_MaxFragmentInputVectors);
+        visit(m_gl_MinProgramTexelOffset);
+        visit(m_gl_MaxProgramTexelOffset);
+        visit(m_gl_MaxImageUnits);
+        visit(m_gl_MaxVertexImageUniforms);
+        visit(m_gl_MaxFragmentImageUniforms);
+        visit(m_gl_MaxComputeImageUniforms);
+        visit(m_gl_MaxCombinedImageUniforms);
+        visit(m_gl_MaxCombinedShaderOutputResources);
+        visit(m_gl_MaxComputeWorkGroupCount);
+        visit(m_gl_MaxComputeWorkGroupSize);
+        visit(m_gl_MaxComputeUniformComponents);
+        visit(m_gl_MaxComputeTextureImageUnits);
+        visit(m_gl_MaxComputeAtomicCounters);
+        visit(m_gl_MaxComputeAtomicCounterBuffers);
+        visit(m_gl_MaxVertexAtomicCounters);
+        visit(m_gl_MaxFragmentAtomicCounters);
+        visit(m_gl_MaxCombinedAtomicCounters);
+        visit(m_gl_MaxAtomicCounterBindings);
+        visit(m_gl_MaxVertexAtomicCounterBuffers);
+        visit(m_gl_MaxFragmentAtomicCounterBuffers);
+        visit(m_gl_MaxCombinedAtomicCounterBuffers);
+        visit(m_gl_MaxAtomicCounterBufferSize);
+        visit(m_gl_MaxGeometryInputComponents);
+        visit(m_gl_MaxGeometryInputComponentsES3_2);
+        visit(m_gl_MaxGeometryOutputComponents);
+        visit(m_gl_MaxGeometryOutputComponentsES3_2);
+        visit(m_gl_MaxGeometryImageUniforms);
+        visit(m_gl_MaxGeometryImageUniformsES3_2);
+        visit(m_gl_MaxGeometryTextureImageUnits);
+        visit(m_gl_MaxGeometryTextureImageUnitsES3_2);
+        visit(m_gl_MaxGeometryOutputVertices);
+        visit(m_gl_MaxGeometryOutputVerticesES3_2);
+        visit(m_gl_MaxGeometryTotalOutputComponents);
+        visit(m_gl_MaxGeometryTotalOutputComponentsES3_2);
+        visit(m_gl_MaxGeometryUniformComponents);
+        visit(m_gl_MaxGeometryUniformComponentsES3_2);
+        visit(m_gl_MaxGeometryAtomicCounters);
+        visit(m_gl_MaxGeometryAtomicCountersES3_2);
+        visit(m_gl_MaxGeometryAtomicCounterBuffers);
+        visit(m_gl_MaxGeometryAtomicCounterBuffersES3_2);
+        visit(m_gl_MaxTessControlInputComponents);
+        visit(m_gl_MaxTessControlInputComponentsES3_2);
+        visit(m_gl_MaxTessControlOutputComponents);
+        visit(m_gl_MaxTessControlOutputComponentsES3_2);
+        visit(m_gl_MaxTessControlTextureImageUnits);
+        visit(m_gl_MaxTessControlTextureImageUnitsES3_2);
+        visit(m_gl_MaxTessControlUniformComponents);
+        visit(m_gl_MaxTessControlUniformComponentsES3_2);
+        visit(m_gl_MaxTessControlTotalOutputComponents);
+        visit(m_gl_MaxTessControlTotalOutputComponentsES3_2);
+        visit(m_gl_MaxTessControlImageUniforms);
+        visit(m_gl_MaxTessControlImageUniformsES3_2);
+        visit(m_gl_MaxTessControlAtomicCounters);
+        visit(m_gl_MaxTessControlAtomicCountersES3_2);
+        visit(m_gl_MaxTessControlAtomicCounterBuffers);
+        visit(m_gl_MaxTessControlAtomicCounterBuffersES3_2);
+        visit(m_gl_MaxTessPatchComponents);
+        visit(m_gl_MaxTessPatchComponentsES3_2);
+        visit(m_gl_MaxPatchVertices);
+        visit(m_gl_MaxPatchVerticesES3_2);
+        visit(m_gl_MaxTessGenLevel);
+        visit(m_gl_MaxTessGenLevelES3_2);
+        visit(m_gl_MaxTessEvaluationInputComponents);
+        visit(m_gl_MaxTessEvaluationInputComponentsES3_2);
+        visit(m_gl_MaxTessEvaluationOutputComponents);
+        visit(m_gl_MaxTessEvaluationOutputComponentsES3_2);
+        visit(m_gl_MaxTessEvaluationTextureImageUnits);
+        visit(m_gl_MaxTessEvaluationTextureImageUnitsES3_2);
+        visit(m_gl_MaxTessEvaluationUniformComponents);
+        visit(m_gl_MaxTessEvaluationUniformComponentsES3_2);
+        visit(m_gl_MaxTessEvaluationImageUniforms);
+        visit(m_gl_MaxTessEvaluationImageUniformsES3_2);
+        visit(m_gl_MaxTessEvaluationAtomicCounters);
+        visit(m_gl_MaxTessEvaluationAtomicCountersES3_2);
+        visit(m_gl_MaxTessEvaluationAtomicCounterBuffers);
+        visit(m_gl_MaxTessEvaluationAtomicCounterBuffersES3_2);
+        visit(m_gl_MaxSamples);
+        visit(m_gl_MaxSamplesES3_2);
+        visit(m_gl_MaxClipDistancesAPPLE);
+        visit(m_gl_MaxClipDistances);
+        visit(m_gl_MaxCullDistances);
+        visit(m_gl_MaxCombinedClipAndCullDistances);
+        visit(m_gl_FragData);
+        visit(m_gl_SecondaryFragDataEXT);
+        visit(m_gl_FragDepthEXT);
+        visit(m_gl_LastFragData);
+        visit(m_gl_LastFragDataNV);
+        visit(m_gl_SampleMaskIn);
+        visit(m_gl_SampleMaskInES3_2);
+        visit(m_gl_SampleMask);
+        visit(m_gl_SampleMaskES3_2);
+        visit(m_gl_ClipDistanceAPPLE);
+        visit(m_gl_PerVertex);
+        visit(m_gl_PerVertexES3_2);
+        visit(m_gl_in);
+        visit(m_gl_inES3_2);
+        visit(m_gl_PositionGS);
+        visit(m_gl_PositionGSES3_2);
+        visit(m_gl_TessLevelOuterTCS);
+        visit(m_gl_TessLevelOuterTCSES3_2);
+        visit(m_gl_TessLevelInnerTCS);
+        visit(m_gl_TessLevelInnerTCSES3_2);
+        visit(m_gl_PerVertexTCS);
+        visit(m_gl_PerVertexTCSES3_2);
+        visit(m_gl_inTCS);
+        visit(m_gl_inTCSES3_2);
+        visit(m_gl_outTCS);
+        visit(m_gl_outTCSES3_2);
+        visit(m_gl_BoundingBoxTCS);
+        visit(m_gl_BoundingBoxTCSES3_2);
+        visit(m_gl_PositionTCS);
+        visit(m_gl_PositionTCSES3_2);
+        visit(m_gl_BoundingBoxEXTTCS);
+        visit(m_gl_BoundingBoxEXTTCSES3_2);
+        visit(m_gl_BoundingBoxOESTCS);
+        visit(m_gl_BoundingBoxOESTCSES3_2);
+        visit(m_gl_TessLevelOuterTES);
+        visit(m_gl_TessLevelOuterTESES3_2);
+        visit(m_gl_TessLevelInnerTES);
+        visit(m_gl_TessLevelInnerTESES3_2);
+        visit(m_gl_PerVertexTES);
+        visit(m_gl_PerVertexTESES3_2);
+        visit(m_gl_inTES);
+        visit(m_gl_inTESES3_2);
+        visit(m_gl_outTES);
+        visit(m_gl_outTESES3_2);
+        visit(m_gl_PositionTES);
+        visit(m_gl_PositionTESES3_2);
+        visit(m_gl_ClipDistance);
+        visit(m_gl_CullDistance);
+    }
 };
 
 }  // namespace sh
@@ -225,6 +225,13 @@ class TSymbolTableBase
   public:
     TSymbolTableBase() = default;
 {declare_member_variables}
+
+    // Calls |visit| with each of the symbols above, some of which may be nullptr.
+    template <typename Visitor>
+    void forEachSymbol(Visitor &&visit) const
+    {{
+{visit_member_variables}
+    }}
 }};
 
 }}  // namespace sh
@@ -1263,6 +1270,7 @@ class VariablesData:
 
         # Code for defining TVariables stored as members of TSymbolTable.
         self.declare_member_variables = []
+        self.visit_member_variables = []
         self.init_member_variables = []
 
         # Declarations of static array sizes if any builtin TVariable is array.
@@ -2003,6 +2011,10 @@ return &k{name_with_suffix};
         variables.declare_member_variables.append(
             template_declare_member_variable.format(**template_args))
 
+        template_visit_member_variable = 'visit(m_{name_with_suffix});'
+        variables.visit_member_variables.append(
+            template_visit_member_variable.format(**template_args))
+
         obj = 'm_{name_with_suffix}'.format(**template_args)
 
         # TODO(http://anglebug.com/42262479): Add GLSL level once GLSL built-in vars are added
@@ -2156,6 +2168,8 @@ def generate_files(essl_only, args, functions_txt_filename, variables_json_filen
             '\n'.join(sorted(variables.get_variable_definitions)),
         'declare_member_variables':
             '\n'.join(variables.declare_member_variables),
+        'visit_member_variables':
+            '\n'.join(variables.visit_member_variables),
         'init_member_variables':
             '\n'.join(variables.init_member_variables),
         'mangled_names_array':
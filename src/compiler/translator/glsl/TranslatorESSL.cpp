@@ -194,10 +194,13 @@ bool TranslatorESSL::translate(TIntermBlock *root,
             getGeometryShaderOutputPrimitiveType(), getGeometryShaderMaxVertices());
     }
 
+    getProfiler().endPass("TranslatorESSL");
+
     // Write translated shader.
     TOutputESSL outputESSL(this, sink, compileOptions);
 
     root->traverse(&outputESSL);
+    getProfiler().endPass("TOutputESSL");
 
     return true;
 }
@@ -223,10 +223,13 @@ bool TranslatorGLSL::translate(TIntermBlock *root,
             getGeometryShaderOutputPrimitiveType(), getGeometryShaderMaxVertices());
     }
 
+    getProfiler().endPass("TranslatorGLSL");
+
     // Write translated shader.
     TOutputGLSL outputGLSL(this, sink, compileOptions);
 
     root->traverse(&outputGLSL);
+    getProfiler().endPass("TOutputGLSL");
 
     return true;
 }
@@ -6605,15 +6605,18 @@ bool OutputSPIRV(TCompiler *compiler,
     if (compiler->hasAnyPreciseType())
     {
         FindPreciseNodes(compiler, root);
+        compiler->getProfiler().endPass("FindPreciseNodes");
     }
 
     // Traverse the tree and generate SPIR-V instructions
     OutputSPIRVTraverser traverser(compiler, compileOptions, uniqueToSpirvIdMap,
                                    firstUnusedSpirvId);
     root->traverse(&traverser);
+    compiler->getProfiler().endPass("OutputSPIRVTraverser");
 
     // Generate the final SPIR-V and store in the sink
     spirv::Blob spirvBlob = traverser.getSpirv();
+    compiler->getProfiler().endPass("getSpirv");
     compiler->getInfoSink().obj.setBinary(std::move(spirvBlob));
 
     return true;
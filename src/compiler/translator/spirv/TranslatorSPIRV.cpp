@@ -1286,6 +1286,7 @@ bool TranslatorSPIRV::translate(TIntermBlock *root,
     {
         return false;
     }
+    getProfiler().endPass("TranslatorSPIRV");
 
     return OutputSPIRV(this, root, compileOptions, mUniqueToSpirvIdMap, mFirstUnusedSpirvId);
 }
@@ -0,0 +1,89 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// FindASTNodeKinds.cpp: Find the kinds of nodes that an AST contains.
+
+#include "compiler/translator/tree_util/FindASTNodeKinds.h"
+
+#include "compiler/translator/tree_util/IntermTraverse.h"
+
+namespace sh
+{
+namespace
+{
+class FindASTNodeKindsTraverser : public TIntermTraverser
+{
+  public:
+    FindASTNodeKindsTraverser() : TIntermTraverser(true, false, false) {}
+
+    bool visitUnary(Visit visit, TIntermUnary *node) override
+    {
+        if (node->getOp() == EOpArrayLength)
+        {
+            mKinds.set(ASTNodeKind::ArrayLengthMethod);
+        }
+        return true;
+    }
+
+    bool visitBinary(Visit visit, TIntermBinary *node) override
+    {
+        switch (node->getOp())
+        {
+            case EOpComma:
+                mKinds.set(ASTNodeKind::SequenceOperator);
+                break;
+            case EOpLogicalAnd:
+            case EOpLogicalOr:
+                mKinds.set(ASTNodeKind::ShortCircuitOperator);
+                break;
+            case EOpIndexIndirect:
+                mKinds.set(ASTNodeKind::IndirectIndex);
+                break;
+            default:
+                break;
+        }
+        return true;
+    }
+
+    bool visitSwitch(Visit visit, TIntermSwitch *node) override
+    {
+        mKinds.set(ASTNodeKind::Switch);
+        return true;
+    }
+
+    bool visitLoop(Visit visit, TIntermLoop *node) override
+    {
+        mKinds.set(ASTNodeKind::Loop);
+        if (node->getType() == ELoopDoWhile)
+        {
+            mKinds.set(ASTNodeKind::DoWhileLoop);
+        }
+        return true;
+    }
+
+    bool visitDeclaration(Visit visit, TIntermDeclaration *node) override
+    {
+        if (node->getSequence()->size() > 1)
+        {
+            mKinds.set(ASTNodeKind::MultiDeclaration);
+        }
+        return true;
+    }
+
+    ASTNodeKindSet getKinds() const { return mKinds; }
+
+  private:
+    ASTNodeKindSet mKinds;
+};
+}  // anonymous namespace
+
+ASTNodeKindSet FindASTNodeKinds(TIntermNode *root)
+{
+    FindASTNodeKindsTraverser traverser;
+    root->traverse(&traverser);
+    return traverser.getKinds();
+}
+}  // namespace sh
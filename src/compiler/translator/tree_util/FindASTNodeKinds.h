@@ -0,0 +1,45 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// FindASTNodeKinds.h: Kinds of AST nodes that some AST transformations are limited to, so those
+// transformations can be skipped for shaders that don't contain any.
+
+#ifndef COMPILER_TRANSLATOR_TREEUTIL_FINDASTNODEKINDS_H_
+#define COMPILER_TRANSLATOR_TREEUTIL_FINDASTNODEKINDS_H_
+
+#include "common/PackedEnums.h"
+
+namespace sh
+{
+class TIntermNode;
+
+enum class ASTNodeKind : uint8_t
+{
+    // Loops of any type.
+    Loop,
+    DoWhileLoop,
+    Switch,
+    // The comma operator.
+    SequenceOperator,
+    // The && and || operators.
+    ShortCircuitOperator,
+    ArrayLengthMethod,
+    IndirectIndex,
+    // Declarations with more than one declarator.
+    MultiDeclaration,
+
+    InvalidEnum,
+    EnumCount = InvalidEnum,
+};
+
+using ASTNodeKindSet = angle::PackedEnumBitSet<ASTNodeKind, uint8_t>;
+
+// Returns the kinds of nodes that |root| contains.  The parser records the same while building the
+// AST, so this is only needed to verify that.
+ASTNodeKindSet FindASTNodeKinds(TIntermNode *root);
+}  // namespace sh
+
+#endif  // COMPILER_TRANSLATOR_TREEUTIL_FINDASTNODEKINDS_H_
@@ -6,7 +6,9 @@
 
 // AstcDecompressorImpl.cpp: Decodes ASTC-encoded textures.
 
+#include <algorithm>
 #include <array>
+#include <cstring>
 #include <future>
 #include <unordered_map>
 
@@ -33,10 +35,14 @@ using AstcencContextUniquePtr = std::unique_ptr<astcenc_context, AstcencContextD
 // Returns the max number of threads to use when using multithreaded decompression
 uint32_t MaxThreads()
 {
-    static const uint32_t numThreads = std::min(16u, std::thread::hardware_concurrency());
+    static const uint32_t numThreads = std::clamp(std::thread::hardware_concurrency(), 1u, 16u);
     return numThreads;
 }
 
+// Decompression is only spread over more threads if each of them gets at least this many blocks to
+// decode, as every thread that joins the decompression has a fixed cost.
+constexpr size_t kMinBlocksPerThread = 256;
+
 // Creates a new astcenc_context and wraps it in a smart pointer.
 // It is not needed to call astcenc_context_free() on the returned pointer.
 // blockWith, blockSize: ASTC block size for the context
@@ -188,11 +194,14 @@ class AstcDecompressorImpl : public AstcDecompressor
                        std::shared_ptr<WorkerThreadPool> multiThreadPool,
                        const uint32_t imgWidth,
                        const uint32_t imgHeight,
+                       const uint32_t imgDepth,
                        const uint32_t blockWidth,
                        const uint32_t blockHeight,
                        const uint8_t *input,
                        size_t inputLength,
-                       uint8_t *output) override
+                       uint8_t *output,
+                       size_t outputRowPitch,
+                       size_t outputDepthPitch) override
     {
         // A given astcenc context can only decompress one image at a time, which we why we keep
         // this mutex locked the whole time.
@@ -202,19 +211,42 @@ class AstcDecompressorImpl : public AstcDecompressor
         if (context_status != ASTCENC_SUCCESS)
             return context_status;
 
+        // astcenc writes the rows of each slice tightly packed.  When the output rows are packed
+        // too, the slices are decoded in place, e.g. straight into a staging buffer.
+        const size_t packedRowPitch   = static_cast<size_t>(imgWidth) * 4;
+        const size_t packedDepthPitch = packedRowPitch * imgHeight;
+        const bool decodeInPlace      = outputRowPitch == packedRowPitch;
+
+        std::vector<uint8_t> packedOutput;
+        if (!decodeInPlace)
+        {
+            packedOutput.resize(packedDepthPitch * imgDepth);
+        }
+
+        mSlices.resize(imgDepth);
+        for (uint32_t slice = 0; slice < imgDepth; ++slice)
+        {
+            mSlices[slice] = decodeInPlace ? output + slice * outputDepthPitch
+                                           : packedOutput.data() + slice * packedDepthPitch;
+        }
+
         astcenc_image image;
         image.dim_x     = imgWidth;
         image.dim_y     = imgHeight;
-        image.dim_z     = 1;
+        image.dim_z     = imgDepth;
         image.data_type = ASTCENC_TYPE_U8;
-        image.data      = reinterpret_cast<void **>(&output);
-
-        // For smaller images the overhead of multithreading exceeds the benefits.
-        const bool singleThreaded = (imgHeight <= 32 && imgWidth <= 32) || !multiThreadPool;
-
-        std::shared_ptr<WorkerThreadPool> &threadPool =
-            singleThreaded ? singleThreadPool : multiThreadPool;
-        const uint32_t threadCount = singleThreaded ? 1 : MaxThreads();
+        image.data      = mSlices.data();
+
+        // All the threads decode blocks from the same queue, so the work is split between them
+        // evenly.  For smaller images the overhead of multithreading exceeds the benefits.
+        const size_t blockCount = static_cast<size_t>((imgWidth + blockWidth - 1) / blockWidth) *
+                                  ((imgHeight + blockHeight - 1) / blockHeight) * imgDepth;
+        uint32_t threadCount = 1;
+        if (multiThreadPool && multiThreadPool->isAsync())
+        {
+            threadCount = static_cast<uint32_t>(
+                std::clamp<size_t>(blockCount / kMinBlocksPerThread, 1, MaxThreads()));
+        }
 
         mTasks.clear();
         mWaitEvents.clear();
@@ -223,8 +255,15 @@ class AstcDecompressorImpl : public AstcDecompressor
         {
             mTasks.push_back(
                 std::make_shared<DecompressTask>(context, i, input, inputLength, &image));
-            mWaitEvents.push_back(threadPool->postWorkerTask(mTasks[i]));
         }
+
+        // The calling thread decodes blocks too, instead of waiting for the workers.
+        for (uint32_t i = 1; i < threadCount; ++i)
+        {
+            mWaitEvents.push_back(multiThreadPool->postWorkerTask(mTasks[i]));
+        }
+        (*mTasks[0])();
+
         WaitableEvent::WaitMany(&mWaitEvents);
         astcenc_decompress_reset(context);
 
@@ -233,6 +272,20 @@ class AstcDecompressorImpl : public AstcDecompressor
             if (task->result != ASTCENC_SUCCESS)
                 return task->result;
         }
+
+        if (!decodeInPlace)
+        {
+            for (uint32_t slice = 0; slice < imgDepth; ++slice)
+            {
+                for (uint32_t row = 0; row < imgHeight; ++row)
+                {
+                    memcpy(output + slice * outputDepthPitch + row * outputRowPitch,
+                           packedOutput.data() + slice * packedDepthPitch + row * packedRowPitch,
+                           packedRowPitch);
+                }
+            }
+        }
+
         return ASTCENC_SUCCESS;
     }
 
@@ -247,6 +300,7 @@ class AstcDecompressorImpl : public AstcDecompressor
     angle::SimpleMutex mMutex;  // Locked while calling `decode()`
     std::vector<std::shared_ptr<DecompressTask>> mTasks;
     std::vector<std::shared_ptr<WaitableEvent>> mWaitEvents;
+    std::vector<void *> mSlices;
 };
 
 }  // namespace
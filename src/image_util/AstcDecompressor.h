@@ -38,11 +38,16 @@ class AstcDecompressor
     // multiThreadPool: (optional) a multi-threaded pool. If non-null, this will be used if the
     //                  image is large enough to benefit from it.
     // imgWidth, imgHeight: width and height of the texture, in texels.
+    // imgDepth: number of slices of the texture, e.g. the layers of a 2D array texture.
     // blockWidth, blockHeight: ASTC encoding block size.
-    // input: pointer to the ASTC data to decompress
+    // input: pointer to the ASTC data to decompress, with the blocks of each slice following those
+    //        of the previous slice.
     // inputLength: size of astData
-    // output: where to white the decompressed output. This buffer must be able to hold at least
-    //         imgWidth * imgHeight * 4 bytes.
+    // output: where to write the decompressed RGBA8 output.
+    // outputRowPitch, outputDepthPitch: distance in bytes between the rows and between the slices
+    //                                   of the output. The blocks are decoded directly into output
+    //                                   when outputRowPitch is imgWidth * 4, and are copied from a
+    //                                   temporary buffer otherwise.
     //
     // Returns 0 on success, or a non-zero status code on error. Use getStatusString() to convert
     // this status code to an error string.
@@ -50,11 +55,14 @@ class AstcDecompressor
                                std::shared_ptr<WorkerThreadPool> multiThreadPool,
                                uint32_t imgWidth,
                                uint32_t imgHeight,
+                               uint32_t imgDepth,
                                uint32_t blockWidth,
                                uint32_t blockHeight,
                                const uint8_t *input,
                                size_t inputLength,
-                               uint8_t *output) = 0;
+                               uint8_t *output,
+                               size_t outputRowPitch,
+                               size_t outputDepthPitch) = 0;
 
     // Returns an error string for a given status code. Will always return non-null.
     virtual const char *getStatusString(int32_t statusCode) const = 0;
@@ -23,11 +23,14 @@ class AstcDecompressorNoOp : public AstcDecompressor
                        std::shared_ptr<WorkerThreadPool> multiThreadPool,
                        uint32_t imgWidth,
                        uint32_t imgHeight,
+                       uint32_t imgDepth,
                        uint32_t blockWidth,
                        uint32_t blockHeight,
                        const uint8_t *astcData,
                        size_t astcDataLength,
-                       uint8_t *output) override
+                       uint8_t *output,
+                       size_t outputRowPitch,
+                       size_t outputDepthPitch) override
     {
         return -1;
     }
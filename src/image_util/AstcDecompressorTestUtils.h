@@ -65,4 +65,24 @@ std::vector<uint8_t> makeAstcCheckerboard(int width, int height)
     return result;
 }
 
+// Returns an ASTC-encoded image of a given size and block size. Every block is the same
+// black-and-white block with a 4x4 grid of 1-bit weights, which is valid for all 2D block sizes.
+std::vector<uint8_t> makeAstcImage(int width, int height, int blockWidth, int blockHeight)
+{
+    const std::vector<uint8_t> block = {0x41, 0x00, 0x00, 0xfe, 0x01, 0x00, 0x00, 0x00,
+                                        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xaa};
+
+    const int numBlocks =
+        ((width + blockWidth - 1) / blockWidth) * ((height + blockHeight - 1) / blockHeight);
+
+    std::vector<uint8_t> result;
+    result.reserve(numBlocks * block.size());
+    for (int i = 0; i < numBlocks; ++i)
+    {
+        result.insert(result.end(), block.begin(), block.end());
+    }
+
+    return result;
+}
+
 }  // namespace testing
\ No newline at end of file
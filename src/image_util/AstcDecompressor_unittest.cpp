@@ -34,8 +34,9 @@ TEST(AstcDecompressor, Decompress)
     std::vector<Rgba> output(width * height);
     std::vector<uint8_t> astcData = makeAstcCheckerboard(width, height);
     int32_t status =
-        decompressor.decompress(singleThreadedPool, multiThreadedPool, width, height, 8, 8,
-                                astcData.data(), astcData.size(), (uint8_t *)output.data());
+        decompressor.decompress(singleThreadedPool, multiThreadedPool, width, height, 1, 8, 8,
+                                astcData.data(), astcData.size(), (uint8_t *)output.data(),
+                                width * 4, width * height * 4);
     EXPECT_EQ(status, 0);
 
     std::vector<Rgba> expected = makeCheckerboard(width, height);
@@ -43,6 +44,51 @@ TEST(AstcDecompressor, Decompress)
     ASSERT_THAT(output, ElementsAreArray(expected));
 }
 
+// Test that the slices of an image are decompressed to the output rows and slices they belong to,
+// when the output rows aren't tightly packed.
+TEST(AstcDecompressor, DecompressSlicesWithRowPitch)
+{
+    const int width       = 64;
+    const int height      = 64;
+    const int depth       = 3;
+    const int rowPitch    = (width + 3) * 4;
+    const int depthPitch  = rowPitch * height + 16;
+    const uint8_t kFiller = 0xCD;
+
+    auto singleThreadedPool = WorkerThreadPool::Create(1, ANGLEPlatformCurrent());
+    auto multiThreadedPool  = WorkerThreadPool::Create(0, ANGLEPlatformCurrent());
+
+    auto &decompressor = AstcDecompressor::get();
+    if (!decompressor.available())
+        GTEST_SKIP() << "ASTC decompressor not available";
+
+    std::vector<uint8_t> output(depthPitch * depth, kFiller);
+    std::vector<uint8_t> astcData = makeAstcCheckerboard(width, height * depth);
+    int32_t status =
+        decompressor.decompress(singleThreadedPool, multiThreadedPool, width, height, depth, 8, 8,
+                                astcData.data(), astcData.size(), output.data(), rowPitch,
+                                depthPitch);
+    EXPECT_EQ(status, 0);
+
+    std::vector<Rgba> expected = makeCheckerboard(width, height);
+
+    for (int slice = 0; slice < depth; ++slice)
+    {
+        for (int row = 0; row < height; ++row)
+        {
+            const uint8_t *rowData = output.data() + slice * depthPitch + row * rowPitch;
+
+            std::vector<Rgba> texels(width);
+            memcpy(texels.data(), rowData, width * 4);
+            ASSERT_THAT(texels, ElementsAreArray(expected.data() + row * width, width));
+
+            // The padding at the end of the rows is left untouched.
+            ASSERT_THAT(std::vector<uint8_t>(rowData + width * 4, rowData + rowPitch),
+                        Each(kFiller));
+        }
+    }
+}
+
 // Test that getStatusString returns non-null even for unknown statuses
 TEST(AstcDecompressor, getStatusStringAlwaysNonNull)
 {
@@ -0,0 +1,125 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// GenerateMip_unittest.cpp: Unit tests for the mip generation functions.
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "common/mathutil.h"
+#include "image_util/generatemip.h"
+
+using namespace angle;
+
+namespace
+{
+// Generates the mip of a W x H x 1 image one pixel at a time, as the reference for GenerateMip.
+template <typename T>
+void GenerateMipXYReference(size_t sourceWidth,
+                            size_t sourceHeight,
+                            const uint8_t *sourceData,
+                            size_t sourceRowPitch,
+                            uint8_t *destData,
+                            size_t destRowPitch)
+{
+    for (size_t y = 0; y < sourceHeight / 2; y++)
+    {
+        for (size_t x = 0; x < sourceWidth / 2; x++)
+        {
+            auto pixel = [&](size_t pixelX, size_t pixelY) {
+                return reinterpret_cast<const T *>(sourceData + pixelY * sourceRowPitch +
+                                                   pixelX * sizeof(T));
+            };
+
+            T tmp0, tmp1;
+            T::average(&tmp0, pixel(x * 2, y * 2), pixel(x * 2, y * 2 + 1));
+            T::average(&tmp1, pixel(x * 2 + 1, y * 2), pixel(x * 2 + 1, y * 2 + 1));
+            T::average(reinterpret_cast<T *>(destData + y * destRowPitch + x * sizeof(T)), &tmp0,
+                       &tmp1);
+        }
+    }
+}
+
+template <typename T>
+class GenerateMipTest : public ::testing::Test
+{
+  protected:
+    // Fills |data| with random bytes, or random half floats in a range that has no denormals or
+    // special values for |T| of R16G16B16A16F if |normalHalfFloats| is set.
+    void fillSourceData(std::vector<uint8_t> *data, bool normalHalfFloats)
+    {
+        for (size_t index = 0; index + 1 < data->size(); index += 2)
+        {
+            uint16_t value = static_cast<uint16_t>(mRandom());
+            if (normalHalfFloats)
+            {
+                // Exponents 1 to 30.
+                value = static_cast<uint16_t>((value & 0x83FF) | ((1 + (value >> 10) % 30) << 10));
+            }
+            memcpy(&(*data)[index], &value, sizeof(value));
+        }
+    }
+
+    void testSizes(bool normalHalfFloats)
+    {
+        // Widths around the vector sizes of the SIMD paths, so both the vector loops and the
+        // scalar remainders are covered.  Odd sizes ignore their last row or column.
+        const size_t kWidths[]  = {2, 3, 8, 9, 16, 17, 33, 34, 64, 67};
+        const size_t kHeights[] = {2, 3, 5};
+
+        for (size_t sourceWidth : kWidths)
+        {
+            for (size_t sourceHeight : kHeights)
+            {
+                const size_t sourceRowPitch = sourceWidth * sizeof(T) + 4;
+                const size_t destWidth      = sourceWidth / 2;
+                const size_t destHeight     = sourceHeight / 2;
+                const size_t destRowPitch   = destWidth * sizeof(T) + 8;
+
+                std::vector<uint8_t> source(sourceRowPitch * sourceHeight);
+                fillSourceData(&source, normalHalfFloats);
+
+                std::vector<uint8_t> expected(destRowPitch * destHeight, 0);
+                std::vector<uint8_t> actual(destRowPitch * destHeight, 0);
+                GenerateMipXYReference<T>(sourceWidth, sourceHeight, source.data(),
+                                          sourceRowPitch, expected.data(), destRowPitch);
+                GenerateMip<T>(sourceWidth, sourceHeight, 1, source.data(), sourceRowPitch,
+                               sourceRowPitch * sourceHeight, actual.data(), destRowPitch,
+                               destRowPitch * destHeight);
+
+                for (size_t y = 0; y < destHeight; y++)
+                {
+                    const size_t rowOffset = y * destRowPitch;
+                    EXPECT_EQ(0, memcmp(&expected[rowOffset], &actual[rowOffset],
+                                        destWidth * sizeof(T)))
+                        << "Mismatch in row " << y << " of a " << sourceWidth << "x"
+                        << sourceHeight << " image";
+                }
+            }
+        }
+    }
+
+    std::mt19937 mRandom{1};
+};
+
+using MipFormats = ::testing::
+    Types<R8, A8, L8, R8G8, L8A8, R8G8B8A8, B8G8R8A8, R8G8B8X8, B8G8R8X8, R16G16B16A16F>;
+TYPED_TEST_SUITE(GenerateMipTest, MipFormats);
+
+// Tests that mips of W x H x 1 images match averaging every pixel on its own.
+TYPED_TEST(GenerateMipTest, MatchesPerPixelAverage)
+{
+    this->testSizes(false);
+}
+
+// Tests the same with data without special values, so the half float mips don't fall back to
+// per-pixel averaging.
+TYPED_TEST(GenerateMipTest, MatchesPerPixelAverageWithNormalValues)
+{
+    this->testSizes(true);
+}
+}  // namespace
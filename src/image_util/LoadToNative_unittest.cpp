@@ -6,6 +6,8 @@
 // LoadToNative_unittest.cpp: Unit tests for pixel loading functions.
 
 #include <gmock/gmock.h>
+#include <cstring>
+#include <limits>
 #include <vector>
 #include "common/debug.h"
 #include "common/mathutil.h"
@@ -500,4 +502,240 @@ TEST(LoadToNative3To4, LoadByteRGBToRGBAWithUnalignedWidthAndAlignment4)
         TestLoadByteRGBToRGBAForAllCases(context, alignment, 5, 5, 1, 0, 0, alignment);
     }
 }
+
+using LoadFunction = void (*)(const ImageLoadContext &context,
+                              size_t width,
+                              size_t height,
+                              size_t depth,
+                              const uint8_t *input,
+                              size_t inputRowPitch,
+                              size_t inputDepthPitch,
+                              uint8_t *output,
+                              size_t outputRowPitch,
+                              size_t outputDepthPitch);
+
+// Widths around the vector sizes of the SIMD load paths, so both the vector loops and the scalar
+// remainders are covered.
+constexpr size_t kConversionTestWidths[] = {1, 3, 7, 8, 9, 15, 16, 17, 31, 33, 100};
+
+// Runs |loadFunction| on rows that are not 16-byte aligned, and compares every pixel with
+// |convertPixel|.  Each of |inputPixels| is converted at least once for every width.
+template <typename ConvertPixelFunction>
+void TestLoadConversion(LoadFunction loadFunction,
+                        const std::vector<uint8_t> &inputPixels,
+                        size_t inputPixelBytes,
+                        size_t outputPixelBytes,
+                        ConvertPixelFunction convertPixel)
+{
+    ImageLoadContext context;
+    constexpr size_t kOffset = 4;
+    const size_t pixelCount  = inputPixels.size() / inputPixelBytes;
+
+    for (size_t width : kConversionTestWidths)
+    {
+        const size_t height         = std::max<size_t>(3, (pixelCount + width - 1) / width);
+        const size_t inputRowPitch  = width * inputPixelBytes + 4;
+        const size_t outputRowPitch = width * outputPixelBytes + 8;
+
+        std::vector<uint8_t> input(kOffset + inputRowPitch * height, 0);
+        for (size_t y = 0; y < height; y++)
+        {
+            for (size_t x = 0; x < width; x++)
+            {
+                const size_t pixel = (y * width + x) % pixelCount;
+                memcpy(&input[kOffset + y * inputRowPitch + x * inputPixelBytes],
+                       &inputPixels[pixel * inputPixelBytes], inputPixelBytes);
+            }
+        }
+
+        std::vector<uint8_t> output(kOffset + outputRowPitch * height, 0);
+        loadFunction(context, width, height, 1, input.data() + kOffset, inputRowPitch,
+                     inputRowPitch * height, output.data() + kOffset, outputRowPitch,
+                     outputRowPitch * height);
+
+        std::vector<uint8_t> expected(outputPixelBytes);
+        for (size_t y = 0; y < height; y++)
+        {
+            for (size_t x = 0; x < width; x++)
+            {
+                convertPixel(&input[kOffset + y * inputRowPitch + x * inputPixelBytes],
+                             expected.data());
+                const uint8_t *actual =
+                    &output[kOffset + y * outputRowPitch + x * outputPixelBytes];
+                ASSERT_EQ(0, memcmp(expected.data(), actual, outputPixelBytes))
+                    << "Mismatch at pixel " << x << ", " << y << " with width " << width;
+            }
+        }
+    }
+}
+
+// Every value of a 16-bit pixel in native byte order.
+std::vector<uint8_t> AllUint16Pixels()
+{
+    std::vector<uint8_t> pixels(0x10000 * sizeof(uint16_t));
+    for (uint32_t value = 0; value < 0x10000; value++)
+    {
+        const uint16_t pixel = static_cast<uint16_t>(value);
+        memcpy(&pixels[value * sizeof(uint16_t)], &pixel, sizeof(uint16_t));
+    }
+    return pixels;
+}
+
+uint16_t ReadUint16(const uint8_t *data)
+{
+    uint16_t value;
+    memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+uint8_t Expand5To8(uint32_t value)
+{
+    return static_cast<uint8_t>((value << 3) | (value >> 2));
+}
+
+uint8_t Expand6To8(uint32_t value)
+{
+    return static_cast<uint8_t>((value << 2) | (value >> 4));
+}
+
+// Tests loading luminance to RGBA8 against the per-pixel conversion.
+TEST(LoadToNativeConversion, L8ToRGBA8)
+{
+    std::vector<uint8_t> pixels(256);
+    for (size_t value = 0; value < pixels.size(); value++)
+    {
+        pixels[value] = static_cast<uint8_t>(value * 7);
+    }
+
+    TestLoadConversion(LoadL8ToRGBA8, pixels, 1, 4, [](const uint8_t *in, uint8_t *out) {
+        out[0] = out[1] = out[2] = in[0];
+        out[3]                   = 0xFF;
+    });
+}
+
+// Tests loading luminance alpha to RGBA8 against the per-pixel conversion.
+TEST(LoadToNativeConversion, LA8ToRGBA8)
+{
+    TestLoadConversion(LoadLA8ToRGBA8, AllUint16Pixels(), 2, 4,
+                       [](const uint8_t *in, uint8_t *out) {
+                           out[0] = out[1] = out[2] = in[0];
+                           out[3]                   = in[1];
+                       });
+}
+
+// Tests loading RGB565 to RGBA8 and BGRA8 against the per-pixel conversion.
+TEST(LoadToNativeConversion, R5G6B5ToRGBA8)
+{
+    TestLoadConversion(LoadR5G6B5ToRGBA8, AllUint16Pixels(), 2, 4,
+                       [](const uint8_t *in, uint8_t *out) {
+                           const uint16_t rgb = ReadUint16(in);
+                           out[0]             = Expand5To8(rgb >> 11);
+                           out[1]             = Expand6To8((rgb >> 5) & 0x3F);
+                           out[2]             = Expand5To8(rgb & 0x1F);
+                           out[3]             = 0xFF;
+                       });
+    TestLoadConversion(LoadR5G6B5ToBGRA8, AllUint16Pixels(), 2, 4,
+                       [](const uint8_t *in, uint8_t *out) {
+                           const uint16_t rgb = ReadUint16(in);
+                           out[0]             = Expand5To8(rgb & 0x1F);
+                           out[1]             = Expand6To8((rgb >> 5) & 0x3F);
+                           out[2]             = Expand5To8(rgb >> 11);
+                           out[3]             = 0xFF;
+                       });
+}
+
+// Tests loading RGBA4 to RGBA8 against the per-pixel conversion.
+TEST(LoadToNativeConversion, RGBA4ToRGBA8)
+{
+    TestLoadConversion(LoadRGBA4ToRGBA8, AllUint16Pixels(), 2, 4,
+                       [](const uint8_t *in, uint8_t *out) {
+                           const uint16_t rgba = ReadUint16(in);
+                           for (size_t channel = 0; channel < 4; channel++)
+                           {
+                               const uint32_t value = (rgba >> (12 - 4 * channel)) & 0xF;
+                               out[channel]         = static_cast<uint8_t>(value * 0x11);
+                           }
+                       });
+}
+
+// Tests loading RGB5A1 to RGBA8 against the per-pixel conversion.
+TEST(LoadToNativeConversion, RGB5A1ToRGBA8)
+{
+    TestLoadConversion(LoadRGB5A1ToRGBA8, AllUint16Pixels(), 2, 4,
+                       [](const uint8_t *in, uint8_t *out) {
+                           const uint16_t rgba = ReadUint16(in);
+                           out[0]              = Expand5To8(rgba >> 11);
+                           out[1]              = Expand5To8((rgba >> 6) & 0x1F);
+                           out[2]              = Expand5To8((rgba >> 1) & 0x1F);
+                           out[3]              = (rgba & 1) ? 0xFF : 0;
+                       });
+}
+
+// Tests converting floats to half floats against gl::float32ToFloat16, including the values that
+// round, overflow, underflow or become denormal half floats.
+TEST(LoadToNativeConversion, Float32ToFloat16)
+{
+    std::vector<float> values = {0.0f,
+                                 -0.0f,
+                                 1.0f,
+                                 -1.0f,
+                                 0.1f,
+                                 1.0009766f,
+                                 1.0004883f,
+                                 1.0014648f,
+                                 65504.0f,
+                                 65519.0f,
+                                 65520.0f,
+                                 -70000.0f,
+                                 6.1035156e-5f,
+                                 6.0e-5f,
+                                 1.0e-6f,
+                                 -5.9604645e-8f,
+                                 2.0e-8f,
+                                 1.0e-30f,
+                                 std::numeric_limits<float>::denorm_min(),
+                                 std::numeric_limits<float>::infinity(),
+                                 -std::numeric_limits<float>::infinity(),
+                                 std::numeric_limits<float>::quiet_NaN(),
+                                 -std::numeric_limits<float>::quiet_NaN()};
+
+    // Walk through all float exponents with a few mantissas.
+    for (uint32_t exponent = 0; exponent < 256; exponent++)
+    {
+        for (uint32_t mantissa : {0x000000u, 0x001000u, 0x002FFFu, 0x7FE000u, 0x7FFFFFu})
+        {
+            for (uint32_t sign : {0u, 0x80000000u})
+            {
+                values.push_back(gl::bitCast<float>(sign | (exponent << 23) | mantissa));
+            }
+        }
+    }
+
+    // Runs of values without denormal results, so whole vectors take the SIMD path.
+    for (float value = -300.0f; value < 300.0f; value += 1.37f)
+    {
+        values.push_back(value);
+    }
+
+    // Keep a whole number of pixels for each of the component counts below.
+    values.resize(values.size() / 12 * 12);
+    std::vector<uint8_t> pixels(values.size() * sizeof(float));
+    memcpy(pixels.data(), values.data(), pixels.size());
+
+    auto convertComponents = [](size_t componentCount) {
+        return [componentCount](const uint8_t *in, uint8_t *out) {
+            for (size_t component = 0; component < componentCount; component++)
+            {
+                float value;
+                memcpy(&value, in + component * sizeof(float), sizeof(float));
+                const uint16_t half = gl::float32ToFloat16(value);
+                memcpy(out + component * sizeof(uint16_t), &half, sizeof(uint16_t));
+            }
+        };
+    };
+
+    TestLoadConversion(Load32FTo16F<1>, pixels, 4, 2, convertComponents(1));
+    TestLoadConversion(Load32FTo16F<4>, pixels, 16, 8, convertComponents(4));
+    TestLoadConversion(LoadRGB32FToRGB16F, pixels, 12, 6, convertComponents(3));
+}
 }  // namespace
\ No newline at end of file
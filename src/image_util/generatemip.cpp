@@ -0,0 +1,268 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// generatemip.cpp: Defines the vectorized rows of the GenerateMip function.
+
+#include "image_util/generatemip.h"
+
+#include "common/mathutil.h"
+#include "image_util/imageformats.h"
+#include "image_util/simdutils.h"
+
+namespace angle
+{
+namespace priv
+{
+namespace
+{
+#if defined(ANGLE_IMAGE_UTIL_USE_SSE2)
+// Splits the pixels of 32 bytes of a row into the even and the odd ones.
+template <size_t pixelBytes>
+inline void DeinterleavePixelsSSE2(__m128i first, __m128i second, __m128i *even, __m128i *odd)
+{
+    switch (pixelBytes)
+    {
+        case 1:
+        {
+            const __m128i lowByte = _mm_set1_epi16(0x00FF);
+            *even = _mm_packus_epi16(_mm_and_si128(first, lowByte), _mm_and_si128(second, lowByte));
+            *odd  = _mm_packus_epi16(_mm_srli_epi16(first, 8), _mm_srli_epi16(second, 8));
+            break;
+        }
+        case 2:
+            // Sign extend the 16-bit pixels so the saturating pack keeps them as they are.
+            *even = _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(first, 16), 16),
+                                    _mm_srai_epi32(_mm_slli_epi32(second, 16), 16));
+            *odd  = _mm_packs_epi32(_mm_srai_epi32(first, 16), _mm_srai_epi32(second, 16));
+            break;
+        default:
+        {
+            const __m128 firstPs  = _mm_castsi128_ps(first);
+            const __m128 secondPs = _mm_castsi128_ps(second);
+            *even = _mm_castps_si128(_mm_shuffle_ps(firstPs, secondPs, _MM_SHUFFLE(2, 0, 2, 0)));
+            *odd  = _mm_castps_si128(_mm_shuffle_ps(firstPs, secondPs, _MM_SHUFFLE(3, 1, 3, 1)));
+            break;
+        }
+    }
+}
+
+// Rounds floats to half floats and back.  Lanes that are denormal as half floats are flagged in
+// |denormalsOut|.
+inline __m128 RoundToFloat16SSE2(__m128 value, __m128i *denormalsOut)
+{
+    __m128i unused;
+    const __m128i fp16 = Float32ToFloat16SSE2(_mm_castps_si128(value), denormalsOut);
+    return Float16ToFloat32SSE2(fp16, &unused);
+}
+
+// Generates one pixel of a RGBA16F mip from the four source pixels it covers, in the same order
+// of operations as R16G16B16A16F::average.
+inline __m128i GenerateRGBA16FPixelSSE2(__m128i src0,
+                                        __m128i src1,
+                                        __m128i src2,
+                                        __m128i src3,
+                                        __m128i *denormalsOut)
+{
+    const __m128 half = _mm_set1_ps(0.5f);
+    __m128i denormals0, denormals1, denormals2, denormals3, denormals4, denormals5, denormals6;
+
+    const __m128 tmp0 = RoundToFloat16SSE2(
+        _mm_mul_ps(_mm_add_ps(Float16ToFloat32SSE2(src0, &denormals0),
+                              Float16ToFloat32SSE2(src1, &denormals1)),
+                   half),
+        &denormals4);
+    const __m128 tmp1 = RoundToFloat16SSE2(
+        _mm_mul_ps(_mm_add_ps(Float16ToFloat32SSE2(src2, &denormals2),
+                              Float16ToFloat32SSE2(src3, &denormals3)),
+                   half),
+        &denormals5);
+    const __m128i result = Float32ToFloat16SSE2(
+        _mm_castps_si128(_mm_mul_ps(_mm_add_ps(tmp0, tmp1), half)), &denormals6);
+
+    *denormalsOut = _mm_or_si128(
+        _mm_or_si128(_mm_or_si128(denormals0, denormals1), _mm_or_si128(denormals2, denormals3)),
+        _mm_or_si128(_mm_or_si128(denormals4, denormals5), denormals6));
+    return result;
+}
+
+// Generates pixels [begin, end) of a RGBA16F mip row like GenerateMip_XY.
+void GenerateRGBA16FPixels(const uint8_t *sourceRow0,
+                           const uint8_t *sourceRow1,
+                           uint8_t *destRow,
+                           size_t begin,
+                           size_t end)
+{
+    const uint16_t *src0 = reinterpret_cast<const uint16_t *>(sourceRow0);
+    const uint16_t *src1 = reinterpret_cast<const uint16_t *>(sourceRow1);
+    uint16_t *dst        = reinterpret_cast<uint16_t *>(destRow);
+
+    for (size_t x = begin; x < end; x++)
+    {
+        for (size_t channel = 0; channel < 4; channel++)
+        {
+            const size_t even = x * 8 + channel;
+            const size_t odd  = even + 4;
+
+            const uint16_t tmp0  = gl::averageHalfFloat(src0[even], src1[even]);
+            const uint16_t tmp1  = gl::averageHalfFloat(src0[odd], src1[odd]);
+            dst[x * 4 + channel] = gl::averageHalfFloat(tmp0, tmp1);
+        }
+    }
+}
+#endif  // defined(ANGLE_IMAGE_UTIL_USE_SSE2)
+
+template <size_t pixelBytes>
+size_t GenerateMipRowXYUnorm8Impl(const uint8_t *sourceRow0,
+                                  const uint8_t *sourceRow1,
+                                  uint8_t *destRow,
+                                  size_t destWidth,
+                                  bool opaqueAlpha)
+{
+    // Every iteration generates 16 bytes of the destination from 32 bytes of each source row.
+    constexpr size_t kPixelsPerIteration = 16 / pixelBytes;
+
+    size_t x = 0;
+#if defined(ANGLE_IMAGE_UTIL_USE_SSE2)
+    if (supportsSSE2())
+    {
+        const __m128i alpha = opaqueAlpha ? _mm_set1_epi32(static_cast<int>(0xFF000000))
+                                          : _mm_setzero_si128();
+        for (; x + kPixelsPerIteration <= destWidth; x += kPixelsPerIteration)
+        {
+            const size_t sourceOffset = 2 * x * pixelBytes;
+
+            const __m128i *src0 = reinterpret_cast<const __m128i *>(sourceRow0 + sourceOffset);
+            const __m128i *src1 = reinterpret_cast<const __m128i *>(sourceRow1 + sourceOffset);
+
+            // Average vertically first, then horizontally, like GenerateMip_XY.
+            const __m128i first =
+                AverageUnorm8SSE2(_mm_loadu_si128(src0 + 0), _mm_loadu_si128(src1 + 0));
+            const __m128i second =
+                AverageUnorm8SSE2(_mm_loadu_si128(src0 + 1), _mm_loadu_si128(src1 + 1));
+
+            __m128i even, odd;
+            DeinterleavePixelsSSE2<pixelBytes>(first, second, &even, &odd);
+
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(destRow + x * pixelBytes),
+                             _mm_or_si128(AverageUnorm8SSE2(even, odd), alpha));
+        }
+    }
+#elif defined(ANGLE_IMAGE_UTIL_USE_NEON)
+    const uint8x16_t alpha = vreinterpretq_u8_u32(vdupq_n_u32(opaqueAlpha ? 0xFF000000u : 0u));
+    for (; x + kPixelsPerIteration <= destWidth; x += kPixelsPerIteration)
+    {
+        const uint8_t *src0 = sourceRow0 + 2 * x * pixelBytes;
+        const uint8_t *src1 = sourceRow1 + 2 * x * pixelBytes;
+
+        // vhaddq_u8 rounds down like gl::average.
+        const uint8x16_t first  = vhaddq_u8(vld1q_u8(src0), vld1q_u8(src1));
+        const uint8x16_t second = vhaddq_u8(vld1q_u8(src0 + 16), vld1q_u8(src1 + 16));
+
+        uint8x16_t even, odd;
+        switch (pixelBytes)
+        {
+            case 1:
+            {
+                const uint8x16x2_t pixels = vuzpq_u8(first, second);
+                even                      = pixels.val[0];
+                odd                       = pixels.val[1];
+                break;
+            }
+            case 2:
+            {
+                const uint16x8x2_t pixels =
+                    vuzpq_u16(vreinterpretq_u16_u8(first), vreinterpretq_u16_u8(second));
+                even = vreinterpretq_u8_u16(pixels.val[0]);
+                odd  = vreinterpretq_u8_u16(pixels.val[1]);
+                break;
+            }
+            default:
+            {
+                const uint32x4x2_t pixels =
+                    vuzpq_u32(vreinterpretq_u32_u8(first), vreinterpretq_u32_u8(second));
+                even = vreinterpretq_u8_u32(pixels.val[0]);
+                odd  = vreinterpretq_u8_u32(pixels.val[1]);
+                break;
+            }
+        }
+
+        vst1q_u8(destRow + x * pixelBytes, vorrq_u8(vhaddq_u8(even, odd), alpha));
+    }
+#endif
+    return x;
+}
+}  // anonymous namespace
+
+size_t GenerateMipRowXYUnorm8(const uint8_t *sourceRow0,
+                              const uint8_t *sourceRow1,
+                              uint8_t *destRow,
+                              size_t destWidth,
+                              size_t pixelBytes,
+                              bool opaqueAlpha)
+{
+    ASSERT(!opaqueAlpha || pixelBytes == 4);
+    switch (pixelBytes)
+    {
+        case 1:
+            return GenerateMipRowXYUnorm8Impl<1>(sourceRow0, sourceRow1, destRow, destWidth,
+                                                 opaqueAlpha);
+        case 2:
+            return GenerateMipRowXYUnorm8Impl<2>(sourceRow0, sourceRow1, destRow, destWidth,
+                                                 opaqueAlpha);
+        case 4:
+            return GenerateMipRowXYUnorm8Impl<4>(sourceRow0, sourceRow1, destRow, destWidth,
+                                                 opaqueAlpha);
+        default:
+            UNREACHABLE();
+            return 0;
+    }
+}
+
+size_t GenerateMipRowXYRGBA16F(const uint8_t *sourceRow0,
+                               const uint8_t *sourceRow1,
+                               uint8_t *destRow,
+                               size_t destWidth)
+{
+    size_t x = 0;
+#if defined(ANGLE_IMAGE_UTIL_USE_SSE2)
+    if (supportsSSE2())
+    {
+        const __m128i zero = _mm_setzero_si128();
+
+        // Every iteration generates two pixels from the four pixels of each source row they cover.
+        for (; x + 2 <= destWidth; x += 2)
+        {
+            const __m128i *src0 = reinterpret_cast<const __m128i *>(sourceRow0 + x * 16);
+            const __m128i *src1 = reinterpret_cast<const __m128i *>(sourceRow1 + x * 16);
+            const __m128i row0a = _mm_loadu_si128(src0 + 0);
+            const __m128i row0b = _mm_loadu_si128(src0 + 1);
+            const __m128i row1a = _mm_loadu_si128(src1 + 0);
+            const __m128i row1b = _mm_loadu_si128(src1 + 1);
+
+            __m128i denormalsA, denormalsB;
+            const __m128i pixelA = GenerateRGBA16FPixelSSE2(
+                _mm_unpacklo_epi16(row0a, zero), _mm_unpacklo_epi16(row1a, zero),
+                _mm_unpackhi_epi16(row0a, zero), _mm_unpackhi_epi16(row1a, zero), &denormalsA);
+            const __m128i pixelB = GenerateRGBA16FPixelSSE2(
+                _mm_unpacklo_epi16(row0b, zero), _mm_unpacklo_epi16(row1b, zero),
+                _mm_unpackhi_epi16(row0b, zero), _mm_unpackhi_epi16(row1b, zero), &denormalsB);
+
+            // Denormal half floats are rare, generate these pixels without SIMD.
+            if (_mm_movemask_epi8(_mm_or_si128(denormalsA, denormalsB)) != 0)
+            {
+                GenerateRGBA16FPixels(sourceRow0, sourceRow1, destRow, x, x + 2);
+                continue;
+            }
+
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(destRow + x * 8),
+                             _mm_packs_epi32(pixelA, pixelB));
+        }
+    }
+#endif
+    return x;
+}
+}  // namespace priv
+}  // namespace angle
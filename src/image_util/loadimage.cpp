@@ -11,50 +11,208 @@
 #include "common/mathutil.h"
 #include "common/platform.h"
 #include "image_util/imageformats.h"
+#include "image_util/simdutils.h"
 
-#if defined(ANGLE_PLATFORM_WINDOWS) && !defined(_M_ARM) && !defined(_M_ARM64)
-#    if defined(_MSC_VER)
-#        include <intrin.h>
-#        define ANGLE_LOADIMAGE_USE_SSE
-#    elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
-#        include <x86intrin.h>
-#        if __SSE__
-#            define ANGLE_LOADIMAGE_USE_SSE
-#        endif
-#    endif
-#endif
+namespace angle
+{
+ImageLoadContext::ImageLoadContext()                              = default;
+ImageLoadContext::~ImageLoadContext()                             = default;
+ImageLoadContext::ImageLoadContext(const ImageLoadContext &other) = default;
 
-#if defined(ANGLE_LOADIMAGE_USE_SSE)
-inline bool supportsSSE2()
+namespace
 {
-    static bool checked  = false;
-    static bool supports = false;
+// The *RowSIMD functions convert as many pixels from the start of a row as they can with SIMD
+// instructions, and return how many they converted.  The callers convert the rest of the row.
 
-    if (checked)
+size_t LoadL8ToRGBA8RowSIMD(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    size_t x = 0;
+#if defined(ANGLE_IMAGE_UTIL_USE_SSE2)
+    if (supportsSSE2())
     {
-        return supports;
+        const __m128i alpha = _mm_set1_epi8(static_cast<char>(0xFF));
+        for (; x + 15 < width; x += 16)
+        {
+            const __m128i l = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[x]));
+            // LL and LA byte pairs, which interleave to LLLA.
+            const __m128i llLo = _mm_unpacklo_epi8(l, l);
+            const __m128i llHi = _mm_unpackhi_epi8(l, l);
+            const __m128i laLo = _mm_unpacklo_epi8(l, alpha);
+            const __m128i laHi = _mm_unpackhi_epi8(l, alpha);
+
+            __m128i *out = reinterpret_cast<__m128i *>(&dest[4 * x]);
+            _mm_storeu_si128(out + 0, _mm_unpacklo_epi16(llLo, laLo));
+            _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(llLo, laLo));
+            _mm_storeu_si128(out + 2, _mm_unpacklo_epi16(llHi, laHi));
+            _mm_storeu_si128(out + 3, _mm_unpackhi_epi16(llHi, laHi));
+        }
     }
+#endif
+    return x;
+}
 
-    int info[4];
-    __cpuid(info, 0);
-
-    if (info[0] >= 1)
+size_t LoadLA8ToRGBA8RowSIMD(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    size_t x = 0;
+#if defined(ANGLE_IMAGE_UTIL_USE_SSE2)
+    if (supportsSSE2())
     {
-        __cpuid(info, 1);
+        const __m128i lowByte = _mm_set1_epi16(0x00FF);
+        for (; x + 7 < width; x += 8)
+        {
+            const __m128i la = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[2 * x]));
+            const __m128i l  = _mm_and_si128(la, lowByte);
+            const __m128i ll = _mm_or_si128(l, _mm_slli_epi16(l, 8));
 
-        supports = (info[3] >> 26) & 1;
+            __m128i *out = reinterpret_cast<__m128i *>(&dest[4 * x]);
+            _mm_storeu_si128(out + 0, _mm_unpacklo_epi16(ll, la));
+            _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(ll, la));
+        }
     }
+#endif
+    return x;
+}
 
-    checked = true;
-    return supports;
+#if defined(ANGLE_IMAGE_UTIL_USE_SSE2)
+// Writes 8 pixels, given the first two and the last two channels of each in 16-bit lanes.
+inline void StoreRGBA8PixelsSSE2(uint8_t *dest, __m128i firstChannels, __m128i lastChannels)
+{
+    __m128i *out = reinterpret_cast<__m128i *>(dest);
+    _mm_storeu_si128(out + 0, _mm_unpacklo_epi16(firstChannels, lastChannels));
+    _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(firstChannels, lastChannels));
+}
+
+// Expands 5- or 6-bit channels in 16-bit lanes to 8 bits by replicating the top bits.
+template <int bits>
+inline __m128i Expand16BitLanesTo8BitsSSE2(__m128i channel)
+{
+    return _mm_or_si128(_mm_slli_epi16(channel, 8 - bits), _mm_srli_epi16(channel, 2 * bits - 8));
 }
 #endif
 
-namespace angle
+template <bool swapRB>
+size_t LoadR5G6B5ToRGBA8RowSIMD(const uint16_t *source, uint8_t *dest, size_t width)
 {
-ImageLoadContext::ImageLoadContext()                              = default;
-ImageLoadContext::~ImageLoadContext()                             = default;
-ImageLoadContext::ImageLoadContext(const ImageLoadContext &other) = default;
+    size_t x = 0;
+#if defined(ANGLE_IMAGE_UTIL_USE_SSE2)
+    if (supportsSSE2())
+    {
+        const __m128i mask5 = _mm_set1_epi16(0x1F);
+        const __m128i mask6 = _mm_set1_epi16(0x3F);
+        const __m128i alpha = _mm_set1_epi16(static_cast<short>(0xFF00));
+        for (; x + 7 < width; x += 8)
+        {
+            const __m128i rgb = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[x]));
+            const __m128i r   = Expand16BitLanesTo8BitsSSE2<5>(_mm_srli_epi16(rgb, 11));
+            const __m128i g =
+                Expand16BitLanesTo8BitsSSE2<6>(_mm_and_si128(_mm_srli_epi16(rgb, 5), mask6));
+            const __m128i b = Expand16BitLanesTo8BitsSSE2<5>(_mm_and_si128(rgb, mask5));
+
+            const __m128i first = swapRB ? b : r;
+            const __m128i third = swapRB ? r : b;
+            StoreRGBA8PixelsSSE2(&dest[4 * x], _mm_or_si128(first, _mm_slli_epi16(g, 8)),
+                                 _mm_or_si128(third, alpha));
+        }
+    }
+#endif
+    return x;
+}
+
+size_t LoadRGBA4ToRGBA8RowSIMD(const uint16_t *source, uint8_t *dest, size_t width)
+{
+    size_t x = 0;
+#if defined(ANGLE_IMAGE_UTIL_USE_SSE2)
+    if (supportsSSE2())
+    {
+        const __m128i mask4 = _mm_set1_epi16(0xF);
+        // Multiplying a 4-bit value by 0x11 replicates it in both nibbles of a byte.
+        const __m128i replicateLow  = _mm_set1_epi16(0x0011);
+        const __m128i replicateHigh = _mm_set1_epi16(0x1100);
+        for (; x + 7 < width; x += 8)
+        {
+            const __m128i rgba = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[x]));
+            const __m128i r    = _mm_srli_epi16(rgba, 12);
+            const __m128i g    = _mm_and_si128(_mm_srli_epi16(rgba, 8), mask4);
+            const __m128i b    = _mm_and_si128(_mm_srli_epi16(rgba, 4), mask4);
+            const __m128i a    = _mm_and_si128(rgba, mask4);
+
+            StoreRGBA8PixelsSSE2(&dest[4 * x],
+                                 _mm_or_si128(_mm_mullo_epi16(r, replicateLow),
+                                              _mm_mullo_epi16(g, replicateHigh)),
+                                 _mm_or_si128(_mm_mullo_epi16(b, replicateLow),
+                                              _mm_mullo_epi16(a, replicateHigh)));
+        }
+    }
+#endif
+    return x;
+}
+
+size_t LoadRGB5A1ToRGBA8RowSIMD(const uint16_t *source, uint8_t *dest, size_t width)
+{
+    size_t x = 0;
+#if defined(ANGLE_IMAGE_UTIL_USE_SSE2)
+    if (supportsSSE2())
+    {
+        const __m128i mask5    = _mm_set1_epi16(0x1F);
+        const __m128i alphaBit = _mm_set1_epi16(0x1);
+        const __m128i highByte = _mm_set1_epi16(static_cast<short>(0xFF00));
+        const __m128i zero     = _mm_setzero_si128();
+        for (; x + 7 < width; x += 8)
+        {
+            const __m128i rgba = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[x]));
+            const __m128i r    = Expand16BitLanesTo8BitsSSE2<5>(_mm_srli_epi16(rgba, 11));
+            const __m128i g =
+                Expand16BitLanesTo8BitsSSE2<5>(_mm_and_si128(_mm_srli_epi16(rgba, 6), mask5));
+            const __m128i b =
+                Expand16BitLanesTo8BitsSSE2<5>(_mm_and_si128(_mm_srli_epi16(rgba, 1), mask5));
+            // 0 - 1 sets all bits of the lane.
+            const __m128i a = _mm_sub_epi16(zero, _mm_and_si128(rgba, alphaBit));
+
+            StoreRGBA8PixelsSSE2(&dest[4 * x], _mm_or_si128(r, _mm_slli_epi16(g, 8)),
+                                 _mm_or_si128(b, _mm_and_si128(a, highByte)));
+        }
+    }
+#endif
+    return x;
+}
+}  // anonymous namespace
+
+namespace priv
+{
+
+void Float32ToFloat16Row(const float *source, uint16_t *dest, size_t count)
+{
+    size_t x = 0;
+#if defined(ANGLE_IMAGE_UTIL_USE_SSE2)
+    if (supportsSSE2())
+    {
+        for (; x + 7 < count; x += 8)
+        {
+            const __m128i *in = reinterpret_cast<const __m128i *>(&source[x]);
+            __m128i denormalsLo, denormalsHi;
+            const __m128i lo = Float32ToFloat16SSE2(_mm_loadu_si128(in + 0), &denormalsLo);
+            const __m128i hi = Float32ToFloat16SSE2(_mm_loadu_si128(in + 1), &denormalsHi);
+
+            if (_mm_movemask_epi8(_mm_or_si128(denormalsLo, denormalsHi)) != 0)
+            {
+                for (size_t i = x; i < x + 8; i++)
+                {
+                    dest[i] = gl::float32ToFloat16(source[i]);
+                }
+                continue;
+            }
+
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[x]), _mm_packs_epi32(lo, hi));
+        }
+    }
+#endif
+
+    for (; x < count; x++)
+    {
+        dest[x] = gl::float32ToFloat16(source[x]);
+    }
+}
+}  // namespace priv
 
 void LoadA8ToRGBA8(const ImageLoadContext &context,
                    size_t width,
@@ -67,7 +225,7 @@ void LoadA8ToRGBA8(const ImageLoadContext &context,
                    size_t outputRowPitch,
                    size_t outputDepthPitch)
 {
-#if defined(ANGLE_LOADIMAGE_USE_SSE)
+#if defined(ANGLE_IMAGE_UTIL_USE_SSE2)
     if (supportsSSE2())
     {
         __m128i zeroWide = _mm_setzero_si128();
@@ -226,7 +384,7 @@ void LoadL8ToRGBA8(const ImageLoadContext &context,
                 priv::OffsetDataPointer<uint8_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint8_t *dest =
                 priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = LoadL8ToRGBA8RowSIMD(source, dest, width); x < width; x++)
             {
                 uint8_t sourceVal = source[x];
                 dest[4 * x + 0]   = sourceVal;
@@ -333,7 +491,7 @@ void LoadLA8ToRGBA8(const ImageLoadContext &context,
                 priv::OffsetDataPointer<uint8_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint8_t *dest =
                 priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = LoadLA8ToRGBA8RowSIMD(source, dest, width); x < width; x++)
             {
                 dest[4 * x + 0] = source[2 * x + 0];
                 dest[4 * x + 1] = source[2 * x + 0];
@@ -595,7 +753,8 @@ void LoadR5G6B5ToBGRA8(const ImageLoadContext &context,
                 priv::OffsetDataPointer<uint16_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint8_t *dest =
                 priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = LoadR5G6B5ToRGBA8RowSIMD<true>(source, dest, width); x < width;
+                 x++)
             {
                 uint16_t rgb = source[x];
                 dest[4 * x + 0] =
@@ -629,7 +788,8 @@ void LoadR5G6B5ToRGBA8(const ImageLoadContext &context,
                 priv::OffsetDataPointer<uint16_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint8_t *dest =
                 priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = LoadR5G6B5ToRGBA8RowSIMD<false>(source, dest, width); x < width;
+                 x++)
             {
                 uint16_t rgb = source[x];
                 dest[4 * x + 0] =
@@ -655,7 +815,7 @@ void LoadRGBA8ToBGRA8(const ImageLoadContext &context,
                       size_t outputRowPitch,
                       size_t outputDepthPitch)
 {
-#if defined(ANGLE_LOADIMAGE_USE_SSE)
+#if defined(ANGLE_IMAGE_UTIL_USE_SSE2)
     if (supportsSSE2())
     {
         __m128i brMask = _mm_set1_epi32(0x00ff00ff);
@@ -869,7 +1029,7 @@ void LoadRGBA4ToRGBA8(const ImageLoadContext &context,
                 priv::OffsetDataPointer<uint16_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint8_t *dest =
                 priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = LoadRGBA4ToRGBA8RowSIMD(source, dest, width); x < width; x++)
             {
                 uint16_t rgba = source[x];
                 dest[4 * x + 0] =
@@ -1164,7 +1324,7 @@ void LoadRGB5A1ToRGBA8(const ImageLoadContext &context,
                 priv::OffsetDataPointer<uint16_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint8_t *dest =
                 priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = LoadRGB5A1ToRGBA8RowSIMD(source, dest, width); x < width; x++)
             {
                 uint16_t rgba = source[x];
                 dest[4 * x + 0] =
@@ -1779,12 +1939,7 @@ void LoadRGB32FToRGB16F(const ImageLoadContext &context,
                 priv::OffsetDataPointer<float>(input, y, z, inputRowPitch, inputDepthPitch);
             uint16_t *dest =
                 priv::OffsetDataPointer<uint16_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
-            {
-                dest[x * 3 + 0] = gl::float32ToFloat16(source[x * 3 + 0]);
-                dest[x * 3 + 1] = gl::float32ToFloat16(source[x * 3 + 1]);
-                dest[x * 3 + 2] = gl::float32ToFloat16(source[x * 3 + 2]);
-            }
+            priv::Float32ToFloat16Row(source, dest, width * 3);
         }
     }
 }
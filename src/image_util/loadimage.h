@@ -1153,6 +1153,12 @@ inline void LoadPalettedToRGBA8(const ImageLoadContext &context,
                                 size_t outputRowPitch,
                                 size_t outputDepthPitch);
 
+namespace priv
+{
+// Converts |count| contiguous floats to half floats, vectorized where possible.
+void Float32ToFloat16Row(const float *source, uint16_t *dest, size_t count);
+}  // namespace priv
+
 }  // namespace angle
 
 #include "loadimage.inc"
@@ -42,12 +42,23 @@ void LoadASTCToRGBA8Inner(const ImageLoadContext &context,
     // Space needed for 16 bytes of output per compressed block
     size_t blockSize = blockCountX * blockCountY * 16;
 
-    int32_t result =
-        decompressor.decompress(context.singleThreadPool, context.multiThreadPool, imgWidth,
-                                imgHeight, blockWidth, blockHeight, input, blockSize, output);
-    if (result != 0)
+    // The slices are decompressed in one call if their blocks are contiguous, so the threads share
+    // the blocks of all of them.
+    const bool contiguousSlices = depth == 1 || inputDepthPitch == blockSize;
+    const size_t sliceCount     = contiguousSlices ? 1 : depth;
+    const auto imgDepth         = static_cast<uint32_t>(contiguousSlices ? depth : 1);
+
+    for (size_t slice = 0; slice < sliceCount; ++slice)
     {
-        WARN() << "ASTC decompression failed: " << decompressor.getStatusString(result);
+        int32_t result = decompressor.decompress(
+            context.singleThreadPool, context.multiThreadPool, imgWidth, imgHeight, imgDepth,
+            blockWidth, blockHeight, input + slice * inputDepthPitch, blockSize * imgDepth,
+            output + slice * outputDepthPitch, outputRowPitch, outputDepthPitch);
+        if (result != 0)
+        {
+            WARN() << "ASTC decompression failed: " << decompressor.getStatusString(result);
+            return;
+        }
     }
 }
 }  // namespace angle
@@ -0,0 +1,117 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// simdutils.h: SIMD helpers shared by the image loading and mip generation functions.
+
+#ifndef IMAGEUTIL_SIMDUTILS_H_
+#define IMAGEUTIL_SIMDUTILS_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+// SSE2 is part of the baseline on x64, and enabled by default by compilers targeting 32-bit x86.
+// Only 32-bit MSVC builds with /arch:IA32 need to check for it at runtime.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    include <emmintrin.h>
+#    define ANGLE_IMAGE_UTIL_USE_SSE2
+#elif defined(_MSC_VER) && defined(_M_IX86)
+#    include <intrin.h>
+#    define ANGLE_IMAGE_UTIL_USE_SSE2
+#    define ANGLE_IMAGE_UTIL_CHECK_SSE2
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#    include <arm_neon.h>
+#    define ANGLE_IMAGE_UTIL_USE_NEON
+#endif
+
+namespace angle
+{
+#if defined(ANGLE_IMAGE_UTIL_USE_SSE2)
+inline bool supportsSSE2()
+{
+#    if defined(ANGLE_IMAGE_UTIL_CHECK_SSE2)
+    static const bool supports = []() {
+        int info[4];
+        __cpuid(info, 0);
+
+        if (info[0] < 1)
+        {
+            return false;
+        }
+
+        __cpuid(info, 1);
+        return ((info[3] >> 26) & 1) != 0;
+    }();
+    return supports;
+#    else
+    return true;
+#    endif
+}
+
+namespace priv
+{
+// Averages unsigned bytes rounding down, like gl::average.
+inline __m128i AverageUnorm8SSE2(__m128i a, __m128i b)
+{
+    const __m128i halfDifference =
+        _mm_and_si128(_mm_srli_epi16(_mm_xor_si128(a, b), 1), _mm_set1_epi8(0x7F));
+    return _mm_add_epi8(_mm_and_si128(a, b), halfDifference);
+}
+
+// Converts 4 floats with the same results as gl::float32ToFloat16, except for values that become
+// denormal half floats.  Those lanes are flagged in |denormalsOut| and the caller converts them.
+inline __m128i Float32ToFloat16SSE2(__m128i fp32, __m128i *denormalsOut)
+{
+    const __m128i abs  = _mm_and_si128(fp32, _mm_set1_epi32(0x7FFFFFFF));
+    const __m128i sign = _mm_and_si128(_mm_srli_epi32(fp32, 16), _mm_set1_epi32(0x8000));
+
+    // Rebias the exponent and round to nearest even.
+    const __m128i roundBit = _mm_and_si128(_mm_srli_epi32(abs, 13), _mm_set1_epi32(1));
+    __m128i result         = _mm_srli_epi32(
+        _mm_add_epi32(_mm_add_epi32(abs, _mm_set1_epi32(static_cast<int>(0xC8000FFF))), roundBit),
+        13);
+
+    const __m128i isZero     = _mm_cmplt_epi32(abs, _mm_set1_epi32(0x2D000000));
+    const __m128i isInfinity = _mm_cmpgt_epi32(abs, _mm_set1_epi32(0x47FFEFFF));
+    const __m128i isNaN      = _mm_cmpgt_epi32(abs, _mm_set1_epi32(0x7F800000));
+    *denormalsOut = _mm_andnot_si128(isZero, _mm_cmplt_epi32(abs, _mm_set1_epi32(0x38800000)));
+
+    result = _mm_andnot_si128(isZero, result);
+    result = _mm_or_si128(_mm_andnot_si128(isInfinity, result),
+                          _mm_and_si128(isInfinity, _mm_set1_epi32(0x7C00)));
+    result = _mm_or_si128(result, sign);
+    result = _mm_or_si128(_mm_andnot_si128(isNaN, result),
+                          _mm_and_si128(isNaN, _mm_set1_epi32(0x7FFF)));
+
+    // Sign extend the low 16 bits so the saturating pack below keeps them as they are.
+    return _mm_srai_epi32(_mm_slli_epi32(result, 16), 16);
+}
+// Converts the half floats in the low 16 bits of each lane to floats, with the same results as
+// gl::float16ToFloat32.  Lanes with denormal half floats are flagged in |denormalsOut|, as they
+// are flushed to zero when denormals-are-zero is enabled.
+inline __m128 Float16ToFloat32SSE2(__m128i fp16, __m128i *denormalsOut)
+{
+    const __m128i magnitude = _mm_slli_epi32(_mm_and_si128(fp16, _mm_set1_epi32(0x7FFF)), 13);
+    const __m128i sign      = _mm_slli_epi32(_mm_and_si128(fp16, _mm_set1_epi32(0x8000)), 16);
+
+    // Rebias the exponent by multiplying with 2^112.
+    __m128 result = _mm_mul_ps(_mm_castsi128_ps(magnitude),
+                               _mm_castsi128_ps(_mm_set1_epi32(0x77800000)));
+
+    // Infinity and NaN keep the maximum exponent.
+    const __m128i isInfinityOrNaN = _mm_cmpgt_epi32(magnitude, _mm_set1_epi32(0x0F7FFFFF));
+    result = _mm_or_ps(result, _mm_castsi128_ps(_mm_and_si128(isInfinityOrNaN,
+                                                              _mm_set1_epi32(0x7F800000))));
+
+    *denormalsOut = _mm_andnot_si128(_mm_cmpeq_epi32(magnitude, _mm_setzero_si128()),
+                                     _mm_cmplt_epi32(magnitude, _mm_set1_epi32(0x00800000)));
+
+    return _mm_or_ps(result, _mm_castsi128_ps(sign));
+}
+}  // namespace priv
+#endif  // defined(ANGLE_IMAGE_UTIL_USE_SSE2)
+}  // namespace angle
+
+#endif  // IMAGEUTIL_SIMDUTILS_H_
@@ -12,20 +12,97 @@
 #include "common/debug.h"
 #include "libANGLE/formatutils.h"
 
+#include <algorithm>
+#include <limits>
+
 namespace gl
 {
 
-IndexRangeCache::IndexRangeCache() {}
+namespace
+{
+size_t HashKey(DrawElementsType type, size_t offset, size_t count, bool primitiveRestartEnabled)
+{
+    // Offsets and counts are often multiples of large powers of two, so mix all the bits down.
+    uint64_t hash = static_cast<uint64_t>(offset) * 0x9E3779B97F4A7C15ull;
+    hash ^= (static_cast<uint64_t>(count) << 3 | static_cast<uint64_t>(type) << 1 |
+             static_cast<uint64_t>(primitiveRestartEnabled)) *
+            0xC2B2AE3D27D4EB4Full;
+    hash ^= hash >> 32;
+    hash ^= hash >> 16;
+    return static_cast<size_t>(hash);
+}
+}  // anonymous namespace
+
+IndexRangeCache::IndexRangeCache()
+    : mGeneration(1), mCachedStart(std::numeric_limits<size_t>::max()), mCachedEnd(0)
+{}
 
 IndexRangeCache::~IndexRangeCache() {}
 
+size_t IndexRangeCache::findEntry(DrawElementsType type,
+                                  size_t offset,
+                                  size_t count,
+                                  bool primitiveRestartEnabled) const
+{
+    if (!mEntries)
+    {
+        return kEntryCount;
+    }
+
+    const size_t home = HashKey(type, offset, count, primitiveRestartEnabled);
+    for (size_t probe = 0; probe < kMaxProbes; ++probe)
+    {
+        const size_t index = (home + probe) % kEntryCount;
+        const Entry &entry = (*mEntries)[index];
+        if (isValid(entry) && entry.type == type && entry.offset == offset &&
+            entry.count == count && entry.primitiveRestartEnabled == primitiveRestartEnabled)
+        {
+            return index;
+        }
+    }
+    return kEntryCount;
+}
+
 void IndexRangeCache::addRange(DrawElementsType type,
                                size_t offset,
                                size_t count,
                                bool primitiveRestartEnabled,
                                const IndexRange &range)
 {
-    mIndexRangeCache[IndexRangeKey(type, offset, count, primitiveRestartEnabled)] = range;
+    if (!mEntries)
+    {
+        mEntries = std::make_unique<EntryArray>();
+    }
+
+    const size_t home = HashKey(type, offset, count, primitiveRestartEnabled);
+
+    // Take the existing entry for this key, or the first free one.  If there is neither, the home
+    // entry is evicted.
+    size_t index = findEntry(type, offset, count, primitiveRestartEnabled);
+    if (index == kEntryCount)
+    {
+        index = home % kEntryCount;
+        for (size_t probe = 0; probe < kMaxProbes; ++probe)
+        {
+            const size_t candidate = (home + probe) % kEntryCount;
+            if (!isValid((*mEntries)[candidate]))
+            {
+                index = candidate;
+                break;
+            }
+        }
+    }
+
+    Entry &entry                  = (*mEntries)[index];
+    entry.generation              = mGeneration;
+    entry.type                    = type;
+    entry.primitiveRestartEnabled = primitiveRestartEnabled;
+    entry.offset                  = offset;
+    entry.count                   = count;
+    entry.range                   = range;
+
+    mCachedStart = std::min(mCachedStart, offset);
+    mCachedEnd   = std::max(mCachedEnd, offset + GetDrawElementsTypeSize(type) * count);
 }
 
 bool IndexRangeCache::findRange(DrawElementsType type,
@@ -34,12 +111,12 @@ bool IndexRangeCache::findRange(DrawElementsType type,
                                 bool primitiveRestartEnabled,
                                 IndexRange *outRange) const
 {
-    auto i = mIndexRangeCache.find(IndexRangeKey(type, offset, count, primitiveRestartEnabled));
-    if (i != mIndexRangeCache.end())
+    const size_t index = findEntry(type, offset, count, primitiveRestartEnabled);
+    if (index != kEntryCount)
     {
         if (outRange)
         {
-            *outRange = i->second;
+            *outRange = (*mEntries)[index].range;
         }
         return true;
     }
@@ -55,62 +132,59 @@ bool IndexRangeCache::findRange(DrawElementsType type,
 
 void IndexRangeCache::invalidateRange(size_t offset, size_t size)
 {
+    if (!mEntries)
+    {
+        return;
+    }
+
     size_t invalidateStart = offset;
     size_t invalidateEnd   = offset + size;
 
-    auto i = mIndexRangeCache.begin();
-    while (i != mIndexRangeCache.end())
+    // Most updates of dynamic index buffers don't touch the parts that have been drawn from.
+    if (invalidateEnd < mCachedStart || invalidateStart > mCachedEnd)
     {
-        size_t rangeStart = i->first.offset;
-        size_t rangeEnd =
-            i->first.offset + (GetDrawElementsTypeSize(i->first.type) * i->first.count);
+        return;
+    }
+
+    // If the update covers everything that is cached, drop all entries at once.
+    if (invalidateStart <= mCachedStart && invalidateEnd >= mCachedEnd)
+    {
+        clear();
+        return;
+    }
 
-        if (invalidateEnd < rangeStart || invalidateStart > rangeEnd)
+    for (Entry &entry : *mEntries)
+    {
+        if (!isValid(entry))
         {
-            ++i;
+            continue;
         }
-        else
+
+        size_t rangeStart = entry.offset;
+        size_t rangeEnd   = entry.offset + (GetDrawElementsTypeSize(entry.type) * entry.count);
+
+        if (!(invalidateEnd < rangeStart || invalidateStart > rangeEnd))
         {
-            mIndexRangeCache.erase(i++);
+            entry.generation = 0;
         }
     }
 }
 
 void IndexRangeCache::clear()
 {
-    mIndexRangeCache.clear();
-}
-
-IndexRangeCache::IndexRangeKey::IndexRangeKey()
-    : IndexRangeCache::IndexRangeKey(DrawElementsType::InvalidEnum, 0, 0, false)
-{}
-
-IndexRangeCache::IndexRangeKey::IndexRangeKey(DrawElementsType type_,
-                                              size_t offset_,
-                                              size_t count_,
-                                              bool primitiveRestartEnabled_)
-    : type(type_), offset(offset_), count(count_), primitiveRestartEnabled(primitiveRestartEnabled_)
-{}
-
-bool IndexRangeCache::IndexRangeKey::operator<(const IndexRangeKey &rhs) const
-{
-    if (type != rhs.type)
+    ++mGeneration;
+    // Generation 0 marks invalid entries, so it can't be used when the counter wraps around.
+    if (mGeneration == 0)
     {
-        return type < rhs.type;
-    }
-    if (offset != rhs.offset)
-    {
-        return offset < rhs.offset;
-    }
-    if (count != rhs.count)
-    {
-        return count < rhs.count;
-    }
-    if (primitiveRestartEnabled != rhs.primitiveRestartEnabled)
-    {
-        return primitiveRestartEnabled;
+        if (mEntries)
+        {
+            mEntries->fill(Entry());
+        }
+        mGeneration = 1;
     }
-    return false;
+
+    mCachedStart = std::numeric_limits<size_t>::max();
+    mCachedEnd   = 0;
 }
 
 }  // namespace gl
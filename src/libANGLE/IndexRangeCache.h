@@ -15,12 +15,18 @@
 #include "common/angleutils.h"
 #include "common/mathutil.h"
 
-#include <map>
+#include <array>
+#include <memory>
 
 namespace gl
 {
 
-class IndexRangeCache
+// A small, fixed-size cache of the index ranges computed for a buffer.  Index buffers are usually
+// drawn with a handful of (type, offset, count) combinations, so a flat table that evicts on
+// collision is enough.  The table is allocated the first time a range is added, so that buffers
+// that are never used for indices don't pay for it; after that, neither lookups nor updates
+// allocate.
+class IndexRangeCache final : angle::NonCopyable
 {
   public:
     IndexRangeCache();
@@ -41,21 +47,36 @@ class IndexRangeCache
     void clear();
 
   private:
-    struct IndexRangeKey
+    static constexpr size_t kEntryCount = 16;
+    static constexpr size_t kMaxProbes  = 4;
+
+    struct Entry
     {
-        IndexRangeKey();
-        IndexRangeKey(DrawElementsType type, size_t offset, size_t count, bool primitiveRestart);
+        // The entry is valid only if this matches mGeneration.
+        uint32_t generation          = 0;
+        DrawElementsType type        = DrawElementsType::InvalidEnum;
+        bool primitiveRestartEnabled = false;
+        size_t offset                = 0;
+        size_t count                 = 0;
+        IndexRange range;
+    };
 
-        bool operator<(const IndexRangeKey &rhs) const;
+    bool isValid(const Entry &entry) const { return entry.generation == mGeneration; }
+    size_t findEntry(DrawElementsType type,
+                     size_t offset,
+                     size_t count,
+                     bool primitiveRestartEnabled) const;
 
-        DrawElementsType type;
-        size_t offset;
-        size_t count;
-        bool primitiveRestartEnabled;
-    };
+    using EntryArray = std::array<Entry, kEntryCount>;
+    std::unique_ptr<EntryArray> mEntries;
+
+    // Bumping the generation invalidates all entries at once.
+    uint32_t mGeneration;
 
-    typedef std::map<IndexRangeKey, IndexRange> IndexRangeMap;
-    IndexRangeMap mIndexRangeCache;
+    // Bounds of the bytes covered by the valid entries, so that updates to other parts of the
+    // buffer don't need to look at the entries.
+    size_t mCachedStart;
+    size_t mCachedEnd;
 };
 
 }  // namespace gl
@@ -0,0 +1,139 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Unit tests for IndexRangeCache.
+//
+
+#include "gtest/gtest.h"
+
+#include "libANGLE/IndexRangeCache.h"
+
+using namespace gl;
+
+namespace
+{
+bool HasRange(const IndexRangeCache &cache,
+              DrawElementsType type,
+              size_t offset,
+              size_t count,
+              bool primitiveRestartEnabled = false)
+{
+    return cache.findRange(type, offset, count, primitiveRestartEnabled, nullptr);
+}
+
+// Test that ranges are found only under the exact key they were added with.
+TEST(IndexRangeCacheTest, AddAndFind)
+{
+    IndexRangeCache cache;
+    cache.addRange(DrawElementsType::UnsignedShort, 16, 6, false, IndexRange(2, 9, 6));
+
+    IndexRange range;
+    EXPECT_TRUE(cache.findRange(DrawElementsType::UnsignedShort, 16, 6, false, &range));
+    EXPECT_EQ(2u, range.start);
+    EXPECT_EQ(9u, range.end);
+    EXPECT_EQ(6u, range.vertexIndexCount);
+
+    EXPECT_FALSE(cache.findRange(DrawElementsType::UnsignedInt, 16, 6, false, &range));
+    EXPECT_EQ(0u, range.start);
+    EXPECT_EQ(0u, range.end);
+    EXPECT_FALSE(HasRange(cache, DrawElementsType::UnsignedShort, 16, 6, true));
+    EXPECT_FALSE(HasRange(cache, DrawElementsType::UnsignedShort, 18, 6));
+    EXPECT_FALSE(HasRange(cache, DrawElementsType::UnsignedShort, 16, 5));
+
+    // Adding the same key again replaces the range.
+    cache.addRange(DrawElementsType::UnsignedShort, 16, 6, false, IndexRange(0, 3, 6));
+    EXPECT_TRUE(cache.findRange(DrawElementsType::UnsignedShort, 16, 6, false, &range));
+    EXPECT_EQ(0u, range.start);
+    EXPECT_EQ(3u, range.end);
+}
+
+// Test that invalidating a part of the buffer only drops the ranges that overlap it.
+TEST(IndexRangeCacheTest, InvalidateRange)
+{
+    IndexRangeCache cache;
+    // Bytes [0, 12], [100, 112] and [200, 224].
+    cache.addRange(DrawElementsType::UnsignedShort, 0, 6, false, IndexRange(0, 5, 6));
+    cache.addRange(DrawElementsType::UnsignedShort, 100, 6, false, IndexRange(0, 5, 6));
+    cache.addRange(DrawElementsType::UnsignedInt, 200, 6, false, IndexRange(0, 5, 6));
+
+    // Outside of everything that is cached.
+    cache.invalidateRange(300, 16);
+    EXPECT_TRUE(HasRange(cache, DrawElementsType::UnsignedShort, 0, 6));
+    EXPECT_TRUE(HasRange(cache, DrawElementsType::UnsignedShort, 100, 6));
+    EXPECT_TRUE(HasRange(cache, DrawElementsType::UnsignedInt, 200, 6));
+
+    // Between two ranges.
+    cache.invalidateRange(50, 16);
+    EXPECT_TRUE(HasRange(cache, DrawElementsType::UnsignedShort, 0, 6));
+    EXPECT_TRUE(HasRange(cache, DrawElementsType::UnsignedShort, 100, 6));
+    EXPECT_TRUE(HasRange(cache, DrawElementsType::UnsignedInt, 200, 6));
+
+    // Overlapping the end of the middle range.
+    cache.invalidateRange(110, 16);
+    EXPECT_TRUE(HasRange(cache, DrawElementsType::UnsignedShort, 0, 6));
+    EXPECT_FALSE(HasRange(cache, DrawElementsType::UnsignedShort, 100, 6));
+    EXPECT_TRUE(HasRange(cache, DrawElementsType::UnsignedInt, 200, 6));
+
+    // Covering everything.
+    cache.invalidateRange(0, 1000);
+    EXPECT_FALSE(HasRange(cache, DrawElementsType::UnsignedShort, 0, 6));
+    EXPECT_FALSE(HasRange(cache, DrawElementsType::UnsignedInt, 200, 6));
+
+    // The cache is usable again afterwards.
+    cache.addRange(DrawElementsType::UnsignedShort, 100, 6, false, IndexRange(0, 5, 6));
+    EXPECT_TRUE(HasRange(cache, DrawElementsType::UnsignedShort, 100, 6));
+}
+
+// Test that clearing the cache drops all ranges.
+TEST(IndexRangeCacheTest, Clear)
+{
+    IndexRangeCache cache;
+    cache.addRange(DrawElementsType::UnsignedByte, 0, 3, false, IndexRange(0, 2, 3));
+    cache.addRange(DrawElementsType::UnsignedByte, 3, 3, true, IndexRange(0, 2, 3));
+
+    cache.clear();
+    EXPECT_FALSE(HasRange(cache, DrawElementsType::UnsignedByte, 0, 3));
+    EXPECT_FALSE(HasRange(cache, DrawElementsType::UnsignedByte, 3, 3, true));
+}
+
+// Test that a cache that never had a range added can be queried, invalidated and cleared.
+TEST(IndexRangeCacheTest, Empty)
+{
+    IndexRangeCache cache;
+    EXPECT_FALSE(HasRange(cache, DrawElementsType::UnsignedShort, 0, 6));
+
+    cache.invalidateRange(0, 1024);
+    cache.clear();
+    EXPECT_FALSE(HasRange(cache, DrawElementsType::UnsignedShort, 0, 6));
+
+    cache.addRange(DrawElementsType::UnsignedShort, 0, 6, false, IndexRange(0, 5, 6));
+    EXPECT_TRUE(HasRange(cache, DrawElementsType::UnsignedShort, 0, 6));
+}
+
+// Test that adding more ranges than the cache holds keeps the most recent ones, and never returns
+// a range for the wrong key.
+TEST(IndexRangeCacheTest, Eviction)
+{
+    IndexRangeCache cache;
+    constexpr size_t kRangeCount = 100;
+    for (size_t index = 0; index < kRangeCount; ++index)
+    {
+        cache.addRange(DrawElementsType::UnsignedShort, index * 64, 32, false,
+                       IndexRange(index, index + 10, 32));
+    }
+
+    EXPECT_TRUE(HasRange(cache, DrawElementsType::UnsignedShort, (kRangeCount - 1) * 64, 32));
+
+    for (size_t index = 0; index < kRangeCount; ++index)
+    {
+        IndexRange range;
+        if (cache.findRange(DrawElementsType::UnsignedShort, index * 64, 32, false, &range))
+        {
+            EXPECT_EQ(index, range.start);
+            EXPECT_EQ(index + 10, range.end);
+        }
+    }
+}
+}  // anonymous namespace
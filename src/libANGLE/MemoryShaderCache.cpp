@@ -33,7 +33,9 @@ namespace
 static constexpr size_t kMaxUncompressedShaderSize = 5 * 1024 * 1024;
 }  // namespace
 
-MemoryShaderCache::MemoryShaderCache(egl::BlobCache &blobCache) : mBlobCache(blobCache) {}
+MemoryShaderCache::MemoryShaderCache(egl::BlobCache &blobCache)
+    : mBlobCache(blobCache), mDiskCache(ShaderTranslationDiskCache::Get())
+{}
 
 MemoryShaderCache::~MemoryShaderCache() {}
 
@@ -42,12 +44,28 @@ egl::CacheGetResult MemoryShaderCache::getShader(const Context *context,
                                                  const egl::BlobCache::Key &shaderHash,
                                                  angle::JobResultExpectancy resultExpectancy)
 {
+    egl::CacheGetResult result = egl::CacheGetResult::NotFound;
+
     // If caching is effectively disabled, don't bother calculating the hash.
-    if (!mBlobCache.isCachingEnabled())
+    if (mBlobCache.isCachingEnabled())
     {
-        return egl::CacheGetResult::NotFound;
+        result = getShaderFromBlobCache(context, shader, shaderHash, resultExpectancy);
     }
 
+    if (result == egl::CacheGetResult::NotFound && mDiskCache != nullptr)
+    {
+        result = getShaderFromDiskCache(context, shader, shaderHash, resultExpectancy);
+    }
+
+    return result;
+}
+
+egl::CacheGetResult MemoryShaderCache::getShaderFromBlobCache(
+    const Context *context,
+    Shader *shader,
+    const egl::BlobCache::Key &shaderHash,
+    angle::JobResultExpectancy resultExpectancy)
+{
     angle::MemoryBuffer uncompressedData;
     const egl::BlobCache::GetAndDecompressResult result = mBlobCache.getAndDecompress(
         context->getScratchBuffer(), shaderHash, kMaxUncompressedShaderSize, &uncompressedData);
@@ -80,12 +98,41 @@ egl::CacheGetResult MemoryShaderCache::getShader(const Context *context,
     return egl::CacheGetResult::NotFound;
 }
 
+egl::CacheGetResult MemoryShaderCache::getShaderFromDiskCache(
+    const Context *context,
+    Shader *shader,
+    const egl::BlobCache::Key &shaderHash,
+    angle::JobResultExpectancy resultExpectancy)
+{
+    // The shader is loaded straight out of the mapped file.
+    angle::MemoryMappedFile mappedFile;
+    const uint8_t *data = nullptr;
+    size_t size         = 0;
+    if (!mDiskCache->find(shaderHash, &mappedFile, &data, &size))
+    {
+        return egl::CacheGetResult::NotFound;
+    }
+
+    if (size <= kMaxUncompressedShaderSize &&
+        shader->loadBinary(context, data, static_cast<int>(size), resultExpectancy))
+    {
+        return egl::CacheGetResult::Success;
+    }
+
+    ANGLE_PERF_WARNING(context->getState().getDebug(), GL_DEBUG_SEVERITY_LOW,
+                       "Failed to load shader binary from the shader translation disk cache.");
+    mappedFile.close();
+    mDiskCache->reject(shaderHash);
+    return egl::CacheGetResult::Rejected;
+}
+
 angle::Result MemoryShaderCache::putShader(const Context *context,
                                            const egl::BlobCache::Key &shaderHash,
                                            const Shader *shader)
 {
     // If caching is effectively disabled, don't bother serializing the shader.
-    if (!mBlobCache.isCachingEnabled())
+    const bool blobCachingEnabled = mBlobCache.isCachingEnabled();
+    if (!blobCachingEnabled && mDiskCache == nullptr)
     {
         return angle::Result::Continue;
     }
@@ -93,6 +140,16 @@ angle::Result MemoryShaderCache::putShader(const Context *context,
     angle::MemoryBuffer serializedShader;
     ANGLE_TRY(shader->serialize(nullptr, &serializedShader));
 
+    if (mDiskCache != nullptr)
+    {
+        mDiskCache->put(shaderHash, serializedShader);
+    }
+
+    if (!blobCachingEnabled)
+    {
+        return angle::Result::Continue;
+    }
+
     size_t compressedSize;
     if (!mBlobCache.compressAndPut(shaderHash, std::move(serializedShader), &compressedSize))
     {
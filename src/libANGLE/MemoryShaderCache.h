@@ -16,6 +16,7 @@
 #include "common/MemoryBuffer.h"
 #include "libANGLE/BlobCache.h"
 #include "libANGLE/Error.h"
+#include "libANGLE/ShaderTranslationDiskCache.h"
 
 namespace gl
 {
@@ -36,7 +37,8 @@ class MemoryShaderCache final : angle::NonCopyable
                             const Shader *shader);
 
     // Check the cache, and deserialize and load the shader if found. Evict existing hash if load
-    // fails.
+    // fails.  Shaders that are not in the blob cache are looked up in the shader translation disk
+    // cache, if enabled.
     egl::CacheGetResult getShader(const Context *context,
                                   Shader *shader,
                                   const egl::BlobCache::Key &shaderHash,
@@ -49,7 +51,18 @@ class MemoryShaderCache final : angle::NonCopyable
     size_t maxSize() const;
 
   private:
+    egl::CacheGetResult getShaderFromBlobCache(const Context *context,
+                                               Shader *shader,
+                                               const egl::BlobCache::Key &shaderHash,
+                                               angle::JobResultExpectancy resultExpectancy);
+    egl::CacheGetResult getShaderFromDiskCache(const Context *context,
+                                               Shader *shader,
+                                               const egl::BlobCache::Key &shaderHash,
+                                               angle::JobResultExpectancy resultExpectancy);
+
     egl::BlobCache &mBlobCache;
+    // Shared by all displays, and nullptr unless enabled.
+    ShaderTranslationDiskCache *mDiskCache;
 };
 
 }  // namespace gl
@@ -5,12 +5,15 @@
 //
 // ResourceMap:
 //   An optimized resource map which packs the first set of allocated objects into a
-//   flat array, and then falls back to an unordered map for the higher handle values.
+//   flat array, the next ones into lazily allocated fixed-size segments, and then falls back to an
+//   unordered map for the higher handle values.
 //
 
 #ifndef LIBANGLE_RESOURCE_MAP_H_
 #define LIBANGLE_RESOURCE_MAP_H_
 
+#include <array>
+#include <atomic>
 #include <mutex>
 #include <type_traits>
 
@@ -126,6 +129,15 @@ class ResourceMap final : angle::NonCopyable
             return (value == InvalidPointer() ? nullptr : value);
         }
 
+        // No need for a lock when accessing the segments either, as they never move.
+        if (IsSegmentedHandle(handle))
+        {
+            const std::atomic<ResourceType *> *slot = getSegmentedSlot(handle);
+            ResourceType *value =
+                slot == nullptr ? InvalidPointer() : slot->load(std::memory_order_acquire);
+            return (value == InvalidPointer() ? nullptr : value);
+        }
+
         std::lock_guard<Mutex> lock(mMutex);
 
         auto it = mHashedResources.find(handle);
@@ -164,6 +176,8 @@ class ResourceMap final : angle::NonCopyable
         void updateValue();
 
         const ResourceMap &mOrigin;
+        // Index in the flat array or the segments, or kSegmentedResourcesLimit when iterating
+        // over the hash map.
         GLuint mFlatIndex;
         typename HashMap::const_iterator mHashIndex;
         IndexAndResource mValue;
@@ -203,9 +217,40 @@ class ResourceMap final : angle::NonCopyable
     static_assert(((kFlatResourcesLimit / kInitialFlatResourcesSize) &
                    (kFlatResourcesLimit / kInitialFlatResourcesSize - 1)) == 0);
 
+    // Handles in [kFlatResourcesLimit, kSegmentedResourcesLimit) are placed in segments of
+    // |kSegmentSize| resources, which cover applications that create tens of thousands of objects.
+    static constexpr size_t kSegmentSize  = 4096;
+    static constexpr size_t kSegmentCount = 64;
+    static constexpr size_t kSegmentedResourcesLimit =
+        kFlatResourcesLimit + kSegmentSize * kSegmentCount;
+
+    struct Segment
+    {
+        std::atomic<ResourceType *> resources[kSegmentSize];
+    };
+
+    static bool IsSegmentedHandle(GLuint handle)
+    {
+        return handle >= kFlatResourcesLimit && handle < kSegmentedResourcesLimit;
+    }
+    // Returns nullptr if the segment of |handle| is not allocated.
+    std::atomic<ResourceType *> *getSegmentedSlot(GLuint handle) const
+    {
+        const size_t index = handle - kFlatResourcesLimit;
+        Segment *segment   = mSegments[index / kSegmentSize].load(std::memory_order_acquire);
+        return segment == nullptr ? nullptr : &segment->resources[index % kSegmentSize];
+    }
+    std::atomic<ResourceType *> *getOrAllocateSegmentedSlot(GLuint handle);
+    void freeSegments();
+
     size_t mFlatResourcesSize;
     ResourceType **mFlatResources;
 
+    // The segments are allocated on first use and are only freed by clear() and on destruction.
+    // A segment is published with a release store after it is initialized, so lookups in the
+    // segments are lock-free even for maps that need a lock.
+    std::array<std::atomic<Segment *>, kSegmentCount> mSegments;
+
     // A map of GL objects indexed by object ID.
     HashMap mHashedResources;
 
@@ -215,11 +260,11 @@ class ResourceMap final : angle::NonCopyable
     // |kFlatResourcesLimit|, but only for maps that don't need a lock (kNeedsLock == false).
     //
     // For maps that don't need a lock, this mutex is a no-op.  For those that do, the mutex is
-    // taken when allocating / deleting objects, as well as when accessing |mHashedResources|.
-    // Otherwise, access to the flat map (which never gets reallocated due to
-    // |kInitialFlatResourcesSize == kFlatResourcesLimit|) is lockless.  This latter is possible
-    // because the application is not allowed to gen/delete and bind the same ID in different
-    // threads at the same time.
+    // taken when allocating a segment, as well as when accessing |mHashedResources|.  Otherwise,
+    // access to the flat map (which never gets reallocated due to
+    // |kInitialFlatResourcesSize == kFlatResourcesLimit|) and the segments is lockless.  This
+    // latter is possible because the application is not allowed to gen/delete and bind the same
+    // ID in different threads at the same time.
     //
     // Note that because HandleAllocator is not yet thread-safe, glGen* and glDelete* functions
     // cannot be free of the share group mutex yet.  To remove the share group mutex from those
@@ -258,6 +303,10 @@ ResourceMap<ResourceType, IDType>::ResourceMap()
       mFlatResources(new ResourceType *[kInitialFlatResourcesSize])
 {
     memset(mFlatResources, kInvalidPointer, mFlatResourcesSize * sizeof(mFlatResources[0]));
+    for (std::atomic<Segment *> &segment : mSegments)
+    {
+        segment.store(nullptr, std::memory_order_relaxed);
+    }
 }
 
 template <typename ResourceType, typename IDType>
@@ -265,6 +314,7 @@ ResourceMap<ResourceType, IDType>::~ResourceMap()
 {
     ASSERT(begin() == end());
     delete[] mFlatResources;
+    freeSegments();
 }
 
 template <typename ResourceType, typename IDType>
@@ -275,6 +325,11 @@ ANGLE_INLINE bool ResourceMap<ResourceType, IDType>::contains(IDType id) const
     {
         return mFlatResources[handle] != InvalidPointer();
     }
+    if (IsSegmentedHandle(handle))
+    {
+        const std::atomic<ResourceType *> *slot = getSegmentedSlot(handle);
+        return slot != nullptr && slot->load(std::memory_order_acquire) != InvalidPointer();
+    }
     std::lock_guard<Mutex> lock(mMutex);
     return mHashedResources.find(handle) != mHashedResources.end();
 }
@@ -293,6 +348,18 @@ bool ResourceMap<ResourceType, IDType>::erase(IDType id, ResourceType **resource
         *resourceOut = value;
         value        = InvalidPointer();
     }
+    else if (IsSegmentedHandle(handle))
+    {
+        std::atomic<ResourceType *> *slot = getSegmentedSlot(handle);
+        ResourceType *value =
+            slot == nullptr ? InvalidPointer() : slot->load(std::memory_order_relaxed);
+        if (value == InvalidPointer())
+        {
+            return false;
+        }
+        *resourceOut = value;
+        slot->store(InvalidPointer(), std::memory_order_release);
+    }
     else
     {
         std::lock_guard<Mutex> lock(mMutex);
@@ -338,6 +405,10 @@ void ResourceMap<ResourceType, IDType>::assign(IDType id, ResourceType *resource
         ASSERT(mFlatResourcesSize > handle);
         mFlatResources[handle] = resource;
     }
+    else if (IsSegmentedHandle(handle))
+    {
+        getOrAllocateSegmentedSlot(handle)->store(resource, std::memory_order_release);
+    }
     else
     {
         std::lock_guard<Mutex> lock(mMutex);
@@ -345,6 +416,41 @@ void ResourceMap<ResourceType, IDType>::assign(IDType id, ResourceType *resource
     }
 }
 
+template <typename ResourceType, typename IDType>
+std::atomic<ResourceType *> *ResourceMap<ResourceType, IDType>::getOrAllocateSegmentedSlot(
+    GLuint handle)
+{
+    const size_t index                 = handle - kFlatResourcesLimit;
+    std::atomic<Segment *> &segmentPtr = mSegments[index / kSegmentSize];
+
+    Segment *segment = segmentPtr.load(std::memory_order_acquire);
+    if (segment == nullptr)
+    {
+        // Another thread may be allocating the same segment for a different handle.
+        std::lock_guard<Mutex> lock(mMutex);
+        segment = segmentPtr.load(std::memory_order_relaxed);
+        if (segment == nullptr)
+        {
+            segment = new Segment;
+            for (std::atomic<ResourceType *> &slot : segment->resources)
+            {
+                slot.store(InvalidPointer(), std::memory_order_relaxed);
+            }
+            segmentPtr.store(segment, std::memory_order_release);
+        }
+    }
+    return &segment->resources[index % kSegmentSize];
+}
+
+template <typename ResourceType, typename IDType>
+void ResourceMap<ResourceType, IDType>::freeSegments()
+{
+    for (std::atomic<Segment *> &segment : mSegments)
+    {
+        delete segment.exchange(nullptr, std::memory_order_relaxed);
+    }
+}
+
 template <typename ResourceType, typename IDType>
 typename ResourceMap<ResourceType, IDType>::Iterator ResourceMap<ResourceType, IDType>::begin()
     const
@@ -355,7 +461,8 @@ typename ResourceMap<ResourceType, IDType>::Iterator ResourceMap<ResourceType, I
 template <typename ResourceType, typename IDType>
 typename ResourceMap<ResourceType, IDType>::Iterator ResourceMap<ResourceType, IDType>::end() const
 {
-    return Iterator(*this, static_cast<GLuint>(mFlatResourcesSize), mHashedResources.end(), true);
+    return Iterator(*this, static_cast<GLuint>(kSegmentedResourcesLimit), mHashedResources.end(),
+                    true);
 }
 
 template <typename ResourceType, typename IDType>
@@ -369,7 +476,8 @@ template <typename ResourceType, typename IDType>
 typename ResourceMap<ResourceType, IDType>::Iterator
 ResourceMap<ResourceType, IDType>::endWithNull() const
 {
-    return Iterator(*this, static_cast<GLuint>(mFlatResourcesSize), mHashedResources.end(), false);
+    return Iterator(*this, static_cast<GLuint>(kSegmentedResourcesLimit), mHashedResources.end(),
+                    false);
 }
 
 template <typename ResourceType, typename IDType>
@@ -384,6 +492,7 @@ void ResourceMap<ResourceType, IDType>::clear()
     // No need for a lock as this is only called on destruction.
     memset(mFlatResources, kInvalidPointer, kInitialFlatResourcesSize * sizeof(mFlatResources[0]));
     mFlatResourcesSize = kInitialFlatResourcesSize;
+    freeSegments();
     mHashedResources.clear();
 }
 
@@ -392,7 +501,8 @@ GLuint ResourceMap<ResourceType, IDType>::nextResource(size_t flatIndex, bool sk
 {
     // This function is only used by the iterators, access to which is marked by
     // UnsafeResourceMapIter.  Locking is the responsibility of the caller.
-    for (size_t index = flatIndex; index < mFlatResourcesSize; index++)
+    size_t index = flatIndex;
+    for (; index < mFlatResourcesSize; index++)
     {
         if ((mFlatResources[index] != nullptr || !skipNulls) &&
             mFlatResources[index] != InvalidPointer())
@@ -400,7 +510,31 @@ GLuint ResourceMap<ResourceType, IDType>::nextResource(size_t flatIndex, bool sk
             return static_cast<GLuint>(index);
         }
     }
-    return static_cast<GLuint>(mFlatResourcesSize);
+
+    // The handles between the flat array and the segments are never used.
+    index = std::max(index, kFlatResourcesLimit);
+    while (index < kSegmentedResourcesLimit)
+    {
+        const size_t segmentIndex = (index - kFlatResourcesLimit) / kSegmentSize;
+        const size_t segmentEnd   = kFlatResourcesLimit + (segmentIndex + 1) * kSegmentSize;
+        const Segment *segment    = mSegments[segmentIndex].load(std::memory_order_relaxed);
+        if (segment == nullptr)
+        {
+            index = segmentEnd;
+            continue;
+        }
+
+        for (; index < segmentEnd; index++)
+        {
+            const size_t slotIndex = (index - kFlatResourcesLimit) % kSegmentSize;
+            ResourceType *value    = segment->resources[slotIndex].load(std::memory_order_relaxed);
+            if ((value != nullptr || !skipNulls) && value != InvalidPointer())
+            {
+                return static_cast<GLuint>(index);
+            }
+        }
+    }
+    return static_cast<GLuint>(kSegmentedResourcesLimit);
 }
 
 template <typename ResourceType, typename IDType>
@@ -437,7 +571,7 @@ template <typename ResourceType, typename IDType>
 typename ResourceMap<ResourceType, IDType>::Iterator &
 ResourceMap<ResourceType, IDType>::Iterator::operator++()
 {
-    if (mFlatIndex < static_cast<GLuint>(mOrigin.mFlatResourcesSize))
+    if (mFlatIndex < static_cast<GLuint>(kSegmentedResourcesLimit))
     {
         mFlatIndex = mOrigin.nextResource(mFlatIndex + 1, mSkipNulls);
     }
@@ -471,6 +605,11 @@ void ResourceMap<ResourceType, IDType>::Iterator::updateValue()
         mValue.first  = mFlatIndex;
         mValue.second = mOrigin.mFlatResources[mFlatIndex];
     }
+    else if (mFlatIndex < static_cast<GLuint>(kSegmentedResourcesLimit))
+    {
+        mValue.first  = mFlatIndex;
+        mValue.second = mOrigin.getSegmentedSlot(mFlatIndex)->load(std::memory_order_relaxed);
+    }
     else if (mHashIndex != mOrigin.mHashedResources.end())
     {
         mValue.first  = mHashIndex->first;
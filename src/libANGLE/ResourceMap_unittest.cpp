@@ -200,6 +200,68 @@ TEST(ResourceMapTest, QueryUnassignedLocked)
     QueryUnassigned<LockedType>();
 }
 
+template <typename T>
+void AllRanges()
+{
+    // Ids in the flat array, in the segments (several of them, and not starting at the first one)
+    // and in the hash map.
+    const std::vector<T> ids = {1, 100, 20'000, 20'001, 60'000, 150'000, 1'000'000, 2'000'000};
+
+    ResourceMap<size_t, T> resourceMap;
+    std::vector<size_t> objects(ids.size());
+
+    for (size_t index = 0; index < ids.size(); ++index)
+    {
+        ASSERT_FALSE(resourceMap.contains(ids[index]));
+        ASSERT_EQ(nullptr, resourceMap.query(ids[index]));
+        resourceMap.assign(ids[index], &objects[index]);
+    }
+
+    for (size_t index = 0; index < ids.size(); ++index)
+    {
+        ASSERT_TRUE(resourceMap.contains(ids[index]));
+        ASSERT_EQ(&objects[index], resourceMap.query(ids[index]));
+        // Neighbors in the same segment are not assigned.
+        ASSERT_FALSE(resourceMap.contains(ids[index] + 2));
+        ASSERT_EQ(nullptr, resourceMap.query(ids[index] + 2));
+    }
+
+    // Every id is visited exactly once by the iterators.
+    std::map<GLuint, size_t *> visited;
+    for (const auto &idAndResource : UnsafeResourceMapIter(resourceMap))
+    {
+        ASSERT_EQ(0u, visited.count(idAndResource.first));
+        visited[idAndResource.first] = idAndResource.second;
+    }
+    ASSERT_EQ(ids.size(), visited.size());
+    for (size_t index = 0; index < ids.size(); ++index)
+    {
+        ASSERT_EQ(&objects[index], visited[ids[index]]);
+    }
+
+    for (size_t index = 0; index < ids.size(); ++index)
+    {
+        size_t *found = nullptr;
+        ASSERT_TRUE(resourceMap.erase(ids[index], &found));
+        ASSERT_EQ(&objects[index], found);
+        ASSERT_FALSE(resourceMap.erase(ids[index], &found));
+        ASSERT_FALSE(resourceMap.contains(ids[index]));
+    }
+
+    ASSERT_TRUE(UnsafeResourceMapIter(resourceMap).empty());
+}
+
+// Tests assigning, querying, iterating and erasing ids in all ranges of the map.
+TEST(ResourceMapTest, AllRangesLockless)
+{
+    AllRanges<LocklessType>();
+}
+// Tests assigning, querying, iterating and erasing ids in all ranges of the map.
+TEST(ResourceMapTest, AllRangesLocked)
+{
+    AllRanges<LockedType>();
+}
+
 void ConcurrentAccess(size_t iterations, size_t idCycleSize)
 {
     if (std::is_same_v<ResourceMapMutex, angle::NoOpMutex>)
@@ -310,4 +372,59 @@ TEST(ResourceMapTest, ConcurrentAccessLargeIds)
 {
     ConcurrentAccess(10'000, 20'000);
 }
+
+// Tests that lookups of existing large ids from multiple threads see the right values while
+// another thread keeps assigning ids that need new segments.
+TEST(ResourceMapTest, ConcurrentQueryDuringInsert)
+{
+    if (std::is_same_v<ResourceMapMutex, angle::NoOpMutex>)
+    {
+        GTEST_SKIP() << "Test skipped: Locking is disabled in build.";
+    }
+
+    constexpr size_t kReaderCount     = 4;
+    constexpr LockedType kFirstId     = 10'000;
+    constexpr LockedType kStableIds   = 5'000;
+    constexpr LockedType kInsertedIds = 100'000;
+
+    ResourceMap<size_t, LockedType> resourceMap;
+    std::vector<size_t> objects(kStableIds + kInsertedIds);
+
+    for (LockedType id = 0; id < kStableIds; ++id)
+    {
+        resourceMap.assign(kFirstId + id, &objects[id]);
+    }
+
+    std::atomic<bool> done(false);
+    std::array<std::thread, kReaderCount> readers;
+    for (size_t i = 0; i < kReaderCount; ++i)
+    {
+        readers[i] = std::thread([&, i]() {
+            LockedType id = static_cast<LockedType>(i);
+            while (!done)
+            {
+                EXPECT_EQ(&objects[id], resourceMap.query(kFirstId + id));
+                id = (id + kReaderCount) % kStableIds;
+            }
+        });
+    }
+
+    for (LockedType id = kStableIds; id < kStableIds + kInsertedIds; ++id)
+    {
+        resourceMap.assign(kFirstId + id, &objects[id]);
+    }
+    done = true;
+
+    for (std::thread &reader : readers)
+    {
+        reader.join();
+    }
+
+    for (LockedType id = 0; id < kStableIds + kInsertedIds; ++id)
+    {
+        ASSERT_EQ(&objects[id], resourceMap.query(kFirstId + id));
+    }
+
+    resourceMap.clear();
+}
 }  // anonymous namespace
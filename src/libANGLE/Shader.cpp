@@ -61,6 +61,63 @@ std::string GetShaderDumpFilePath(size_t shaderHash, const char *suffix)
     return path.str();
 }
 
+// The stages and passes of the translator are profiled only if this category is traced.
+constexpr char kCompileProfileTraceCategory[] = "gpu.angle.shader_translator";
+
+bool IsCompileProfileTraced()
+{
+    angle::PlatformMethods *platform = ANGLEPlatformCurrent();
+    return *TRACE_EVENT_API_GET_CATEGORY_ENABLED(platform, kCompileProfileTraceCategory) != 0;
+}
+
+// Emits the profile of the last compilation as nested begin and end events, after the fact.
+void TraceCompileProfile(ShHandle compilerHandle)
+{
+    const std::vector<sh::CompileStageProfile> &profile = sh::GetCompileProfile(compilerHandle);
+    if (profile.empty())
+    {
+        return;
+    }
+
+    angle::PlatformMethods *platform = ANGLEPlatformCurrent();
+    const unsigned char *categoryEnabled =
+        TRACE_EVENT_API_GET_CATEGORY_ENABLED(platform, kCompileProfileTraceCategory);
+
+    // The translator times the compilation with angle::GetCurrentSystemTime(), which is not
+    // necessarily the clock of the platform.
+    const double timeOffset =
+        platform->monotonicallyIncreasingTime(platform) - angle::GetCurrentSystemTime();
+
+    const char *argNames[]         = {"poolBytes"};
+    const unsigned char argTypes[] = {TRACE_VALUE_TYPE_UINT};
+
+    auto endStages = [&](std::vector<const sh::CompileStageProfile *> *openStages, int depth) {
+        while (!openStages->empty() && openStages->back()->depth >= depth)
+        {
+            const sh::CompileStageProfile *stage = openStages->back();
+            platform->addTraceEvent(platform, TRACE_EVENT_PHASE_END, categoryEnabled, stage->name,
+                                    0, stage->startTime + stage->duration + timeOffset, 0,
+                                    nullptr, nullptr, nullptr, TRACE_EVENT_FLAG_NONE);
+            openStages->pop_back();
+        }
+    };
+
+    // The profile is ordered by start time, and nested stages and passes are deeper than the
+    // stages they are part of.
+    std::vector<const sh::CompileStageProfile *> openStages;
+    for (const sh::CompileStageProfile &stage : profile)
+    {
+        endStages(&openStages, stage.depth);
+
+        const unsigned long long argValues[] = {stage.poolBytes};
+        platform->addTraceEvent(platform, TRACE_EVENT_PHASE_BEGIN, categoryEnabled, stage.name, 0,
+                                stage.startTime + timeOffset, 1, argNames, argTypes, argValues,
+                                TRACE_EVENT_FLAG_NONE);
+        openStages.push_back(&stage);
+    }
+    endStages(&openStages, 0);
+}
+
 class CompileTask final : public angle::Closure
 {
   public:
@@ -179,6 +236,10 @@ angle::Result CompileTask::compileImpl()
         // Call the translator and get the info log
         bool result = mTranslateTask->translate(mCompilerHandle, mOptions, mSource);
         mInfoLog    = sh::GetInfoLog(mCompilerHandle);
+        if (mOptions.profileCompilation)
+        {
+            TraceCompileProfile(mCompilerHandle);
+        }
         if (!result)
         {
             return angle::Result::Stop;
@@ -732,6 +793,9 @@ void Shader::compile(const Context *context, angle::JobResultExpectancy resultEx
     // Cache load failed, fall through normal compiling.
     mState.mCompileStatus = CompileStatus::COMPILE_REQUESTED;
 
+    // The profile doesn't affect the translation, so it's not part of the shader key.
+    options.profileCompilation = IsCompileProfileTraced();
+
     // Ask the backend to prepare the translate task
     std::shared_ptr<rx::ShaderTranslateTask> translateTask =
         mImplementation->compile(context, &options);
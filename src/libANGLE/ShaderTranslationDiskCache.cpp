@@ -0,0 +1,175 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ShaderTranslationDiskCache: Stores translated shaders in a directory on disk, so identical
+//   shaders are not retranslated by other displays or after the process restarts.
+
+#include "libANGLE/ShaderTranslationDiskCache.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "common/debug.h"
+#include "libANGLE/angletypes.h"
+#include "libANGLE/trace.h"
+
+namespace gl
+{
+namespace
+{
+constexpr char kCacheDirectoryVarName[]      = "ANGLE_SHADER_TRANSLATION_CACHE_DIR";
+constexpr char kCacheDirectoryPropertyName[] = "angle.shader_translation_cache_dir";
+
+constexpr uint32_t kEntryMagic   = 0x43535341;  // "ASSC"
+constexpr uint32_t kEntryVersion = 1;
+
+ANGLE_ENABLE_STRUCT_PADDING_WARNINGS
+struct EntryHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t size;
+    uint32_t crc;
+};
+ANGLE_DISABLE_STRUCT_PADDING_WARNINGS
+}  // anonymous namespace
+
+ShaderTranslationDiskCache::ShaderTranslationDiskCache(const std::string &directory)
+    : mDirectory(directory), mHits(0), mMisses(0), mRejected(0), mStores(0)
+{}
+
+ShaderTranslationDiskCache::~ShaderTranslationDiskCache() = default;
+
+// static
+ShaderTranslationDiskCache *ShaderTranslationDiskCache::Get()
+{
+    // Intentionally leaked, as displays may be terminated in any order, up until process exit.
+    static ShaderTranslationDiskCache *sCache = []() -> ShaderTranslationDiskCache * {
+        const std::string directory = angle::GetEnvironmentVarOrAndroidProperty(
+            kCacheDirectoryVarName, kCacheDirectoryPropertyName);
+        if (directory.empty())
+        {
+            return nullptr;
+        }
+        if (!angle::IsDirectory(directory.c_str()) && !angle::CreateDirectories(directory))
+        {
+            WARN() << "Failed to create the shader translation cache directory " << directory;
+            return nullptr;
+        }
+        return new ShaderTranslationDiskCache(directory);
+    }();
+    return sCache;
+}
+
+bool ShaderTranslationDiskCache::find(const egl::BlobCache::Key &shaderHash,
+                                      angle::MemoryMappedFile *mappedFileOut,
+                                      const uint8_t **dataOut,
+                                      size_t *sizeOut)
+{
+    ANGLE_TRACE_EVENT0("gpu.angle", "ShaderTranslationDiskCache::find");
+
+    const std::string path = getEntryPath(shaderHash);
+    if (!mappedFileOut->open(path.c_str()))
+    {
+        mMisses.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    EntryHeader header = {};
+    if (mappedFileOut->size() >= sizeof(header))
+    {
+        memcpy(&header, mappedFileOut->data(), sizeof(header));
+    }
+
+    const uint8_t *data = mappedFileOut->data() + sizeof(header);
+    if (header.magic != kEntryMagic || header.version != kEntryVersion ||
+        header.size != mappedFileOut->size() - sizeof(header) ||
+        angle::GenerateCRC32(data, header.size) != header.crc)
+    {
+        // Written by an incompatible version, or truncated.  Drop it so it's written again.
+        mappedFileOut->close();
+        remove(path.c_str());
+        mMisses.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    mHits.fetch_add(1, std::memory_order_relaxed);
+    *dataOut = data;
+    *sizeOut = header.size;
+    return true;
+}
+
+void ShaderTranslationDiskCache::reject(const egl::BlobCache::Key &shaderHash)
+{
+    remove(getEntryPath(shaderHash).c_str());
+    mRejected.fetch_add(1, std::memory_order_relaxed);
+}
+
+void ShaderTranslationDiskCache::put(const egl::BlobCache::Key &shaderHash,
+                                     const angle::MemoryBuffer &serializedShader)
+{
+    ANGLE_TRACE_EVENT0("gpu.angle", "ShaderTranslationDiskCache::put");
+
+    EntryHeader header;
+    header.magic   = kEntryMagic;
+    header.version = kEntryVersion;
+    header.size    = static_cast<uint32_t>(serializedShader.size());
+    header.crc     = angle::GenerateCRC32(serializedShader.data(), serializedShader.size());
+
+    // Write to a temporary file first and move it in place, so a partially written entry is never
+    // observed under the real name.  The temporary file is created exclusively with a unique name,
+    // so threads and processes that store the same shader at the same time never write to the
+    // same file.
+    const Optional<std::string> tempPath = angle::CreateTemporaryFileInDirectory(mDirectory);
+    if (!tempPath.valid())
+    {
+        return;
+    }
+
+    FILE *file   = fopen(tempPath.value().c_str(), "wb");
+    bool success = file != nullptr;
+    if (success)
+    {
+        success = fwrite(&header, sizeof(header), 1, file) == 1 &&
+                  fwrite(serializedShader.data(), 1, serializedShader.size(), file) ==
+                      serializedShader.size();
+        success = fclose(file) == 0 && success;
+    }
+
+    if (!success || !angle::RenameFile(tempPath.value().c_str(), getEntryPath(shaderHash).c_str()))
+    {
+        remove(tempPath.value().c_str());
+        return;
+    }
+
+    mStores.fetch_add(1, std::memory_order_relaxed);
+}
+
+ShaderTranslationDiskCache::Stats ShaderTranslationDiskCache::getStats() const
+{
+    Stats stats;
+    stats.hits     = mHits.load(std::memory_order_relaxed);
+    stats.misses   = mMisses.load(std::memory_order_relaxed);
+    stats.rejected = mRejected.load(std::memory_order_relaxed);
+    stats.stores   = mStores.load(std::memory_order_relaxed);
+    return stats;
+}
+
+std::string ShaderTranslationDiskCache::getEntryPath(const egl::BlobCache::Key &shaderHash) const
+{
+    constexpr char kHexDigits[] = "0123456789abcdef";
+
+    std::string fileName;
+    fileName.reserve(shaderHash.size() * 2 + 4);
+    for (const uint8_t byte : shaderHash)
+    {
+        fileName += kHexDigits[byte >> 4];
+        fileName += kHexDigits[byte & 0xF];
+    }
+    fileName += ".bin";
+
+    return angle::ConcatenatePath(mDirectory, fileName);
+}
+}  // namespace gl
@@ -0,0 +1,80 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ShaderTranslationDiskCache: Stores translated shaders in a directory on disk, so identical
+//   shaders are not retranslated by other displays or after the process restarts.
+
+#ifndef LIBANGLE_SHADER_TRANSLATION_DISK_CACHE_H_
+#define LIBANGLE_SHADER_TRANSLATION_DISK_CACHE_H_
+
+#include <atomic>
+#include <string>
+
+#include "common/MemoryBuffer.h"
+#include "common/system_utils.h"
+#include "libANGLE/BlobCache.h"
+
+namespace gl
+{
+// The cache is content-addressed: every entry is a file named after the shader key, which is the
+// hash of the shader source, the compile options and the built-in resources (see
+// Shader::setShaderKey).  Entries hold the uncompressed serialized shader, i.e. the translated
+// code and the CompiledShaderState, and are memory-mapped on load.  Entries are written to a
+// uniquely named temporary file first and then renamed, and are CRC-checked on load, so a cache
+// directory can be shared by multiple processes and survives processes that are killed while
+// writing to it.
+//
+// The cache is used when ANGLE_SHADER_TRANSLATION_CACHE_DIR (or the
+// angle.shader_translation_cache_dir property) names a directory, and is not bound by the blob
+// cache size limit.  Entries are never evicted; the application owns the directory.
+//
+// All methods are thread-safe.
+class ShaderTranslationDiskCache final : angle::NonCopyable
+{
+  public:
+    struct Stats
+    {
+        uint64_t hits;
+        uint64_t misses;
+        // Entries that were found but could not be loaded by the shader.
+        uint64_t rejected;
+        uint64_t stores;
+    };
+
+    explicit ShaderTranslationDiskCache(const std::string &directory);
+    ~ShaderTranslationDiskCache();
+
+    // Returns the cache shared by all displays of the process, or nullptr if it is not enabled.
+    static ShaderTranslationDiskCache *Get();
+
+    // Maps the entry for |shaderHash| into |mappedFileOut|.  On success, the serialized shader is
+    // returned through |dataOut| and |sizeOut| and stays valid while the file remains mapped.
+    // Corrupt entries are removed and count as misses.
+    bool find(const egl::BlobCache::Key &shaderHash,
+              angle::MemoryMappedFile *mappedFileOut,
+              const uint8_t **dataOut,
+              size_t *sizeOut);
+
+    // Removes an entry that was found but failed to load.
+    void reject(const egl::BlobCache::Key &shaderHash);
+
+    // Writes |serializedShader| as the entry for |shaderHash|.
+    void put(const egl::BlobCache::Key &shaderHash, const angle::MemoryBuffer &serializedShader);
+
+    Stats getStats() const;
+
+  private:
+    std::string getEntryPath(const egl::BlobCache::Key &shaderHash) const;
+
+    const std::string mDirectory;
+
+    std::atomic<uint64_t> mHits;
+    std::atomic<uint64_t> mMisses;
+    std::atomic<uint64_t> mRejected;
+    std::atomic<uint64_t> mStores;
+};
+}  // namespace gl
+
+#endif  // LIBANGLE_SHADER_TRANSLATION_DISK_CACHE_H_
@@ -0,0 +1,218 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ShaderTranslationDiskCache_unittest.cpp: Unit tests for the shader translation disk cache.
+
+#include <gtest/gtest.h>
+
+#include <stdio.h>
+
+#include <thread>
+#include <vector>
+
+#include "libANGLE/ShaderTranslationDiskCache.h"
+#include "util/test_utils.h"
+
+namespace gl
+{
+namespace
+{
+egl::BlobCache::Key MakeKey(uint8_t start)
+{
+    egl::BlobCache::Key key;
+    for (size_t i = 0; i < key.size(); ++i)
+    {
+        key[i] = static_cast<uint8_t>(start + i);
+    }
+    return key;
+}
+
+angle::MemoryBuffer MakeBlob(size_t size, uint8_t start)
+{
+    angle::MemoryBuffer blob;
+    EXPECT_TRUE(blob.resize(size));
+    for (size_t i = 0; i < size; ++i)
+    {
+        blob[i] = static_cast<uint8_t>(start + i);
+    }
+    return blob;
+}
+
+std::string GetEntryPath(const std::string &directory, const egl::BlobCache::Key &key)
+{
+    std::string fileName;
+    for (const uint8_t byte : key)
+    {
+        char hex[3];
+        snprintf(hex, sizeof(hex), "%02x", byte);
+        fileName += hex;
+    }
+    return angle::ConcatenatePath(directory, fileName + ".bin");
+}
+
+class ShaderTranslationDiskCacheTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        // Use a directory next to a new temporary file, so tests never see each other's entries.
+        Optional<std::string> tempFile = angle::CreateTemporaryFile();
+        ASSERT_TRUE(tempFile.valid());
+        mTempFile  = tempFile.value();
+        mDirectory = mTempFile + "_cache";
+        ASSERT_TRUE(angle::CreateDirectories(mDirectory));
+    }
+
+    void TearDown() override
+    {
+        for (uint8_t start : {0, 1, 2})
+        {
+            angle::DeleteSystemFile(GetEntryPath(mDirectory, MakeKey(start)).c_str());
+        }
+        angle::DeleteSystemFile(mDirectory.c_str());
+        angle::DeleteSystemFile(mTempFile.c_str());
+    }
+
+    std::string mTempFile;
+    std::string mDirectory;
+};
+
+// Test that stored entries are found with the same contents, by any instance using the directory.
+TEST_F(ShaderTranslationDiskCacheTest, PutAndFind)
+{
+    ShaderTranslationDiskCache cache(mDirectory);
+
+    angle::MemoryMappedFile mappedFile;
+    const uint8_t *data = nullptr;
+    size_t size         = 0;
+    EXPECT_FALSE(cache.find(MakeKey(0), &mappedFile, &data, &size));
+
+    const angle::MemoryBuffer blob = MakeBlob(1000, 7);
+    cache.put(MakeKey(0), blob);
+    cache.put(MakeKey(1), MakeBlob(10, 3));
+
+    ASSERT_TRUE(cache.find(MakeKey(0), &mappedFile, &data, &size));
+    ASSERT_EQ(blob.size(), size);
+    EXPECT_EQ(0, memcmp(blob.data(), data, size));
+    mappedFile.close();
+
+    // Another instance, such as one in a later process, sees the same entries.
+    ShaderTranslationDiskCache otherCache(mDirectory);
+    ASSERT_TRUE(otherCache.find(MakeKey(1), &mappedFile, &data, &size));
+    EXPECT_EQ(10u, size);
+    mappedFile.close();
+    EXPECT_FALSE(otherCache.find(MakeKey(2), &mappedFile, &data, &size));
+
+    ShaderTranslationDiskCache::Stats stats = cache.getStats();
+    EXPECT_EQ(1u, stats.hits);
+    EXPECT_EQ(1u, stats.misses);
+    EXPECT_EQ(2u, stats.stores);
+    EXPECT_EQ(0u, stats.rejected);
+
+    stats = otherCache.getStats();
+    EXPECT_EQ(1u, stats.hits);
+    EXPECT_EQ(1u, stats.misses);
+    EXPECT_EQ(0u, stats.stores);
+}
+
+// Test that storing an entry again replaces it.
+TEST_F(ShaderTranslationDiskCacheTest, Replace)
+{
+    ShaderTranslationDiskCache cache(mDirectory);
+    cache.put(MakeKey(0), MakeBlob(100, 0));
+    cache.put(MakeKey(0), MakeBlob(50, 1));
+
+    angle::MemoryMappedFile mappedFile;
+    const uint8_t *data = nullptr;
+    size_t size         = 0;
+    ASSERT_TRUE(cache.find(MakeKey(0), &mappedFile, &data, &size));
+    ASSERT_EQ(50u, size);
+    EXPECT_EQ(1u, data[0]);
+}
+
+// Test that threads storing the same shader at the same time leave a complete entry behind.
+TEST_F(ShaderTranslationDiskCacheTest, ConcurrentPut)
+{
+    constexpr size_t kThreadCount = 8;
+    constexpr size_t kBlobSize    = 64 * 1024;
+
+    ShaderTranslationDiskCache cache(mDirectory);
+    std::vector<std::thread> threads;
+    for (size_t threadIndex = 0; threadIndex < kThreadCount; ++threadIndex)
+    {
+        threads.emplace_back([&cache, threadIndex]() {
+            for (int iteration = 0; iteration < 10; ++iteration)
+            {
+                cache.put(MakeKey(0), MakeBlob(kBlobSize, static_cast<uint8_t>(threadIndex)));
+            }
+        });
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    angle::MemoryMappedFile mappedFile;
+    const uint8_t *data = nullptr;
+    size_t size         = 0;
+    ASSERT_TRUE(cache.find(MakeKey(0), &mappedFile, &data, &size));
+    ASSERT_EQ(kBlobSize, size);
+    EXPECT_LT(data[0], kThreadCount);
+    EXPECT_EQ(kThreadCount * 10, cache.getStats().stores);
+}
+
+// Test that truncated or corrupt entries are treated as misses and removed.
+TEST_F(ShaderTranslationDiskCacheTest, CorruptEntries)
+{
+    ShaderTranslationDiskCache cache(mDirectory);
+    cache.put(MakeKey(0), MakeBlob(100, 0));
+    cache.put(MakeKey(1), MakeBlob(100, 0));
+
+    // Truncate the first entry, and flip a byte of the second one.
+    const std::string truncatedPath = GetEntryPath(mDirectory, MakeKey(0));
+    FILE *file                      = fopen(truncatedPath.c_str(), "wb");
+    ASSERT_NE(nullptr, file);
+    fwrite("ASSC", 1, 4, file);
+    fclose(file);
+
+    const std::string corruptPath = GetEntryPath(mDirectory, MakeKey(1));
+    file                          = fopen(corruptPath.c_str(), "r+b");
+    ASSERT_NE(nullptr, file);
+    fseek(file, 50, SEEK_SET);
+    fputc(0xFF, file);
+    fclose(file);
+
+    angle::MemoryMappedFile mappedFile;
+    const uint8_t *data = nullptr;
+    size_t size         = 0;
+    EXPECT_FALSE(cache.find(MakeKey(0), &mappedFile, &data, &size));
+    EXPECT_FALSE(cache.find(MakeKey(1), &mappedFile, &data, &size));
+    EXPECT_FALSE(angle::MemoryMappedFile().open(truncatedPath.c_str()));
+    EXPECT_FALSE(angle::MemoryMappedFile().open(corruptPath.c_str()));
+    EXPECT_EQ(2u, cache.getStats().misses);
+}
+
+// Test that rejected entries are removed.
+TEST_F(ShaderTranslationDiskCacheTest, Reject)
+{
+    ShaderTranslationDiskCache cache(mDirectory);
+    cache.put(MakeKey(2), MakeBlob(100, 0));
+
+    angle::MemoryMappedFile mappedFile;
+    const uint8_t *data = nullptr;
+    size_t size         = 0;
+    ASSERT_TRUE(cache.find(MakeKey(2), &mappedFile, &data, &size));
+    mappedFile.close();
+
+    cache.reject(MakeKey(2));
+    EXPECT_FALSE(cache.find(MakeKey(2), &mappedFile, &data, &size));
+
+    const ShaderTranslationDiskCache::Stats stats = cache.getStats();
+    EXPECT_EQ(1u, stats.hits);
+    EXPECT_EQ(1u, stats.misses);
+    EXPECT_EQ(1u, stats.rejected);
+}
+}  // anonymous namespace
+}  // namespace gl
@@ -34,6 +34,10 @@ VkBufferUsageFlags GetDefaultBufferUsageFlags(vk::Renderer *renderer)
         defaultBufferUsageFlags |= VK_BUFFER_USAGE_TRANSFORM_FEEDBACK_BUFFER_BIT_EXT |
                                    VK_BUFFER_USAGE_TRANSFORM_FEEDBACK_COUNTER_BUFFER_BIT_EXT;
     }
+    if (renderer->useDescriptorBuffer())
+    {
+        defaultBufferUsageFlags |= VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+    }
     return defaultBufferUsageFlags;
 }
 
@@ -455,8 +455,99 @@ CommandProcessorTask &CommandProcessorTask::operator=(CommandProcessorTask &&rhs
     return *this;
 }
 
+// SubmitTimeline implementation.
+SubmitTimeline::SubmitTimeline() : mLastSignalValue(0), mLastCompletedValue(0) {}
+
+SubmitTimeline::~SubmitTimeline() = default;
+
+VkResult SubmitTimeline::init(VkDevice device)
+{
+    VkSemaphoreTypeCreateInfoKHR semaphoreTypeInfo = {};
+
+    semaphoreTypeInfo.sType         = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO_KHR;
+    semaphoreTypeInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE_KHR;
+    semaphoreTypeInfo.initialValue  = 0;
+
+    VkSemaphoreCreateInfo semaphoreInfo = {};
+    semaphoreInfo.sType                 = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+    semaphoreInfo.pNext                 = &semaphoreTypeInfo;
+
+    mLastSignalValue    = 0;
+    mLastCompletedValue = 0;
+    return mSemaphore.init(device, semaphoreInfo);
+}
+
+void SubmitTimeline::destroy(VkDevice device)
+{
+    mSemaphore.destroy(device);
+}
+
+VkResult SubmitTimeline::refresh(VkDevice device)
+{
+    uint64_t counterValue = 0;
+
+    VkResult result = vkGetSemaphoreCounterValueKHR(device, mSemaphore.getHandle(), &counterValue);
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    // Other threads may be updating the value too; keep the highest one.
+    uint64_t lastCompletedValue = mLastCompletedValue.load(std::memory_order_relaxed);
+    while (lastCompletedValue < counterValue &&
+           !mLastCompletedValue.compare_exchange_weak(lastCompletedValue, counterValue,
+                                                      std::memory_order_release,
+                                                      std::memory_order_relaxed))
+    {
+    }
+
+    return VK_SUCCESS;
+}
+
+VkResult SubmitTimeline::getStatus(VkDevice device, uint64_t value)
+{
+    if (hasReached(value))
+    {
+        return VK_SUCCESS;
+    }
+
+    VkResult result = refresh(device);
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+    return hasReached(value) ? VK_SUCCESS : VK_NOT_READY;
+}
+
+VkResult SubmitTimeline::wait(VkDevice device, uint64_t value, uint64_t timeout)
+{
+    if (hasReached(value))
+    {
+        return VK_SUCCESS;
+    }
+
+    const VkSemaphore semaphore = mSemaphore.getHandle();
+
+    VkSemaphoreWaitInfoKHR waitInfo = {};
+    waitInfo.sType                  = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO_KHR;
+    waitInfo.semaphoreCount         = 1;
+    waitInfo.pSemaphores            = &semaphore;
+    waitInfo.pValues                = &value;
+
+    VkResult result = vkWaitSemaphoresKHR(device, &waitInfo, timeout);
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    // Refresh the cached value, which may show more batches than the one waited on as finished.
+    return refresh(device);
+}
+
 // CommandBatch implementation.
-CommandBatch::CommandBatch() : protectionType(ProtectionType::InvalidEnum) {}
+CommandBatch::CommandBatch()
+    : timeline(nullptr), timelineValue(0), protectionType(ProtectionType::InvalidEnum)
+{}
 
 CommandBatch::~CommandBatch() = default;
 
@@ -471,6 +562,8 @@ CommandBatch &CommandBatch::operator=(CommandBatch &&other)
     std::swap(secondaryCommands, other.secondaryCommands);
     std::swap(fence, other.fence);
     std::swap(externalFence, other.externalFence);
+    std::swap(timeline, other.timeline);
+    std::swap(timelineValue, other.timelineValue);
     std::swap(queueSerial, other.queueSerial);
     std::swap(protectionType, other.protectionType);
     return *this;
@@ -487,36 +580,49 @@ void CommandBatch::destroy(VkDevice device)
 bool CommandBatch::hasFence() const
 {
     ASSERT(!externalFence || !fence);
-    return fence || externalFence;
+    ASSERT(timeline == nullptr || (!fence && !externalFence));
+    return fence || externalFence || timeline != nullptr;
 }
 
 void CommandBatch::releaseFence()
 {
     fence.release();
     externalFence.reset();
+    timeline      = nullptr;
+    timelineValue = 0;
 }
 
 void CommandBatch::destroyFence(VkDevice device)
 {
     fence.destroy(device);
     externalFence.reset();
+    timeline      = nullptr;
+    timelineValue = 0;
 }
 
 VkFence CommandBatch::getFenceHandle() const
 {
-    ASSERT(hasFence());
+    ASSERT(fence || externalFence);
     return fence ? fence.get().getHandle() : externalFence->getHandle();
 }
 
 VkResult CommandBatch::getFenceStatus(VkDevice device) const
 {
     ASSERT(hasFence());
+    if (timeline != nullptr)
+    {
+        return timeline->getStatus(device, timelineValue);
+    }
     return fence ? fence.getStatus(device) : externalFence->getStatus(device);
 }
 
 VkResult CommandBatch::waitFence(VkDevice device, uint64_t timeout) const
 {
     ASSERT(hasFence());
+    if (timeline != nullptr)
+    {
+        return timeline->wait(device, timelineValue, timeout);
+    }
     return fence ? fence.wait(device, timeout) : externalFence->wait(device, timeout);
 }
 
@@ -528,7 +634,16 @@ VkResult CommandBatch::waitFenceUnlocked(VkDevice device,
     VkResult status;
     // You can only use the local copy of the fence without lock.
     // Do not access "this" after unlock() because object might be deleted from other thread.
-    if (fence)
+    if (timeline != nullptr)
+    {
+        // The timeline outlives the batch, it is only destroyed with the CommandQueue.
+        SubmitTimeline *localTimeline = timeline;
+        const uint64_t localValue     = timelineValue;
+        lock->unlock();
+        status = localTimeline->wait(device, localValue, timeout);
+        lock->lock();
+    }
+    else if (fence)
     {
         const SharedFence localFenceToWaitOn = fence;
         lock->unlock();
@@ -683,22 +798,44 @@ angle::Result CommandProcessor::processTasksImpl(bool *exitThread)
         std::lock_guard<angle::SimpleMutex> dequeueLock(mTaskDequeueMutex);
         if (!mTaskQueue.empty())
         {
-            CommandProcessorTask task(std::move(mTaskQueue.front()));
-            mTaskQueue.pop();
-
-            // Artificially make the task take longer to catch threading issues.
-            if (getFeatures().slowAsyncCommandQueueForTesting.enabled)
+            // When coalescing submissions, process all the tasks that are already queued while
+            // holding the dequeue lock, and make their submissions in as few vkQueueSubmit2 calls
+            // as possible.  The deferred submissions are flushed before the lock is released, so
+            // other threads never observe them.
+            const bool coalesceSubmits = getFeatures().coalesceAsyncQueueSubmits.enabled;
+            const size_t maxTaskCount  = coalesceSubmits ? mTaskQueue.size() : 1;
+
+            for (size_t taskCount = 0; taskCount < maxTaskCount; ++taskCount)
             {
-                constexpr double kSlowdownTime = 0.005;
+                CommandProcessorTask task(std::move(mTaskQueue.front()));
+                mTaskQueue.pop();
+
+                // Artificially make the task take longer to catch threading issues.
+                if (getFeatures().slowAsyncCommandQueueForTesting.enabled)
+                {
+                    constexpr double kSlowdownTime = 0.005;
+
+                    double startTime = angle::GetCurrentSystemTime();
+                    while (angle::GetCurrentSystemTime() - startTime < kSlowdownTime)
+                    {
+                        // Busy waiting
+                    }
+                }
 
-                double startTime = angle::GetCurrentSystemTime();
-                while (angle::GetCurrentSystemTime() - startTime < kSlowdownTime)
+                if (coalesceSubmits)
                 {
-                    // Busy waiting
+                    ANGLE_TRY(processOrDeferTask(&task));
+                }
+                else
+                {
+                    ANGLE_TRY(processTask(&task));
                 }
             }
 
-            ANGLE_TRY(processTask(&task));
+            if (coalesceSubmits)
+            {
+                ANGLE_TRY(mCommandQueue->flushDeferredSubmits(this));
+            }
         }
 
         if (mNeedCommandsAndGarbageCleanup.exchange(false))
@@ -805,6 +942,36 @@ angle::Result CommandProcessor::processTask(CommandProcessorTask *task)
     return angle::Result::Continue;
 }
 
+angle::Result CommandProcessor::processOrDeferTask(CommandProcessorTask *task)
+{
+    const CustomTask taskCommand = task->getTaskCommand();
+
+    if (taskCommand == CustomTask::FlushAndQueueSubmit && !task->getExternalFence())
+    {
+        // Deferred submissions all go to the same queue.
+        if (!mCommandQueue->canDeferSubmit(task->getPriority()))
+        {
+            ANGLE_TRY(mCommandQueue->flushDeferredSubmits(this));
+        }
+
+        ANGLE_TRY(mCommandQueue->deferSubmitCommands(this, task->getProtectionType(),
+                                                     task->getPriority(), task->getSemaphore(),
+                                                     task->getSubmitQueueSerial()));
+        mNeedCommandsAndGarbageCleanup = true;
+        return angle::Result::Continue;
+    }
+
+    // Anything else that goes to the queue must come after the deferred submissions.  Tasks that
+    // only record commands don't need to flush them.
+    if (taskCommand == CustomTask::FlushAndQueueSubmit ||
+        taskCommand == CustomTask::OneOffQueueSubmit || taskCommand == CustomTask::Present)
+    {
+        ANGLE_TRY(mCommandQueue->flushDeferredSubmits(this));
+    }
+
+    return processTask(task);
+}
+
 angle::Result CommandProcessor::waitForAllWorkToBeSubmitted(Context *context)
 {
     ANGLE_TRACE_EVENT0("gpu.angle", "CommandProcessor::waitForAllWorkToBeSubmitted");
@@ -1078,6 +1245,7 @@ angle::Result CommandProcessor::waitForPresentToBeSubmitted(SwapchainStatus *swa
 CommandQueue::CommandQueue()
     : mInFlightCommands(kInFlightCommandsLimit),
       mFinishedCommandBatches(kMaxFinishedCommandsLimit),
+      mDeferredSubmitPriority(egl::ContextPriority::InvalidEnum),
       mPerfCounters{}
 {}
 
@@ -1106,6 +1274,8 @@ void CommandQueue::destroy(Context *context)
         }
     }
 
+    destroyDeferredSubmits(renderer->getDevice());
+
     for (PersistentCommandPool &commandPool : mPrimaryCommandPoolMap)
     {
         commandPool.destroy(renderer->getDevice());
@@ -1113,6 +1283,11 @@ void CommandQueue::destroy(Context *context)
 
     mFenceRecycler.destroy(context);
 
+    for (SubmitTimeline &timeline : mSubmitTimelines)
+    {
+        timeline.destroy(renderer->getDevice());
+    }
+
     ASSERT(mInFlightCommands.empty());
     ASSERT(mFinishedCommandBatches.empty());
 }
@@ -1136,6 +1311,14 @@ angle::Result CommandQueue::init(Context *context,
         ANGLE_TRY(initCommandPool(context, ProtectionType::Protected));
     }
 
+    if (context->getFeatures().useTimelineSemaphoreForQueueCompletion.enabled)
+    {
+        for (SubmitTimeline &timeline : mSubmitTimelines)
+        {
+            ANGLE_VK_TRY(context, timeline.init(context->getDevice()));
+        }
+    }
+
     return angle::Result::Continue;
 }
 
@@ -1172,6 +1355,19 @@ void CommandQueue::handleDeviceLost(vk::Renderer *renderer)
         mLastCompletedSerials.setQueueSerial(batch.queueSerial);
         mInFlightCommands.pop();
     }
+
+    destroyDeferredSubmits(device);
+}
+
+void CommandQueue::destroyDeferredSubmits(VkDevice device)
+{
+    for (DeferredSubmit &submit : mDeferredSubmits)
+    {
+        // These were never submitted, so there is nothing to wait for.
+        submit.batch.destroy(device);
+        mLastCompletedSerials.setQueueSerial(submit.batch.queueSerial);
+    }
+    mDeferredSubmits.clear();
 }
 
 angle::Result CommandQueue::postSubmitCheck(Context *context)
@@ -1437,13 +1633,14 @@ angle::Result CommandQueue::submitCommands(Context *context,
             submitInfo.pNext                    = &protectedSubmitInfo;
         }
 
-        if (!externalFence)
+        // With a timeline semaphore, queueSubmit() assigns the batch its signal value instead.
+        if (externalFence)
         {
-            ANGLE_VK_TRY(context, batch.fence.init(context->getDevice(), &mFenceRecycler));
+            batch.externalFence = std::move(externalFence);
         }
-        else
+        else if (!context->getFeatures().useTimelineSemaphoreForQueueCompletion.enabled)
         {
-            batch.externalFence = std::move(externalFence);
+            ANGLE_VK_TRY(context, batch.fence.init(context->getDevice(), &mFenceRecycler));
         }
 
         ++mPerfCounters.vkQueueSubmitCallsTotal;
@@ -1461,6 +1658,216 @@ angle::Result CommandQueue::submitCommands(Context *context,
     return angle::Result::Continue;
 }
 
+angle::Result CommandQueue::deferSubmitCommands(Context *context,
+                                                ProtectionType protectionType,
+                                                egl::ContextPriority priority,
+                                                VkSemaphore signalSemaphore,
+                                                const QueueSerial &submitQueueSerial)
+{
+    ANGLE_TRACE_EVENT0("gpu.angle", "CommandQueue::deferSubmitCommands");
+    std::lock_guard<angle::SimpleMutex> lock(mMutex);
+    ASSERT(canDeferSubmit(priority));
+
+    ++mPerfCounters.commandQueueSubmitCallsTotal;
+    ++mPerfCounters.commandQueueSubmitCallsPerFrame;
+
+    mDeferredSubmits.emplace_back();
+    mDeferredSubmitPriority = priority;
+
+    DeferredSubmit &submit = mDeferredSubmits.back();
+    CommandBatch &batch    = submit.batch;
+
+    batch.queueSerial    = submitQueueSerial;
+    batch.protectionType = protectionType;
+
+    CommandsState &state    = mCommandsStateMap[priority][protectionType];
+    batch.primaryCommands   = std::move(state.primaryCommands);
+    batch.secondaryCommands = std::move(state.secondaryCommands);
+    ASSERT(batch.primaryCommands.valid() || batch.secondaryCommands.empty());
+
+    submit.waitSemaphores          = std::move(state.waitSemaphores);
+    submit.waitSemaphoreStageMasks = std::move(state.waitSemaphoreStageMasks);
+    submit.signalSemaphore         = signalSemaphore;
+    state.waitSemaphores.clear();
+    state.waitSemaphoreStageMasks.clear();
+
+    mPerfCounters.commandQueueWaitSemaphoresTotal += submit.waitSemaphores.size();
+
+    // Don't make a submission if there is nothing to submit.
+    submit.needsQueueSubmit = batch.primaryCommands.valid() || signalSemaphore != VK_NULL_HANDLE ||
+                              !submit.waitSemaphores.empty();
+
+    if (batch.primaryCommands.valid())
+    {
+        ANGLE_VK_TRY(context, batch.primaryCommands.end());
+    }
+
+    return angle::Result::Continue;
+}
+
+angle::Result CommandQueue::flushDeferredSubmits(Context *context)
+{
+    std::unique_lock<angle::SimpleMutex> lock(mMutex);
+    if (mDeferredSubmits.empty())
+    {
+        return angle::Result::Continue;
+    }
+
+    ANGLE_TRACE_EVENT0("gpu.angle", "CommandQueue::flushDeferredSubmits");
+    vk::Renderer *renderer = context->getRenderer();
+
+    // Reserve up front, as the submit infos point into these arrays.  One more semaphore may be
+    // added to signal the timeline semaphore.
+    size_t semaphoreCount = 1;
+    for (const DeferredSubmit &submit : mDeferredSubmits)
+    {
+        semaphoreCount += submit.waitSemaphores.size() + 1;
+    }
+
+    std::vector<VkSubmitInfo2KHR> submitInfos;
+    std::vector<VkCommandBufferSubmitInfoKHR> commandBufferInfos;
+    std::vector<VkSemaphoreSubmitInfoKHR> semaphoreInfos;
+    submitInfos.reserve(mDeferredSubmits.size());
+    commandBufferInfos.reserve(mDeferredSubmits.size());
+    semaphoreInfos.reserve(semaphoreCount);
+
+    for (const DeferredSubmit &submit : mDeferredSubmits)
+    {
+        if (!submit.needsQueueSubmit)
+        {
+            continue;
+        }
+
+        const CommandBatch &batch   = submit.batch;
+        VkSubmitInfo2KHR submitInfo = {};
+        submitInfo.sType            = VK_STRUCTURE_TYPE_SUBMIT_INFO_2_KHR;
+
+        // No need protected submission if no commands to submit.
+        if (batch.protectionType == ProtectionType::Protected && batch.primaryCommands.valid())
+        {
+            submitInfo.flags = VK_SUBMIT_PROTECTED_BIT_KHR;
+        }
+
+        ASSERT(submit.waitSemaphores.size() == submit.waitSemaphoreStageMasks.size());
+        submitInfo.waitSemaphoreInfoCount = static_cast<uint32_t>(submit.waitSemaphores.size());
+        submitInfo.pWaitSemaphoreInfos    = semaphoreInfos.data() + semaphoreInfos.size();
+        for (size_t index = 0; index < submit.waitSemaphores.size(); ++index)
+        {
+            // The VkPipelineStageFlags bits have the same values in VkPipelineStageFlags2.
+            VkSemaphoreSubmitInfoKHR waitInfo = {};
+            waitInfo.sType                    = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO_KHR;
+            waitInfo.semaphore                = submit.waitSemaphores[index];
+            waitInfo.stageMask                = submit.waitSemaphoreStageMasks[index];
+            semaphoreInfos.push_back(waitInfo);
+        }
+
+        if (batch.primaryCommands.valid())
+        {
+            VkCommandBufferSubmitInfoKHR commandBufferInfo = {};
+
+            commandBufferInfo.sType         = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO_KHR;
+            commandBufferInfo.commandBuffer = batch.primaryCommands.getHandle();
+            commandBufferInfos.push_back(commandBufferInfo);
+
+            submitInfo.commandBufferInfoCount = 1;
+            submitInfo.pCommandBufferInfos    = &commandBufferInfos.back();
+        }
+
+        if (submit.signalSemaphore != VK_NULL_HANDLE)
+        {
+            VkSemaphoreSubmitInfoKHR signalInfo = {};
+            signalInfo.sType                    = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO_KHR;
+            signalInfo.semaphore                = submit.signalSemaphore;
+            signalInfo.stageMask                = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT_KHR;
+            semaphoreInfos.push_back(signalInfo);
+
+            submitInfo.signalSemaphoreInfoCount = 1;
+            submitInfo.pSignalSemaphoreInfos    = &semaphoreInfos.back();
+        }
+
+        submitInfos.push_back(submitInfo);
+    }
+
+    // All batches share the fence (or timeline semaphore value) of the single vkQueueSubmit2
+    // call.  This only delays noticing the completion of the earlier batches, which the GPU
+    // executes in order anyway.
+    const bool useTimeline = context->getFeatures().useTimelineSemaphoreForQueueCompletion.enabled;
+    SharedFence fence;
+    if (!submitInfos.empty())
+    {
+        if (!useTimeline)
+        {
+            ANGLE_VK_TRY(context, fence.init(context->getDevice(), &mFenceRecycler));
+        }
+
+        ++mPerfCounters.vkQueueSubmitCallsTotal;
+        ++mPerfCounters.vkQueueSubmitCallsPerFrame;
+    }
+
+    // Same lock relay as queueSubmit().  mDeferredSubmits is only accessed with the
+    // CommandProcessor's dequeue lock held, so it can still be used after mMutex is released.
+    std::lock_guard<angle::SimpleMutex> queueSubmitLock(mQueueSubmitMutex);
+    while (mInFlightCommands.size() + mDeferredSubmits.size() > mInFlightCommands.capacity())
+    {
+        ANGLE_TRY(finishOneCommandBatchAndCleanupImpl(context, renderer->getMaxFenceWaitTimeNs()));
+    }
+    lock.unlock();
+
+    SubmitTimeline &timeline = mSubmitTimelines[mDeferredSubmitPriority];
+    uint64_t signalValue     = 0;
+    if (useTimeline && !submitInfos.empty())
+    {
+        // The value must be allocated in submission order, so only now that mQueueSubmitMutex is
+        // held.  The last submission signals it; the semaphores it already signals are at the
+        // end of semaphoreInfos, so the timeline semaphore can be appended to them.
+        signalValue = timeline.allocateSignalValue();
+
+        VkSemaphoreSubmitInfoKHR signalInfo = {};
+        signalInfo.sType                    = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO_KHR;
+        signalInfo.semaphore                = timeline.getHandle();
+        signalInfo.value                    = signalValue;
+        signalInfo.stageMask                = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT_KHR;
+        semaphoreInfos.push_back(signalInfo);
+
+        VkSubmitInfo2KHR &lastSubmitInfo = submitInfos.back();
+        if (lastSubmitInfo.signalSemaphoreInfoCount == 0)
+        {
+            lastSubmitInfo.pSignalSemaphoreInfos = &semaphoreInfos.back();
+        }
+        ++lastSubmitInfo.signalSemaphoreInfoCount;
+    }
+
+    if (!submitInfos.empty())
+    {
+        VkQueue queue = getQueue(mDeferredSubmitPriority);
+        ANGLE_VK_TRY(context, vkQueueSubmit2KHR(queue, static_cast<uint32_t>(submitInfos.size()),
+                                                submitInfos.data(),
+                                                fence ? fence.get().getHandle() : VK_NULL_HANDLE));
+    }
+
+    for (DeferredSubmit &submit : mDeferredSubmits)
+    {
+        const QueueSerial queueSerial = submit.batch.queueSerial;
+        if (fence)
+        {
+            submit.batch.fence = fence;
+        }
+        else if (signalValue != 0)
+        {
+            submit.batch.timeline      = &timeline;
+            submit.batch.timelineValue = signalValue;
+        }
+        mInFlightCommands.push(std::move(submit.batch));
+
+        // This must set last so that when this submission appears submitted, it actually already
+        // submitted and enqueued to mInFlightCommands.
+        mLastSubmittedSerials.setQueueSerial(queueSerial);
+    }
+    mDeferredSubmits.clear();
+
+    return angle::Result::Continue;
+}
+
 angle::Result CommandQueue::queueSubmitOneOff(Context *context,
                                               ProtectionType protectionType,
                                               egl::ContextPriority contextPriority,
@@ -1476,7 +1883,10 @@ angle::Result CommandQueue::queueSubmitOneOff(Context *context,
     batch.queueSerial    = submitQueueSerial;
     batch.protectionType = protectionType;
 
-    ANGLE_VK_TRY(context, batch.fence.init(context->getDevice(), &mFenceRecycler));
+    if (!context->getFeatures().useTimelineSemaphoreForQueueCompletion.enabled)
+    {
+        ANGLE_VK_TRY(context, batch.fence.init(context->getDevice(), &mFenceRecycler));
+    }
 
     VkSubmitInfo submitInfo = {};
     submitInfo.sType        = VK_STRUCTURE_TYPE_SUBMIT_INFO;
@@ -1543,9 +1953,16 @@ angle::Result CommandQueue::queueSubmit(Context *context,
         CommandBatch &batch = commandBatch.get();
 
         VkQueue queue = getQueue(contextPriority);
-        VkFence fence = batch.getFenceHandle();
-        ASSERT(fence != VK_NULL_HANDLE);
-        ANGLE_VK_TRY(context, vkQueueSubmit(queue, 1, &submitInfo, fence));
+        if (batch.fence || batch.externalFence)
+        {
+            VkFence fence = batch.getFenceHandle();
+            ASSERT(fence != VK_NULL_HANDLE);
+            ANGLE_VK_TRY(context, vkQueueSubmit(queue, 1, &submitInfo, fence));
+        }
+        else
+        {
+            ANGLE_TRY(queueSubmitWithTimeline(context, queue, contextPriority, submitInfo, &batch));
+        }
 
         if (batch.externalFence)
         {
@@ -1570,6 +1987,49 @@ angle::Result CommandQueue::queueSubmit(Context *context,
     return angle::Result::Continue;
 }
 
+angle::Result CommandQueue::queueSubmitWithTimeline(Context *context,
+                                                    VkQueue queue,
+                                                    egl::ContextPriority contextPriority,
+                                                    const VkSubmitInfo &submitInfo,
+                                                    CommandBatch *batch)
+{
+    SubmitTimeline &timeline = mSubmitTimelines[contextPriority];
+    ASSERT(timeline.valid());
+
+    // Add the timeline semaphore to the semaphores signaled by the submission.  The value of
+    // binary semaphores is ignored.
+    ASSERT(submitInfo.signalSemaphoreCount <= 1);
+    std::array<VkSemaphore, 2> signalSemaphores = {};
+    std::array<uint64_t, 2> signalValues        = {};
+    uint32_t signalSemaphoreCount               = 0;
+    if (submitInfo.signalSemaphoreCount == 1)
+    {
+        signalSemaphores[signalSemaphoreCount++] = submitInfo.pSignalSemaphores[0];
+    }
+    const uint64_t signalValue             = timeline.allocateSignalValue();
+    signalSemaphores[signalSemaphoreCount] = timeline.getHandle();
+    signalValues[signalSemaphoreCount]     = signalValue;
+    ++signalSemaphoreCount;
+
+    VkTimelineSemaphoreSubmitInfoKHR timelineInfo = {};
+
+    timelineInfo.sType                     = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR;
+    timelineInfo.pNext                     = submitInfo.pNext;
+    timelineInfo.signalSemaphoreValueCount = signalSemaphoreCount;
+    timelineInfo.pSignalSemaphoreValues    = signalValues.data();
+
+    VkSubmitInfo timelineSubmitInfo         = submitInfo;
+    timelineSubmitInfo.pNext                = &timelineInfo;
+    timelineSubmitInfo.signalSemaphoreCount = signalSemaphoreCount;
+    timelineSubmitInfo.pSignalSemaphores    = signalSemaphores.data();
+
+    ANGLE_VK_TRY(context, vkQueueSubmit(queue, 1, &timelineSubmitInfo, VK_NULL_HANDLE));
+
+    batch->timeline      = &timeline;
+    batch->timelineValue = signalValue;
+    return angle::Result::Continue;
+}
+
 void CommandQueue::queuePresent(egl::ContextPriority contextPriority,
                                 const VkPresentInfoKHR &presentInfo,
                                 SwapchainStatus *swapchainStatus)
@@ -1710,8 +2170,26 @@ angle::Result CommandQueue::retireFinishedCommandsLocked(Context *context)
 
 angle::Result CommandQueue::checkCompletedCommandsLocked(Context *context)
 {
+    // Timeline semaphores are queried at most once per check.  A single query shows all the
+    // batches on that queue up to the returned value as finished.
+    SubmitTimeline *refreshedTimeline = nullptr;
     while (!mInFlightCommands.empty())
     {
+        const CommandBatch &batch = mInFlightCommands.front();
+        if (batch.timeline != nullptr && !batch.timeline->hasReached(batch.timelineValue))
+        {
+            if (batch.timeline == refreshedTimeline)
+            {
+                break;
+            }
+            ANGLE_VK_TRY(context, batch.timeline->refresh(context->getDevice()));
+            refreshedTimeline = batch.timeline;
+            if (!batch.timeline->hasReached(batch.timelineValue))
+            {
+                break;
+            }
+        }
+
         bool finished;
         ANGLE_TRY(checkOneCommandBatch(context, &finished));
         if (!finished)
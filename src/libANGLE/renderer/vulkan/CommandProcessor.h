@@ -258,6 +258,44 @@ class CommandProcessorTask
 };
 using CommandProcessorTaskQueue = angle::FixedQueue<CommandProcessorTask>;
 
+// A timeline semaphore that every submission to one VkQueue signals, each time with a value one
+// higher than the previous submission.  With the useTimelineSemaphoreForQueueCompletion feature,
+// command batches track their completion with the value their submission signals instead of a
+// VkFence each.
+class SubmitTimeline final : angle::NonCopyable
+{
+  public:
+    SubmitTimeline();
+    ~SubmitTimeline();
+
+    VkResult init(VkDevice device);
+    void destroy(VkDevice device);
+    bool valid() const { return mSemaphore.valid(); }
+    VkSemaphore getHandle() const { return mSemaphore.getHandle(); }
+
+    // Returns the value for the next submission to signal.  Must be called in submission order,
+    // i.e. with CommandQueue::mQueueSubmitMutex held.
+    uint64_t allocateSignalValue() { return ++mLastSignalValue; }
+
+    // Whether |value| is known to be reached, without querying the semaphore.
+    bool hasReached(uint64_t value) const
+    {
+        return value <= mLastCompletedValue.load(std::memory_order_acquire);
+    }
+    // Queries the current value of the semaphore.
+    VkResult refresh(VkDevice device);
+
+    VkResult getStatus(VkDevice device, uint64_t value);
+    VkResult wait(VkDevice device, uint64_t value, uint64_t timeout);
+
+  private:
+    Semaphore mSemaphore;
+    uint64_t mLastSignalValue;
+    // The last value known to be reached.  Once a query returns a value, the batches before it
+    // are known to be finished without querying the semaphore again.
+    std::atomic<uint64_t> mLastCompletedValue;
+};
+
 struct CommandBatch final : angle::NonCopyable
 {
     CommandBatch();
@@ -281,6 +319,10 @@ struct CommandBatch final : angle::NonCopyable
     SecondaryCommandBufferCollector secondaryCommands;
     SharedFence fence;
     SharedExternalFence externalFence;
+    // Used instead of |fence| with the useTimelineSemaphoreForQueueCompletion feature.  The
+    // batch is finished once |timeline| reaches |timelineValue|.
+    SubmitTimeline *timeline;
+    uint64_t timelineValue;
     QueueSerial queueSerial;
     ProtectionType protectionType;
 };
@@ -443,6 +485,22 @@ class CommandQueue : angle::NonCopyable
                                     SubmitPolicy submitPolicy,
                                     const QueueSerial &submitQueueSerial);
 
+    // Like submitCommands(), but only prepares the submission.  The vkQueueSubmit2 call is made
+    // by flushDeferredSubmits(), together with the other deferred submissions.  These are only
+    // used by CommandProcessor with its dequeue lock held, which flushes the deferred submissions
+    // before anything else is submitted to the queue and before releasing that lock.  Submissions
+    // with an external fence cannot be deferred.
+    bool canDeferSubmit(egl::ContextPriority priority) const
+    {
+        return mDeferredSubmits.empty() || mDeferredSubmitPriority == priority;
+    }
+    angle::Result deferSubmitCommands(Context *context,
+                                      ProtectionType protectionType,
+                                      egl::ContextPriority priority,
+                                      VkSemaphore signalSemaphore,
+                                      const QueueSerial &submitQueueSerial);
+    angle::Result flushDeferredSubmits(Context *context);
+
     // Errors from present is not considered to be fatal.
     void queuePresent(egl::ContextPriority contextPriority,
                       const VkPresentInfoKHR &presentInfo,
@@ -521,11 +579,21 @@ class CommandQueue : angle::NonCopyable
                               const VkSubmitInfo &submitInfo,
                               DeviceScoped<CommandBatch> &commandBatch,
                               const QueueSerial &submitQueueSerial);
+    // Submits with the timeline semaphore of the queue signaling the next value, instead of a
+    // fence.  Called by queueSubmit() with mQueueSubmitMutex held.
+    angle::Result queueSubmitWithTimeline(Context *context,
+                                          VkQueue queue,
+                                          egl::ContextPriority contextPriority,
+                                          const VkSubmitInfo &submitInfo,
+                                          CommandBatch *batch);
 
     angle::Result ensurePrimaryCommandBufferValid(Context *context,
                                                   ProtectionType protectionType,
                                                   egl::ContextPriority priority);
 
+    // Destroys the deferred submissions without submitting them, on device loss or destruction.
+    void destroyDeferredSubmits(VkDevice device);
+
     using CommandsStateMap =
         angle::PackedEnumMap<egl::ContextPriority,
                              angle::PackedEnumMap<ProtectionType, CommandsState>>;
@@ -548,6 +616,20 @@ class CommandQueue : angle::NonCopyable
     CommandBatchQueue mFinishedCommandBatches;
 
     CommandsStateMap mCommandsStateMap;
+
+    // Submissions prepared by deferSubmitCommands() and not yet submitted, in submission order.
+    // They all target the queue of mDeferredSubmitPriority.
+    struct DeferredSubmit
+    {
+        CommandBatch batch;
+        std::vector<VkSemaphore> waitSemaphores;
+        std::vector<VkPipelineStageFlags> waitSemaphoreStageMasks;
+        VkSemaphore signalSemaphore = VK_NULL_HANDLE;
+        bool needsQueueSubmit       = false;
+    };
+    std::vector<DeferredSubmit> mDeferredSubmits;
+    egl::ContextPriority mDeferredSubmitPriority;
+
     // Keeps a free list of reusable primary command buffers.
     PrimaryCommandPoolMap mPrimaryCommandPoolMap;
 
@@ -562,6 +644,9 @@ class CommandQueue : angle::NonCopyable
     DeviceQueueMap mQueueMap;
 
     FenceRecycler mFenceRecycler;
+    // One timeline per priority, as each priority submits to a single VkQueue.  Only valid with
+    // the useTimelineSemaphoreForQueueCompletion feature.
+    angle::PackedEnumMap<egl::ContextPriority, SubmitTimeline> mSubmitTimelines;
 
     angle::VulkanPerfCounters mPerfCounters;
 };
@@ -681,6 +766,9 @@ class CommandProcessor : public Context
 
     // Command processor thread, process a task
     angle::Result processTask(CommandProcessorTask *task);
+    // Same as processTask, except that queue submissions are deferred when possible, so that
+    // consecutive ones can be coalesced.  Used with the coalesceAsyncQueueSubmits feature.
+    angle::Result processOrDeferTask(CommandProcessorTask *task);
 
     VkResult present(egl::ContextPriority priority,
                      const VkPresentInfoKHR &presentInfo,
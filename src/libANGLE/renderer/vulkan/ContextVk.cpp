@@ -15,6 +15,7 @@
 #include "common/utilities.h"
 #include "image_util/loadimage.h"
 #include "libANGLE/Context.h"
+#include "libANGLE/Context.inl.h"
 #include "libANGLE/Display.h"
 #include "libANGLE/Program.h"
 #include "libANGLE/Semaphore.h"
@@ -43,6 +44,7 @@
 #include "libANGLE/renderer/vulkan/VertexArrayVk.h"
 #include "libANGLE/renderer/vulkan/vk_renderer.h"
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <sstream>
@@ -170,6 +172,9 @@ constexpr gl::ShaderMap<vk::ImageLayout> kShaderWriteImageLayouts = {
 constexpr VkBufferUsageFlags kVertexBufferUsage = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT;
 constexpr size_t kDynamicVertexDataSize         = 16 * 1024;
 
+// Initial size of the buffer that descriptors are copied to when VK_EXT_descriptor_buffer is used.
+constexpr size_t kDescriptorBufferStorageInitialSize = 64 * 1024;
+
 bool CanMultiDrawIndirectUseCmd(ContextVk *contextVk,
                                 VertexArrayVk *vertexArray,
                                 gl::PrimitiveMode mode,
@@ -194,6 +199,40 @@ bool CanMultiDrawIndirectUseCmd(ContextVk *contextVk,
     return canMultiDrawIndirectUseCmd;
 }
 
+bool CanMultiDrawUseCmd(const ContextVk *contextVk,
+                        VertexArrayVk *vertexArray,
+                        const gl::ProgramExecutable *executable,
+                        gl::PrimitiveMode mode,
+                        GLsizei drawcount)
+{
+    // Use the generic implementation if VK_EXT_multi_draw is not supported, if line loop is being
+    // used, if drawcount is greater than maxMultiDrawCount, or if there are streaming vertex
+    // attributes.  gl_DrawID is emulated with a uniform that must change between draws, so
+    // programs using it also need the generic implementation.  The same is true of transform
+    // feedback emulation, which relies on the first vertex of each draw.
+    if (!contextVk->getFeatures().supportsMultiDraw.enabled || drawcount <= 1 ||
+        mode == gl::PrimitiveMode::LineLoop)
+    {
+        return false;
+    }
+
+    const bool isDrawCountBeyondLimit =
+        static_cast<uint32_t>(drawcount) > contextVk->getRenderer()->getMaxMultiDrawCount();
+    const bool isMultiDrawWithStreamingAttribs = vertexArray->getStreamingVertexAttribsMask().any();
+    const bool isXfbEmulated = contextVk->getFeatures().emulateTransformFeedback.enabled &&
+                               contextVk->getState().isTransformFeedbackActiveUnpaused();
+
+    return !isDrawCountBeyondLimit && !isMultiDrawWithStreamingAttribs && !isXfbEmulated &&
+           !executable->hasDrawIDUniform();
+}
+
+template <typename T>
+bool AreAllValuesEqual(const T *values, GLsizei count)
+{
+    return std::all_of(values + 1, values + count,
+                       [values](T value) { return value == values[0]; });
+}
+
 uint32_t GetCoverageSampleCount(const gl::State &glState, GLint samples)
 {
     ASSERT(glState.isSampleCoverageEnabled());
@@ -1268,6 +1307,7 @@ void ContextVk::onDestroy(const gl::Context *context)
     mShareGroupVk->cleanupRefCountedEventGarbage(mRenderer);
 
     mDefaultUniformStorage.release(mRenderer);
+    mDescriptorBufferStorage.release(mRenderer);
     mEmptyBuffer.release(mRenderer);
 
     for (vk::DynamicBuffer &defaultBuffer : mStreamedVertexBuffers)
@@ -1447,19 +1487,36 @@ angle::Result ContextVk::initialize(const angle::ImageLoadContext &imageLoadCont
 
     size_t minAlignment = static_cast<size_t>(
         mRenderer->getPhysicalDeviceProperties().limits.minUniformBufferOffsetAlignment);
-    mDefaultUniformStorage.init(mRenderer, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, minAlignment,
-                                mRenderer->getDefaultUniformBufferSize(), true);
+    // With descriptor buffers, the address of buffers is needed to write their descriptors.
+    const VkBufferUsageFlags deviceAddressUsage =
+        mRenderer->useDescriptorBuffer() ? VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT : 0;
+    mDefaultUniformStorage.init(mRenderer, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | deviceAddressUsage,
+                                minAlignment, mRenderer->getDefaultUniformBufferSize(), true);
+
+    if (mRenderer->useDescriptorBuffer())
+    {
+        constexpr VkBufferUsageFlags kDescriptorBufferUsage =
+            VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT |
+            VK_BUFFER_USAGE_SAMPLER_DESCRIPTOR_BUFFER_BIT_EXT |
+            VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+        size_t descriptorBufferAlignment =
+            static_cast<size_t>(mRenderer->getPhysicalDeviceDescriptorBufferProperties()
+                                    .descriptorBufferOffsetAlignment);
+        mDescriptorBufferStorage.init(mRenderer, kDescriptorBufferUsage, descriptorBufferAlignment,
+                                      kDescriptorBufferStorageInitialSize, true);
+    }
 
     // Initialize an "empty" buffer for use with default uniform blocks where there are no uniforms,
     // or atomic counter buffer array indices that are unused.
-    constexpr VkBufferUsageFlags kEmptyBufferUsage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT |
-                                                     VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
-                                                     VK_BUFFER_USAGE_VERTEX_BUFFER_BIT;
+    const VkBufferUsageFlags emptyBufferUsage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT |
+                                                VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
+                                                VK_BUFFER_USAGE_VERTEX_BUFFER_BIT |
+                                                deviceAddressUsage;
     VkBufferCreateInfo emptyBufferInfo          = {};
     emptyBufferInfo.sType                       = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
     emptyBufferInfo.flags                       = 0;
     emptyBufferInfo.size                        = 16;
-    emptyBufferInfo.usage                       = kEmptyBufferUsage;
+    emptyBufferInfo.usage                       = emptyBufferUsage;
     emptyBufferInfo.sharingMode                 = VK_SHARING_MODE_EXCLUSIVE;
     emptyBufferInfo.queueFamilyIndexCount       = 0;
     emptyBufferInfo.pQueueFamilyIndices         = nullptr;
@@ -3435,7 +3492,8 @@ angle::Result ContextVk::handleDirtyDescriptorSetsImpl(CommandBufferHelperT *com
 
     ProgramExecutableVk *executableVk = vk::GetImpl(mState.getProgramExecutable());
     return executableVk->bindDescriptorSets(this, commandBufferHelper,
-                                            &commandBufferHelper->getCommandBuffer(), pipelineType);
+                                            &commandBufferHelper->getCommandBuffer(), pipelineType,
+                                            &mDescriptorBufferStorage);
 }
 
 void ContextVk::syncObjectPerfCounters(const angle::VulkanPerfCounters &commandQueuePerfCounters)
@@ -4287,7 +4345,13 @@ angle::Result ContextVk::multiDrawArrays(const gl::Context *context,
                                          const GLsizei *counts,
                                          GLsizei drawcount)
 {
-    return rx::MultiDrawArraysGeneral(this, context, mode, firsts, counts, drawcount);
+    if (!CanMultiDrawUseCmd(this, getVertexArray(), mState.getProgramExecutable(), mode,
+                            drawcount))
+    {
+        return rx::MultiDrawArraysGeneral(this, context, mode, firsts, counts, drawcount);
+    }
+
+    return multiDrawArraysCmd(context, mode, firsts, counts, 1, 0, drawcount);
 }
 
 angle::Result ContextVk::multiDrawArraysInstanced(const gl::Context *context,
@@ -4297,8 +4361,15 @@ angle::Result ContextVk::multiDrawArraysInstanced(const gl::Context *context,
                                                   const GLsizei *instanceCounts,
                                                   GLsizei drawcount)
 {
-    return rx::MultiDrawArraysInstancedGeneral(this, context, mode, firsts, counts, instanceCounts,
-                                               drawcount);
+    if (!CanMultiDrawUseCmd(this, getVertexArray(), mState.getProgramExecutable(), mode,
+                            drawcount) ||
+        !AreAllValuesEqual(instanceCounts, drawcount))
+    {
+        return rx::MultiDrawArraysInstancedGeneral(this, context, mode, firsts, counts,
+                                                   instanceCounts, drawcount);
+    }
+
+    return multiDrawArraysCmd(context, mode, firsts, counts, instanceCounts[0], 0, drawcount);
 }
 
 angle::Result ContextVk::multiDrawArraysIndirect(const gl::Context *context,
@@ -4383,7 +4454,12 @@ angle::Result ContextVk::multiDrawElements(const gl::Context *context,
                                            const GLvoid *const *indices,
                                            GLsizei drawcount)
 {
-    return rx::MultiDrawElementsGeneral(this, context, mode, counts, type, indices, drawcount);
+    if (!canMultiDrawElementsUseCmd(mode, type, indices, drawcount))
+    {
+        return rx::MultiDrawElementsGeneral(this, context, mode, counts, type, indices, drawcount);
+    }
+
+    return multiDrawElementsCmd(context, mode, counts, type, indices, nullptr, 1, 0, drawcount);
 }
 
 angle::Result ContextVk::multiDrawElementsInstanced(const gl::Context *context,
@@ -4394,8 +4470,15 @@ angle::Result ContextVk::multiDrawElementsInstanced(const gl::Context *context,
                                                     const GLsizei *instanceCounts,
                                                     GLsizei drawcount)
 {
-    return rx::MultiDrawElementsInstancedGeneral(this, context, mode, counts, type, indices,
-                                                 instanceCounts, drawcount);
+    if (!canMultiDrawElementsUseCmd(mode, type, indices, drawcount) ||
+        !AreAllValuesEqual(instanceCounts, drawcount))
+    {
+        return rx::MultiDrawElementsInstancedGeneral(this, context, mode, counts, type, indices,
+                                                     instanceCounts, drawcount);
+    }
+
+    return multiDrawElementsCmd(context, mode, counts, type, indices, nullptr, instanceCounts[0],
+                                0, drawcount);
 }
 
 angle::Result ContextVk::multiDrawElementsIndirect(const gl::Context *context,
@@ -4507,8 +4590,18 @@ angle::Result ContextVk::multiDrawArraysInstancedBaseInstance(const gl::Context
                                                               const GLuint *baseInstances,
                                                               GLsizei drawcount)
 {
-    return rx::MultiDrawArraysInstancedBaseInstanceGeneral(
-        this, context, mode, firsts, counts, instanceCounts, baseInstances, drawcount);
+    // gl_BaseInstance is emulated with a uniform, which cannot change within a single command.
+    const gl::ProgramExecutable *executable = mState.getProgramExecutable();
+    if (!CanMultiDrawUseCmd(this, getVertexArray(), executable, mode, drawcount) ||
+        executable->hasBaseInstanceUniform() || !AreAllValuesEqual(instanceCounts, drawcount) ||
+        !AreAllValuesEqual(baseInstances, drawcount))
+    {
+        return rx::MultiDrawArraysInstancedBaseInstanceGeneral(
+            this, context, mode, firsts, counts, instanceCounts, baseInstances, drawcount);
+    }
+
+    return multiDrawArraysCmd(context, mode, firsts, counts, instanceCounts[0], baseInstances[0],
+                              drawcount);
 }
 
 angle::Result ContextVk::multiDrawElementsInstancedBaseVertexBaseInstance(
@@ -4522,9 +4615,144 @@ angle::Result ContextVk::multiDrawElementsInstancedBaseVertexBaseInstance(
     const GLuint *baseInstances,
     GLsizei drawcount)
 {
-    return rx::MultiDrawElementsInstancedBaseVertexBaseInstanceGeneral(
-        this, context, mode, counts, type, indices, instanceCounts, baseVertices, baseInstances,
-        drawcount);
+    // gl_BaseVertex and gl_BaseInstance are emulated with uniforms, which cannot change within a
+    // single command.  Without them, base vertices are given per draw to vkCmdDrawMultiIndexedEXT.
+    const gl::ProgramExecutable *executable = mState.getProgramExecutable();
+    if (!canMultiDrawElementsUseCmd(mode, type, indices, drawcount) ||
+        executable->hasBaseVertexUniform() || executable->hasBaseInstanceUniform() ||
+        !AreAllValuesEqual(instanceCounts, drawcount) ||
+        !AreAllValuesEqual(baseInstances, drawcount))
+    {
+        return rx::MultiDrawElementsInstancedBaseVertexBaseInstanceGeneral(
+            this, context, mode, counts, type, indices, instanceCounts, baseVertices,
+            baseInstances, drawcount);
+    }
+
+    return multiDrawElementsCmd(context, mode, counts, type, indices, baseVertices,
+                                instanceCounts[0], baseInstances[0], drawcount);
+}
+
+bool ContextVk::canMultiDrawElementsUseCmd(gl::PrimitiveMode mode,
+                                           gl::DrawElementsType type,
+                                           const GLvoid *const *indices,
+                                           GLsizei drawcount) const
+{
+    VertexArrayVk *vertexArrayVk = getVertexArray();
+    if (!CanMultiDrawUseCmd(this, vertexArrayVk, mState.getProgramExecutable(), mode, drawcount))
+    {
+        return false;
+    }
+
+    // Client-side index arrays and uint8 indices without hardware support are converted per draw.
+    if (vertexArrayVk->getState().getElementArrayBuffer() == nullptr ||
+        shouldConvertUint8VkIndexType(type))
+    {
+        return false;
+    }
+
+    // The index buffer is bound once at offset 0, and each draw's offset is turned into its
+    // firstIndex, which requires the offsets to be aligned to the index size.
+    const uintptr_t indexSizeMask = gl::GetDrawElementsTypeSize(type) - 1;
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        if ((reinterpret_cast<uintptr_t>(indices[drawID]) & indexSizeMask) != 0)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+angle::Result ContextVk::multiDrawArraysCmd(const gl::Context *context,
+                                            gl::PrimitiveMode mode,
+                                            const GLint *firsts,
+                                            const GLsizei *counts,
+                                            GLsizei instanceCount,
+                                            GLuint baseInstance,
+                                            GLsizei drawcount)
+{
+    mMultiDrawInfos.clear();
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        if (context->noopDrawInstanced(mode, counts[drawID], instanceCount))
+        {
+            continue;
+        }
+
+        VkMultiDrawInfoEXT drawInfo = {};
+        drawInfo.firstVertex        = firsts[drawID];
+        drawInfo.vertexCount        = gl::GetClampedVertexCount<uint32_t>(counts[drawID]);
+        mMultiDrawInfos.push_back(drawInfo);
+
+        gl::MarkTransformFeedbackBufferUsage(context, counts[drawID], instanceCount);
+    }
+
+    if (mMultiDrawInfos.empty())
+    {
+        return handleNoopDrawEvent();
+    }
+
+    // Neither streaming attributes nor transform feedback emulation are in use, so the vertex
+    // range passed here is unused beyond validation.
+    ANGLE_TRY(setupDraw(context, mode, mMultiDrawInfos[0].firstVertex,
+                        mMultiDrawInfos[0].vertexCount, instanceCount,
+                        gl::DrawElementsType::InvalidEnum, nullptr, mNonIndexedDirtyBitsMask));
+
+    mRenderPassCommandBuffer->drawMulti(static_cast<uint32_t>(mMultiDrawInfos.size()),
+                                        mMultiDrawInfos.data(), instanceCount, baseInstance);
+    gl::MarkShaderStorageUsage(context);
+
+    return angle::Result::Continue;
+}
+
+angle::Result ContextVk::multiDrawElementsCmd(const gl::Context *context,
+                                              gl::PrimitiveMode mode,
+                                              const GLsizei *counts,
+                                              gl::DrawElementsType type,
+                                              const GLvoid *const *indices,
+                                              const GLint *baseVerticesOrNull,
+                                              GLsizei instanceCount,
+                                              GLuint baseInstance,
+                                              GLsizei drawcount)
+{
+    const GLuint indexSizeShift = gl::GetDrawElementsTypeShift(type);
+
+    mMultiDrawIndexedInfos.clear();
+    GLsizei maxIndexCount = 0;
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        if (context->noopDrawInstanced(mode, counts[drawID], instanceCount))
+        {
+            continue;
+        }
+
+        VkMultiDrawIndexedInfoEXT drawInfo = {};
+        drawInfo.firstIndex =
+            static_cast<uint32_t>(reinterpret_cast<uintptr_t>(indices[drawID]) >> indexSizeShift);
+        drawInfo.indexCount   = counts[drawID];
+        drawInfo.vertexOffset = baseVerticesOrNull ? baseVerticesOrNull[drawID] : 0;
+        mMultiDrawIndexedInfos.push_back(drawInfo);
+
+        gl::MarkTransformFeedbackBufferUsage(context, counts[drawID], instanceCount);
+        maxIndexCount = std::max(maxIndexCount, counts[drawID]);
+    }
+
+    if (mMultiDrawIndexedInfos.empty())
+    {
+        return handleNoopDrawEvent();
+    }
+
+    // All draws share the index buffer binding at offset 0; per-draw offsets are carried by
+    // firstIndex.
+    ANGLE_TRY(setupIndexedDraw(context, mode, maxIndexCount, instanceCount, type, nullptr));
+
+    mRenderPassCommandBuffer->drawMultiIndexed(
+        static_cast<uint32_t>(mMultiDrawIndexedInfos.size()), mMultiDrawIndexedInfos.data(),
+        instanceCount, baseInstance);
+    gl::MarkShaderStorageUsage(context);
+
+    return angle::Result::Continue;
 }
 
 angle::Result ContextVk::optimizeRenderPassForPresent(vk::ImageViewHelper *colorImageView,
@@ -5406,6 +5634,9 @@ angle::Result ContextVk::invalidateProgramExecutableHelper(const gl::Context *co
             &mGraphicsPipelineTransition, executable->getNonBuiltinAttribLocationsMask(),
             executable->getAttributesTypeMask());
 
+        mGraphicsPipelineDesc->updateUsesDescriptorBuffer(
+            &mGraphicsPipelineTransition, vk::GetImpl(executable)->usesDescriptorBuffer());
+
         updateMissingOutputsMask();
     }
 
@@ -6607,6 +6838,14 @@ void ContextVk::invalidateGraphicsDescriptorSet(DescriptorSetIndex usedDescripto
         mGraphicsDirtyBits.set(DIRTY_BIT_DESCRIPTOR_SETS);
         return;
     }
+
+    // Binding descriptor sets invalidates previously bound descriptor buffers and pushed
+    // descriptors.
+    if (executable && (vk::GetImpl(executable)->usesDescriptorBuffer() ||
+                       vk::GetImpl(executable)->usesPushDescriptor()))
+    {
+        mGraphicsDirtyBits.set(DIRTY_BIT_DESCRIPTOR_SETS);
+    }
 }
 
 void ContextVk::invalidateComputeDescriptorSet(DescriptorSetIndex usedDescriptorSet)
@@ -6620,6 +6859,14 @@ void ContextVk::invalidateComputeDescriptorSet(DescriptorSetIndex usedDescriptor
         mComputeDirtyBits.set(DIRTY_BIT_DESCRIPTOR_SETS);
         return;
     }
+
+    // Binding descriptor sets invalidates previously bound descriptor buffers and pushed
+    // descriptors.
+    if (executable && (vk::GetImpl(executable)->usesDescriptorBuffer() ||
+                       vk::GetImpl(executable)->usesPushDescriptor()))
+    {
+        mComputeDirtyBits.set(DIRTY_BIT_DESCRIPTOR_SETS);
+    }
 }
 
 void ContextVk::invalidateAllDynamicState()
@@ -7496,6 +7743,13 @@ angle::Result ContextVk::updateActiveTextures(const gl::Context *context, gl::Co
         ANGLE_TRY(executableVk->initializeDescriptorPools(this, &getDescriptorSetLayoutCache(),
                                                           &getMetaDescriptorPools()));
 
+        // Whether descriptor buffers can be used may have changed with the immutable samplers.
+        if (executable->hasLinkedShaderStage(gl::ShaderType::Vertex))
+        {
+            mGraphicsPipelineDesc->updateUsesDescriptorBuffer(
+                &mGraphicsPipelineTransition, executableVk->usesDescriptorBuffer());
+        }
+
         // The default uniforms descriptor set was reset during createPipelineLayout(), so mark them
         // dirty to get everything reallocated/rebound before the next draw.
         if (executable->hasDefaultUniforms())
@@ -7679,6 +7933,8 @@ angle::Result ContextVk::flushImpl(const vk::Semaphore *signalSemaphore,
     // time we always wait for GPU to finish before destroying the dynamic buffers.
     mDefaultUniformStorage.updateQueueSerialAndReleaseInFlightBuffers(this,
                                                                       mLastFlushedQueueSerial);
+    mDescriptorBufferStorage.updateQueueSerialAndReleaseInFlightBuffers(this,
+                                                                        mLastFlushedQueueSerial);
 
     if (mHasInFlightStreamedVertexBuffers.any())
     {
@@ -1127,6 +1127,29 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
                                     gl::PrimitiveMode mode,
                                     DirtyBits dirtyBitMask,
                                     vk::BufferHelper *indirectBuffer);
+
+    // VK_EXT_multi_draw helpers; used when the sub-draws of a glMultiDraw* call can be recorded
+    // as a single command.
+    bool canMultiDrawElementsUseCmd(gl::PrimitiveMode mode,
+                                    gl::DrawElementsType type,
+                                    const GLvoid *const *indices,
+                                    GLsizei drawcount) const;
+    angle::Result multiDrawArraysCmd(const gl::Context *context,
+                                     gl::PrimitiveMode mode,
+                                     const GLint *firsts,
+                                     const GLsizei *counts,
+                                     GLsizei instanceCount,
+                                     GLuint baseInstance,
+                                     GLsizei drawcount);
+    angle::Result multiDrawElementsCmd(const gl::Context *context,
+                                       gl::PrimitiveMode mode,
+                                       const GLsizei *counts,
+                                       gl::DrawElementsType type,
+                                       const GLvoid *const *indices,
+                                       const GLint *baseVerticesOrNull,
+                                       GLsizei instanceCount,
+                                       GLuint baseInstance,
+                                       GLsizei drawcount);
     angle::Result setupIndexedIndirectDraw(const gl::Context *context,
                                            gl::PrimitiveMode mode,
                                            gl::DrawElementsType indexType,
@@ -1535,6 +1558,11 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     gl::DrawElementsType mCurrentDrawElementsType;
     angle::PackedEnumMap<gl::DrawElementsType, VkIndexType> mIndexTypeMap;
 
+    // Scratch storage for the per-draw parameters of VK_EXT_multi_draw commands, kept around to
+    // avoid reallocating on every glMultiDraw* call.
+    std::vector<VkMultiDrawInfoEXT> mMultiDrawInfos;
+    std::vector<VkMultiDrawIndexedInfoEXT> mMultiDrawIndexedInfos;
+
     // Cache the current draw call's firstVertex to be passed to
     // TransformFeedbackVk::getBufferOffsets.  Unfortunately, gl_BaseVertex support in Vulkan is
     // not yet ubiquitous, which would have otherwise removed the need for this value to be passed
@@ -1708,6 +1736,10 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     // Storage for default uniforms of ProgramVks and ProgramPipelineVks.
     vk::DynamicBuffer mDefaultUniformStorage;
 
+    // Storage for descriptors of ProgramVks and ProgramPipelineVks when descriptor buffers are
+    // used.
+    vk::DynamicBuffer mDescriptorBufferStorage;
+
     std::vector<std::string> mCommandBufferDiagnostics;
 
     // Record GL API calls for debuggers
@@ -8,6 +8,8 @@
 
 #include "libANGLE/renderer/vulkan/ProgramExecutableVk.h"
 
+#include "common/BinaryStream.h"
+#include "common/angle_version_info.h"
 #include "common/string_utils.h"
 #include "libANGLE/renderer/vulkan/BufferVk.h"
 #include "libANGLE/renderer/vulkan/DisplayVk.h"
@@ -239,6 +241,13 @@ vk::SpecializationConstants MakeSpecConsts(ProgramTransformOptions transformOpti
     return specConsts;
 }
 
+// Identifies the graphics pipeline history entries in the blob cache.
+constexpr char kGraphicsPipelineHistoryTag[]       = "ANGLE Vulkan graphics pipeline history";
+constexpr uint32_t kGraphicsPipelineHistoryVersion = 2;
+// The number of graphics pipelines recorded per program, which bounds the amount of work done by
+// the post-link tasks.
+constexpr size_t kMaxGraphicsPipelineHistorySize = 16;
+
 vk::GraphicsPipelineSubset GetWarmUpSubset(const angle::FeaturesVk &features)
 {
     // Only build the shaders subset of the pipeline if VK_EXT_graphics_pipeline_library is
@@ -363,16 +372,18 @@ class ProgramExecutableVk::WarmUpGraphicsTask : public WarmUpTaskCommon
                        vk::PipelineRobustness pipelineRobustness,
                        vk::PipelineProtectedAccess pipelineProtectedAccess,
                        vk::GraphicsPipelineSubset subset,
-                       const bool isSurfaceRotated,
+                       ProgramTransformOptions transformOptions,
                        const vk::GraphicsPipelineDesc &graphicsPipelineDesc,
                        SharedRenderPass *compatibleRenderPass,
+                       bool useCompatibleRenderPass,
                        vk::PipelineHelper *placeholderPipelineHelper)
         : WarmUpTaskCommon(renderer, executableVk, pipelineRobustness, pipelineProtectedAccess),
           mPipelineSubset(subset),
-          mIsSurfaceRotated(isSurfaceRotated),
+          mTransformOptions(transformOptions),
           mGraphicsPipelineDesc(graphicsPipelineDesc),
           mWarmUpPipelineHelper(placeholderPipelineHelper),
-          mCompatibleRenderPass(compatibleRenderPass)
+          mCompatibleRenderPass(compatibleRenderPass),
+          mUseCompatibleRenderPass(useCompatibleRenderPass)
     {
         ASSERT(mCompatibleRenderPass);
         mCompatibleRenderPass->addRef();
@@ -381,9 +392,11 @@ class ProgramExecutableVk::WarmUpGraphicsTask : public WarmUpTaskCommon
 
     void operator()() override
     {
+        const vk::RenderPass *renderPass =
+            mUseCompatibleRenderPass ? &mCompatibleRenderPass->get() : nullptr;
         angle::Result result = mExecutableVk->warmUpGraphicsPipelineCache(
-            this, mPipelineRobustness, mPipelineProtectedAccess, mPipelineSubset, mIsSurfaceRotated,
-            mGraphicsPipelineDesc, mCompatibleRenderPass->get(), mWarmUpPipelineHelper);
+            this, mPipelineRobustness, mPipelineProtectedAccess, mPipelineSubset, mTransformOptions,
+            mGraphicsPipelineDesc, renderPass, mWarmUpPipelineHelper);
         ASSERT((result == angle::Result::Continue) == (mErrorCode == VK_SUCCESS));
 
         // Release reference to shared renderpass. If this is the last reference -
@@ -391,7 +404,8 @@ class ProgramExecutableVk::WarmUpGraphicsTask : public WarmUpTaskCommon
         // 2. cleanup temporary renderpass
         //
         // Note: with dynamic rendering, |mCompatibleRenderPass| holds a VK_NULL_HANDLE, and it's
-        // just used as a ref count for this purpose.
+        // just used as a ref count for this purpose.  The same is true for tasks that precompile
+        // recorded pipelines, which don't use |mCompatibleRenderPass|.
         const bool isLastWarmUpTask = mCompatibleRenderPass->getAndReleaseRef() == 1;
         if (isLastWarmUpTask)
         {
@@ -404,12 +418,15 @@ class ProgramExecutableVk::WarmUpGraphicsTask : public WarmUpTaskCommon
 
   private:
     vk::GraphicsPipelineSubset mPipelineSubset;
-    bool mIsSurfaceRotated;
+    ProgramTransformOptions mTransformOptions;
     vk::GraphicsPipelineDesc mGraphicsPipelineDesc;
     vk::PipelineHelper *mWarmUpPipelineHelper;
 
     // Temporary objects to clean up at the end
     SharedRenderPass *mCompatibleRenderPass;
+    // If false, the desc's render pass is not the one in |mCompatibleRenderPass|, and a compatible
+    // render pass is created by the task itself.
+    bool mUseCompatibleRenderPass;
 };
 
 // ShaderInfo implementation.
@@ -516,8 +533,19 @@ angle::Result ProgramInfo::initProgram(vk::Context *context,
     options.useSpirvVaryingPrecisionFixer =
         context->getFeatures().varyingsRequireMatchingPrecisionInSpirv.enabled;
 
-    ANGLE_TRY(
-        SpvTransformSpirvCode(options, variableInfoMap, originalSpirvBlob, &transformedSpirvBlob));
+    // Programs that share shaders often create the same variants, so avoid transforming the SPIR-V
+    // again if another program already has.
+    TransformedSpirvCache &transformedSpirvCache =
+        context->getRenderer()->getTransformedSpirvCache();
+    const angle::BlobCacheKey cacheKey =
+        SpvGetTransformedSpirvCacheKey(options, variableInfoMap, originalSpirvBlob);
+    if (!transformedSpirvCache.get(cacheKey, &transformedSpirvBlob))
+    {
+        ANGLE_TRY(SpvTransformSpirvCode(options, variableInfoMap, originalSpirvBlob,
+                                        &transformedSpirvBlob));
+        transformedSpirvCache.put(cacheKey, transformedSpirvBlob);
+    }
+
     ANGLE_TRY(vk::InitShaderModule(context, &mShaders[shaderType].get(),
                                    transformedSpirvBlob.data(),
                                    transformedSpirvBlob.size() * sizeof(uint32_t)));
@@ -542,6 +570,8 @@ ProgramExecutableVk::ProgramExecutableVk(const gl::ProgramExecutable *executable
       mImmutableSamplersMaxDescriptorCount(1),
       mUniformBufferDescriptorType(VK_DESCRIPTOR_TYPE_MAX_ENUM),
       mDynamicUniformDescriptorOffsets{},
+      mUsesDescriptorBuffer(false),
+      mUsesPushDescriptor(false),
       mValidGraphicsPermutations{},
       mValidComputePermutations{}
 {
@@ -583,6 +613,21 @@ void ProgramExecutableVk::resetLayout(ContextVk *contextVk)
 
     mDescriptorSets.fill(VK_NULL_HANDLE);
 
+    for (vk::DescriptorBufferSet &descriptorBufferSet : mDescriptorBufferSets)
+    {
+        descriptorBufferSet.reset();
+    }
+    mUsesDescriptorBuffer = false;
+    mPushDescriptorSet.reset();
+    mUsesPushDescriptor = false;
+
+    VkDevice device = contextVk->getDevice();
+    for (vk::DescriptorUpdateTemplate &updateTemplate : mDescriptorUpdateTemplates)
+    {
+        updateTemplate.destroy(device);
+    }
+    mDefaultUniformAndXfbDescriptorUpdateTemplate.destroy(device);
+
     for (vk::RefCountedDescriptorPoolBinding &binding : mDescriptorPoolBindings)
     {
         binding.reset();
@@ -606,6 +651,7 @@ void ProgramExecutableVk::resetLayout(ContextVk *contextVk)
         mGraphicsProgramInfos[index].release(contextVk);
     }
     mValidGraphicsPermutations.reset();
+    mPendingPrecompiledGraphicsPipelines.clear();
 
     for (size_t index : mValidComputePermutations)
     {
@@ -826,8 +872,12 @@ angle::Result ProgramExecutableVk::getPipelineCacheWarmUpTasks(
 
             warmUpSubTasks.push_back(std::make_shared<WarmUpGraphicsTask>(
                 renderer, this, pipelineRobustness, pipelineProtectedAccess, subset,
-                surfaceRotation, *graphicsPipelineDesc, sharedRenderPass, pipelineHelper));
+                transformOptions, *graphicsPipelineDesc, sharedRenderPass, true, pipelineHelper));
         }
+
+        // Additionally precompile the pipelines that draw calls used in previous runs.
+        addGraphicsPipelinePrecompileTasks(renderer, pipelineRobustness, pipelineProtectedAccess,
+                                           subset, sharedRenderPass, &warmUpSubTasks);
     }
 
     // If the caller hasn't provided a valid async task container, inline the warmUp tasks.
@@ -874,6 +924,7 @@ angle::Result ProgramExecutableVk::prepareForWarmUpPipelineCache(
         // Initialize compute program.
         vk::ComputePipelineOptions pipelineOptions =
             vk::GetComputePipelineOptions(pipelineRobustness, pipelineProtectedAccess);
+        pipelineOptions.descriptorBuffer = mUsesDescriptorBuffer;
         ANGLE_TRY(
             initComputeProgram(context, &mComputeProgramInfo, mVariableInfoMap, pipelineOptions));
 
@@ -890,6 +941,7 @@ angle::Result ProgramExecutableVk::prepareForWarmUpPipelineCache(
                                  : gl::PrimitiveMode::TriangleStrip;
     SetupDefaultPipelineState(context, *mExecutable, mode, pipelineRobustness,
                               pipelineProtectedAccess, subset, &mWarmUpGraphicsPipelineDesc);
+    mWarmUpGraphicsPipelineDesc.setUsesDescriptorBuffer(mUsesDescriptorBuffer);
 
     // Create a temporary compatible RenderPass.  The render pass cache in ContextVk cannot be used
     // because this function may be called from a worker thread.
@@ -928,7 +980,7 @@ angle::Result ProgramExecutableVk::prepareForWarmUpPipelineCache(
         ANGLE_TRY(initGraphicsShaderPrograms(context, transformOptions));
     }
 
-    return angle::Result::Continue;
+    return initGraphicsPipelineHistoryPrograms(context);
 }
 
 angle::Result ProgramExecutableVk::warmUpComputePipelineCache(
@@ -963,26 +1015,42 @@ angle::Result ProgramExecutableVk::warmUpGraphicsPipelineCache(
     vk::PipelineRobustness pipelineRobustness,
     vk::PipelineProtectedAccess pipelineProtectedAccess,
     vk::GraphicsPipelineSubset subset,
-    const bool isSurfaceRotated,
+    ProgramTransformOptions transformOptions,
     const vk::GraphicsPipelineDesc &graphicsPipelineDesc,
-    const vk::RenderPass &renderPass,
+    const vk::RenderPass *renderPass,
     vk::PipelineHelper *placeholderPipelineHelper)
 {
     ANGLE_TRACE_EVENT0("gpu.angle", "ProgramExecutableVk::warmUpGraphicsPipelineCache");
 
     ASSERT(placeholderPipelineHelper && !placeholderPipelineHelper->valid());
 
+    // If no render pass is given, create a temporary one that is compatible with the desc.
+    vk::RenderPass compatibleRenderPass;
+    if (renderPass == nullptr)
+    {
+        if (!context->getFeatures().preferDynamicRendering.enabled)
+        {
+            vk::AttachmentOpsArray ops;
+            RenderPassCache::InitializeOpsForCompatibleRenderPass(
+                graphicsPipelineDesc.getRenderPassDesc(), &ops);
+            ANGLE_TRY(RenderPassCache::MakeRenderPass(context,
+                                                      graphicsPipelineDesc.getRenderPassDesc(), ops,
+                                                      &compatibleRenderPass, nullptr));
+        }
+        renderPass = &compatibleRenderPass;
+    }
+
     // No synchronization necessary since mPipelineCache is internally synchronized.
     vk::PipelineCacheAccess pipelineCache;
     pipelineCache.init(&mPipelineCache, nullptr);
 
-    const vk::GraphicsPipelineDesc *descPtr  = nullptr;
-    ProgramTransformOptions transformOptions = {};
-    transformOptions.surfaceRotation         = isSurfaceRotated;
-
-    ANGLE_TRY(createGraphicsPipelineImpl(context, transformOptions, subset, &pipelineCache,
-                                         PipelineSource::WarmUp, graphicsPipelineDesc, renderPass,
-                                         &descPtr, &placeholderPipelineHelper));
+    const vk::GraphicsPipelineDesc *descPtr = nullptr;
+    angle::Result result =
+        createGraphicsPipelineImpl(context, transformOptions, subset, &pipelineCache,
+                                   PipelineSource::WarmUp, graphicsPipelineDesc, *renderPass,
+                                   &descPtr, &placeholderPipelineHelper);
+    compatibleRenderPass.destroy(context->getDevice());
+    ANGLE_TRY(result);
 
     ASSERT(placeholderPipelineHelper->valid());
     return angle::Result::Continue;
@@ -1035,7 +1103,10 @@ void ProgramExecutableVk::waitForGraphicsPostLinkTasks(
 
     const vk::GraphicsPipelineSubset subset = GetWarmUpSubset(contextVk->getFeatures());
 
-    if (!mWarmUpGraphicsPipelineDesc.keyEqual(currentGraphicsPipelineDesc, subset))
+    if (!mWarmUpGraphicsPipelineDesc.keyEqual(currentGraphicsPipelineDesc, subset) &&
+        !isPendingPrecompiledGraphicsPipeline(
+            getTransformOptions(contextVk, currentGraphicsPipelineDesc),
+            currentGraphicsPipelineDesc, subset))
     {
         // The GraphicsPipelineDesc used for warmup differs from the one used by the draw call.
         // There is no need to wait for the warmup tasks to complete.
@@ -1053,6 +1124,263 @@ void ProgramExecutableVk::waitForGraphicsPostLinkTasks(
     waitForPostLinkTasksImpl(contextVk);
 }
 
+void ProgramExecutableVk::loadGraphicsPipelineHistory(vk::Renderer *renderer)
+{
+    ASSERT(renderer->getFeatures().precompileRecordedGraphicsPipelines.enabled);
+    ASSERT(mGraphicsPipelineHistory.empty());
+
+    if (!mExecutable->hasLinkedShaderStage(gl::ShaderType::Vertex))
+    {
+        return;
+    }
+
+    // The recorded descs are raw GraphicsPipelineDesc memory, so they are only usable with the
+    // same version of ANGLE and the same device.
+    const VkPhysicalDeviceProperties &deviceProperties = renderer->getPhysicalDeviceProperties();
+
+    angle::base::SecureHashAlgorithm hasher;
+    hasher.Update(kGraphicsPipelineHistoryTag, strlen(kGraphicsPipelineHistoryTag));
+    hasher.Update(angle::GetANGLEShaderProgramVersion(),
+                  angle::GetANGLEShaderProgramVersionHashSize());
+    hasher.Update(deviceProperties.pipelineCacheUUID, VK_UUID_SIZE);
+    hasher.Update(&deviceProperties.vendorID, sizeof(deviceProperties.vendorID));
+    hasher.Update(&deviceProperties.deviceID, sizeof(deviceProperties.deviceID));
+    for (gl::ShaderType shaderType : mExecutable->getLinkedShaderStages())
+    {
+        const angle::spirv::Blob &spirv = mOriginalShaderInfo.getSpirvBlobs()[shaderType];
+        hasher.Update(&shaderType, sizeof(shaderType));
+        hasher.Update(spirv.data(), spirv.size() * sizeof(*spirv.data()));
+    }
+    hasher.Final();
+    memcpy(mGraphicsPipelineHistoryKey.data(), hasher.Digest(), angle::base::kSHA1Length);
+
+    mRecordGraphicsPipelines = true;
+
+    angle::MemoryBuffer historyData;
+    if (!renderer->getBlobCacheEntry(mGraphicsPipelineHistoryKey, &historyData))
+    {
+        return;
+    }
+
+    // The history ends with a SHA-1 digest of the rest of it, so that truncated or otherwise
+    // corrupt histories are rejected before anything is parsed.
+    if (historyData.size() < angle::base::kSHA1Length)
+    {
+        WARN() << "Ignoring corrupt graphics pipeline history in the blob cache";
+        return;
+    }
+    const size_t payloadSize = historyData.size() - angle::base::kSHA1Length;
+    uint8_t digest[angle::base::kSHA1Length];
+    angle::base::SHA1HashBytes(historyData.data(), payloadSize, digest);
+    if (memcmp(digest, historyData.data() + payloadSize, angle::base::kSHA1Length) != 0)
+    {
+        WARN() << "Ignoring corrupt graphics pipeline history in the blob cache";
+        return;
+    }
+
+    gl::BinaryInputStream stream(historyData.data(), payloadSize);
+    const uint32_t version  = stream.readInt<uint32_t>();
+    const uint32_t descSize = stream.readInt<uint32_t>();
+    const size_t count      = stream.readInt<size_t>();
+    if (stream.error() || version != kGraphicsPipelineHistoryVersion ||
+        descSize != sizeof(vk::GraphicsPipelineDesc) || count > kMaxGraphicsPipelineHistorySize)
+    {
+        return;
+    }
+
+    // The descs end up in vkCreateGraphicsPipelines, so beyond the digest, every entry is checked
+    // to only contain values that a draw call could have produced.
+    bool isValid = true;
+    mGraphicsPipelineHistory.resize(count);
+    for (RecordedGraphicsPipeline &recorded : mGraphicsPipelineHistory)
+    {
+        recorded.transformOptions.permutationIndex = stream.readInt<uint8_t>();
+        stream.readBytes(reinterpret_cast<uint8_t *>(&recorded.desc), sizeof(recorded.desc));
+        if (stream.error() ||
+            recorded.transformOptions.permutationIndex >=
+                ProgramTransformOptions::kPermutationCount ||
+            !recorded.desc.hasValidPackedState(renderer))
+        {
+            isValid = false;
+            break;
+        }
+    }
+
+    if (!isValid || !stream.endOfStream())
+    {
+        WARN() << "Ignoring corrupt graphics pipeline history in the blob cache";
+        mGraphicsPipelineHistory.clear();
+    }
+}
+
+angle::Result ProgramExecutableVk::getGraphicsPipelinePrecompileTasks(
+    vk::Context *context,
+    vk::PipelineRobustness pipelineRobustness,
+    vk::PipelineProtectedAccess pipelineProtectedAccess,
+    std::vector<std::shared_ptr<LinkSubTask>> *postLinkSubTasksOut)
+{
+    ASSERT(postLinkSubTasksOut && postLinkSubTasksOut->empty());
+
+    if (mGraphicsPipelineHistory.empty())
+    {
+        return angle::Result::Continue;
+    }
+
+    ANGLE_TRY(ensurePipelineCacheInitialized(context));
+    ANGLE_TRY(initGraphicsPipelineHistoryPrograms(context));
+
+    // There is no warm up render pass when the program is loaded, the shared object is only used
+    // to merge the pipeline cache to the renderer's once the last task is done.
+    SharedRenderPass *sharedRenderPass = new SharedRenderPass(vk::RenderPass());
+    addGraphicsPipelinePrecompileTasks(context->getRenderer(), pipelineRobustness,
+                                       pipelineProtectedAccess,
+                                       GetWarmUpSubset(context->getFeatures()), sharedRenderPass,
+                                       postLinkSubTasksOut);
+    if (postLinkSubTasksOut->empty())
+    {
+        SafeDelete(sharedRenderPass);
+    }
+
+    return angle::Result::Continue;
+}
+
+angle::Result ProgramExecutableVk::initGraphicsPipelineHistoryPrograms(vk::Context *context)
+{
+    for (const RecordedGraphicsPipeline &recorded : mGraphicsPipelineHistory)
+    {
+        ANGLE_TRY(initGraphicsShaderPrograms(context, recorded.transformOptions));
+    }
+    return angle::Result::Continue;
+}
+
+void ProgramExecutableVk::addGraphicsPipelinePrecompileTasks(
+    vk::Renderer *renderer,
+    vk::PipelineRobustness pipelineRobustness,
+    vk::PipelineProtectedAccess pipelineProtectedAccess,
+    vk::GraphicsPipelineSubset subset,
+    SharedRenderPass *sharedRenderPass,
+    std::vector<std::shared_ptr<LinkSubTask>> *tasksOut)
+{
+    ASSERT(mPendingPrecompiledGraphicsPipelines.empty());
+
+    for (const RecordedGraphicsPipeline &recorded : mGraphicsPipelineHistory)
+    {
+        // Add a placeholder entry in GraphicsPipelineCache.  If there is already one, the desc is
+        // the same as the one used for warm up.
+        const uint8_t programIndex         = recorded.transformOptions.permutationIndex;
+        vk::PipelineHelper *pipelineHelper = nullptr;
+        if (subset == vk::GraphicsPipelineSubset::Complete)
+        {
+            mCompleteGraphicsPipelines[programIndex].populate(recorded.desc, vk::Pipeline(),
+                                                              &pipelineHelper);
+        }
+        else
+        {
+            ASSERT(subset == vk::GraphicsPipelineSubset::Shaders);
+            mShadersGraphicsPipelines[programIndex].populate(recorded.desc, vk::Pipeline(),
+                                                             &pipelineHelper);
+        }
+        if (pipelineHelper == nullptr)
+        {
+            continue;
+        }
+
+        mPendingPrecompiledGraphicsPipelines.push_back(recorded);
+        tasksOut->push_back(std::make_shared<WarmUpGraphicsTask>(
+            renderer, this, pipelineRobustness, pipelineProtectedAccess, subset,
+            recorded.transformOptions, recorded.desc, sharedRenderPass, false, pipelineHelper));
+    }
+}
+
+bool ProgramExecutableVk::isPendingPrecompiledGraphicsPipeline(
+    ProgramTransformOptions transformOptions,
+    const vk::GraphicsPipelineDesc &desc,
+    vk::GraphicsPipelineSubset subset) const
+{
+    for (const RecordedGraphicsPipeline &pending : mPendingPrecompiledGraphicsPipelines)
+    {
+        if (pending.transformOptions.permutationIndex == transformOptions.permutationIndex &&
+            pending.desc.keyEqual(desc, subset))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void ProgramExecutableVk::onPrecompiledGraphicsPipelineUsed(
+    ContextVk *contextVk,
+    ProgramTransformOptions transformOptions,
+    const vk::GraphicsPipelineDesc &desc,
+    vk::GraphicsPipelineSubset subset)
+{
+    for (auto iter = mPendingPrecompiledGraphicsPipelines.begin();
+         iter != mPendingPrecompiledGraphicsPipelines.end(); ++iter)
+    {
+        if (iter->transformOptions.permutationIndex == transformOptions.permutationIndex &&
+            iter->desc.keyEqual(desc, subset))
+        {
+            contextVk->getPerfCounters().graphicsPipelinePrecompileHits++;
+            mPendingPrecompiledGraphicsPipelines.erase(iter);
+            return;
+        }
+    }
+}
+
+void ProgramExecutableVk::recordGraphicsPipeline(ContextVk *contextVk,
+                                                 ProgramTransformOptions transformOptions,
+                                                 const vk::GraphicsPipelineDesc &desc,
+                                                 vk::GraphicsPipelineSubset subset)
+{
+    ASSERT(mRecordGraphicsPipelines);
+
+    contextVk->getPerfCounters().graphicsPipelinePrecompileMisses++;
+
+    // Don't record the same pipeline twice, which can happen if its precompilation failed.
+    for (const RecordedGraphicsPipeline &recorded : mGraphicsPipelineHistory)
+    {
+        if (recorded.transformOptions.permutationIndex == transformOptions.permutationIndex &&
+            recorded.desc.keyEqual(desc, subset))
+        {
+            return;
+        }
+    }
+
+    // Keep the most recent pipelines only.  Because of the limit, an old pipeline may be dropped
+    // and recorded again later, but as long as the program uses at most that many pipelines, the
+    // history eventually covers all of them.
+    if (mGraphicsPipelineHistory.size() >= kMaxGraphicsPipelineHistorySize)
+    {
+        mGraphicsPipelineHistory.erase(mGraphicsPipelineHistory.begin());
+    }
+    mGraphicsPipelineHistory.push_back({transformOptions, desc});
+
+    gl::BinaryOutputStream stream;
+    stream.writeInt(kGraphicsPipelineHistoryVersion);
+    stream.writeInt(static_cast<uint32_t>(sizeof(vk::GraphicsPipelineDesc)));
+    stream.writeInt(mGraphicsPipelineHistory.size());
+    for (const RecordedGraphicsPipeline &recorded : mGraphicsPipelineHistory)
+    {
+        stream.writeInt(recorded.transformOptions.permutationIndex);
+        stream.writeBytes(reinterpret_cast<const uint8_t *>(&recorded.desc),
+                          sizeof(recorded.desc));
+    }
+
+    angle::MemoryBuffer historyData;
+    if (!historyData.resize(stream.length() + angle::base::kSHA1Length))
+    {
+        return;
+    }
+    memcpy(historyData.data(), stream.data(), stream.length());
+    angle::base::SHA1HashBytes(stream.data(), stream.length(),
+                               historyData.data() + stream.length());
+
+    // The write to the blob cache is deferred to the next pipeline cache sync, as this is on the
+    // draw path.
+    contextVk->getRenderer()->queueBlobCacheEntry(mGraphicsPipelineHistoryKey,
+                                                  std::move(historyData));
+}
+
 angle::Result ProgramExecutableVk::mergePipelineCacheToRenderer(vk::Context *context) const
 {
     // Merge the cache with Renderer's
@@ -1467,6 +1795,12 @@ angle::Result ProgramExecutableVk::getGraphicsPipeline(ContextVk *contextVk,
         mShadersGraphicsPipelines[programIndex].getPipeline(desc, descPtrOut, pipelineOut);
     }
 
+    if (*pipelineOut != nullptr && !mPendingPrecompiledGraphicsPipelines.empty() &&
+        pipelineSubset == GetWarmUpSubset(contextVk->getFeatures()))
+    {
+        onPrecompiledGraphicsPipelineUsed(contextVk, transformOptions, desc, pipelineSubset);
+    }
+
     return angle::Result::Continue;
 }
 
@@ -1501,6 +1835,14 @@ angle::Result ProgramExecutableVk::createGraphicsPipeline(
         contextVk, transformOptions, pipelineSubset, pipelineCache, source, desc,
         *compatibleRenderPass, descPtrOut, pipelineOut));
 
+    // Remember the pipeline, so it can be precompiled the next time the program is linked or
+    // loaded.
+    if (mRecordGraphicsPipelines && source == PipelineSource::Draw &&
+        pipelineSubset == GetWarmUpSubset(contextVk->getFeatures()))
+    {
+        recordGraphicsPipeline(contextVk, transformOptions, desc, pipelineSubset);
+    }
+
     if (useProgramPipelineCache &&
         contextVk->getFeatures().mergeProgramPipelineCachesToGlobalCache.enabled)
     {
@@ -1552,6 +1894,7 @@ angle::Result ProgramExecutableVk::getOrCreateComputePipeline(
 
     vk::ComputePipelineOptions pipelineOptions =
         vk::GetComputePipelineOptions(pipelineRobustness, pipelineProtectedAccess);
+    pipelineOptions.descriptorBuffer = mUsesDescriptorBuffer;
     ANGLE_TRY(initComputeProgram(context, &mComputeProgramInfo, mVariableInfoMap, pipelineOptions));
 
     return mComputeProgramInfo.getShaderProgram().getOrCreateComputePipeline(
@@ -1559,6 +1902,25 @@ angle::Result ProgramExecutableVk::getOrCreateComputePipeline(
         pipelineOut, nullptr, nullptr);
 }
 
+bool ProgramExecutableVk::usesTexelBuffers() const
+{
+    for (const gl::SamplerBinding &samplerBinding : mExecutable->getSamplerBindings())
+    {
+        if (samplerBinding.textureType == gl::TextureType::Buffer)
+        {
+            return true;
+        }
+    }
+    for (const gl::ImageBinding &imageBinding : mExecutable->getImageBindings())
+    {
+        if (imageBinding.textureType == gl::TextureType::Buffer)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 angle::Result ProgramExecutableVk::createPipelineLayout(
     vk::Context *context,
     PipelineLayoutCache *pipelineLayoutCache,
@@ -1567,6 +1929,38 @@ angle::Result ProgramExecutableVk::createPipelineLayout(
 {
     const gl::ShaderBitSet &linkedShaderStages = mExecutable->getLinkedShaderStages();
 
+    // The texture set is described first, as whether immutable samplers are used affects the
+    // choice of descriptor buffers vs descriptor sets for all sets.
+    mTextureSetDesc = {};
+    ANGLE_TRY(addTextureDescriptorSetDesc(context, activeTextures, &mTextureSetDesc));
+
+    mUsesDescriptorBuffer = context->getRenderer()->useDescriptorBuffer() &&
+                            mImmutableSamplerIndexMap.empty() && !usesTexelBuffers();
+    if (mUsesDescriptorBuffer)
+    {
+        mTextureSetDesc.setUsesDescriptorBuffer();
+    }
+
+    // The default uniforms set is pushed if all its descriptors fit in the push descriptor limit:
+    // one per shader stage and, with transform feedback emulation, one per xfb buffer.
+    gl::ShaderType linkedTransformFeedbackStage = mExecutable->getLinkedTransformFeedbackStage();
+    bool hasXfbVaryings = linkedTransformFeedbackStage != gl::ShaderType::InvalidEnum &&
+                          !mExecutable->getLinkedTransformFeedbackVaryings().empty();
+    const bool hasEmulatedXfbBuffers =
+        context->getFeatures().emulateTransformFeedback.enabled && hasXfbVaryings;
+    const size_t uniformsAndXfbDescriptorCount =
+        mExecutable->getLinkedShaderStageCount() +
+        (hasEmulatedXfbBuffers ? mExecutable->getTransformFeedbackBufferCount() : 0);
+    mUsesPushDescriptor =
+        context->getRenderer()->usePushDescriptorsForDefaultUniforms() && !mUsesDescriptorBuffer &&
+        uniformsAndXfbDescriptorCount <= context->getRenderer()->getMaxPushDescriptors();
+
+    // Descriptor buffers and push descriptors don't support dynamic descriptors; the dynamic
+    // offset is instead included in the descriptor when written.
+    const VkDescriptorType defaultUniformDescriptorType =
+        mUsesDescriptorBuffer || mUsesPushDescriptor ? VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER
+                                                     : VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+
     // Store a reference to the pipeline and descriptor set layouts. This will create them if they
     // don't already exist in the cache.
 
@@ -1580,16 +1974,12 @@ angle::Result ProgramExecutableVk::createPipelineLayout(
         // Note that currently the default uniform block is added unconditionally.
         ASSERT(info.activeStages[shaderType]);
 
-        mDefaultUniformAndXfbSetDesc.addBinding(info.binding,
-                                                VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, 1,
+        mDefaultUniformAndXfbSetDesc.addBinding(info.binding, defaultUniformDescriptorType, 1,
                                                 gl_vk::kShaderStageMap[shaderType], nullptr);
         numDefaultUniformDescriptors++;
     }
 
-    gl::ShaderType linkedTransformFeedbackStage = mExecutable->getLinkedTransformFeedbackStage();
-    bool hasXfbVaryings = linkedTransformFeedbackStage != gl::ShaderType::InvalidEnum &&
-                          !mExecutable->getLinkedTransformFeedbackVaryings().empty();
-    if (context->getFeatures().emulateTransformFeedback.enabled && hasXfbVaryings)
+    if (hasEmulatedXfbBuffers)
     {
         size_t xfbBufferCount = mExecutable->getTransformFeedbackBufferCount();
         for (uint32_t bufferIndex = 0; bufferIndex < xfbBufferCount; ++bufferIndex)
@@ -1602,6 +1992,15 @@ angle::Result ProgramExecutableVk::createPipelineLayout(
         }
     }
 
+    if (mUsesDescriptorBuffer)
+    {
+        mDefaultUniformAndXfbSetDesc.setUsesDescriptorBuffer();
+    }
+    else if (mUsesPushDescriptor)
+    {
+        mDefaultUniformAndXfbSetDesc.setUsesPushDescriptor();
+    }
+
     ANGLE_TRY(descriptorSetLayoutCache->getDescriptorSetLayout(
         context, mDefaultUniformAndXfbSetDesc,
         &mDescriptorSetLayouts[DescriptorSetIndex::UniformsAndXfb]));
@@ -1626,9 +2025,13 @@ angle::Result ProgramExecutableVk::createPipelineLayout(
 
     // Decide if we should use dynamic or fixed descriptor types.
     VkPhysicalDeviceLimits limits = context->getRenderer()->getPhysicalDeviceProperties().limits;
-    uint32_t totalDynamicUniformBufferCount =
-        numActiveUniformBufferDescriptors + numDefaultUniformDescriptors;
-    if (totalDynamicUniformBufferCount <= limits.maxDescriptorSetUniformBuffersDynamic)
+    uint32_t totalDynamicUniformBufferCount = numActiveUniformBufferDescriptors;
+    if (!mUsesPushDescriptor)
+    {
+        totalDynamicUniformBufferCount += numDefaultUniformDescriptors;
+    }
+    if (!mUsesDescriptorBuffer &&
+        totalDynamicUniformBufferCount <= limits.maxDescriptorSetUniformBuffersDynamic)
     {
         mUniformBufferDescriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
     }
@@ -1645,15 +2048,16 @@ angle::Result ProgramExecutableVk::createPipelineLayout(
                                             &mShaderResourceSetDesc);
     addImageDescriptorSetDesc(&mShaderResourceSetDesc);
     addInputAttachmentDescriptorSetDesc(&mShaderResourceSetDesc);
+    if (mUsesDescriptorBuffer)
+    {
+        mShaderResourceSetDesc.setUsesDescriptorBuffer();
+    }
 
     ANGLE_TRY(descriptorSetLayoutCache->getDescriptorSetLayout(
         context, mShaderResourceSetDesc,
         &mDescriptorSetLayouts[DescriptorSetIndex::ShaderResource]));
 
     // Textures:
-    mTextureSetDesc = {};
-    ANGLE_TRY(addTextureDescriptorSetDesc(context, activeTextures, &mTextureSetDesc));
-
     ANGLE_TRY(descriptorSetLayoutCache->getDescriptorSetLayout(
         context, mTextureSetDesc, &mDescriptorSetLayouts[DescriptorSetIndex::Texture]));
 
@@ -1682,17 +2086,81 @@ angle::Result ProgramExecutableVk::createPipelineLayout(
 
     initializeWriteDescriptorDesc(context);
 
+    if (!mUsesDescriptorBuffer && context->getFeatures().useDescriptorUpdateTemplates.enabled)
+    {
+        ANGLE_TRY(initDescriptorUpdateTemplates(context));
+    }
+
+    if (mUsesDescriptorBuffer)
+    {
+        vk::Renderer *renderer = context->getRenderer();
+        mDescriptorBufferSets[DescriptorSetIndex::UniformsAndXfb].init(
+            renderer, mDefaultUniformAndXfbSetDesc,
+            mDescriptorSetLayouts[DescriptorSetIndex::UniformsAndXfb].get());
+        mDescriptorBufferSets[DescriptorSetIndex::ShaderResource].init(
+            renderer, mShaderResourceSetDesc,
+            mDescriptorSetLayouts[DescriptorSetIndex::ShaderResource].get());
+        mDescriptorBufferSets[DescriptorSetIndex::Texture].init(
+            renderer, mTextureSetDesc, mDescriptorSetLayouts[DescriptorSetIndex::Texture].get());
+    }
+
     return angle::Result::Continue;
 }
 
+angle::Result ProgramExecutableVk::initDescriptorUpdateTemplates(vk::Context *context)
+{
+    // Pushed descriptors are not written to a descriptor set.
+    if (!mUsesPushDescriptor)
+    {
+        ANGLE_TRY(mDefaultUniformWriteDescriptorDescs.initDescriptorUpdateTemplate(
+            context, mDescriptorSetLayouts[DescriptorSetIndex::UniformsAndXfb].get(),
+            &mDescriptorUpdateTemplates[DescriptorSetIndex::UniformsAndXfb]));
+        ANGLE_TRY(mDefaultUniformAndXfbWriteDescriptorDescs.initDescriptorUpdateTemplate(
+            context, mDescriptorSetLayouts[DescriptorSetIndex::UniformsAndXfb].get(),
+            &mDefaultUniformAndXfbDescriptorUpdateTemplate));
+    }
+    ANGLE_TRY(mShaderResourceWriteDescriptorDescs.initDescriptorUpdateTemplate(
+        context, mDescriptorSetLayouts[DescriptorSetIndex::ShaderResource].get(),
+        &mDescriptorUpdateTemplates[DescriptorSetIndex::ShaderResource]));
+    return mTextureWriteDescriptorDescs.initDescriptorUpdateTemplate(
+        context, mDescriptorSetLayouts[DescriptorSetIndex::Texture].get(),
+        &mDescriptorUpdateTemplates[DescriptorSetIndex::Texture]);
+}
+
+const vk::DescriptorUpdateTemplate *ProgramExecutableVk::getDescriptorUpdateTemplate(
+    DescriptorSetIndex setIndex,
+    const vk::WriteDescriptorDescs &writeDescriptorDescs) const
+{
+    const vk::DescriptorUpdateTemplate *updateTemplate = &mDescriptorUpdateTemplates[setIndex];
+
+    if (setIndex == DescriptorSetIndex::UniformsAndXfb &&
+        &writeDescriptorDescs == &mDefaultUniformAndXfbWriteDescriptorDescs)
+    {
+        updateTemplate = &mDefaultUniformAndXfbDescriptorUpdateTemplate;
+    }
+    else if (setIndex == DescriptorSetIndex::ShaderResource && mExecutable->usesFramebufferFetch())
+    {
+        // Input attachments are added to the shader resources' WriteDescriptorDescs based on the
+        // framebuffer at draw time, which the template doesn't account for.
+        return nullptr;
+    }
+
+    return updateTemplate->valid() ? updateTemplate : nullptr;
+}
+
 angle::Result ProgramExecutableVk::initializeDescriptorPools(
     vk::Context *context,
     DescriptorSetLayoutCache *descriptorSetLayoutCache,
     vk::DescriptorSetArray<vk::MetaDescriptorPool> *metaDescriptorPools)
 {
-    ANGLE_TRY((*metaDescriptorPools)[DescriptorSetIndex::UniformsAndXfb].bindCachedDescriptorPool(
-        context, mDefaultUniformAndXfbSetDesc, 1, descriptorSetLayoutCache,
-        &mDescriptorPools[DescriptorSetIndex::UniformsAndXfb]));
+    // Pushed descriptors are not allocated from a pool.
+    if (!mUsesPushDescriptor)
+    {
+        ANGLE_TRY(
+            (*metaDescriptorPools)[DescriptorSetIndex::UniformsAndXfb].bindCachedDescriptorPool(
+                context, mDefaultUniformAndXfbSetDesc, 1, descriptorSetLayoutCache,
+                &mDescriptorPools[DescriptorSetIndex::UniformsAndXfb]));
+    }
     ANGLE_TRY((*metaDescriptorPools)[DescriptorSetIndex::Texture].bindCachedDescriptorPool(
         context, mTextureSetDesc, mImmutableSamplersMaxDescriptorCount, descriptorSetLayoutCache,
         &mDescriptorPools[DescriptorSetIndex::Texture]));
@@ -1749,6 +2217,29 @@ angle::Result ProgramExecutableVk::getOrAllocateDescriptorSet(
     DescriptorSetIndex setIndex,
     vk::SharedDescriptorSetCacheKey *newSharedCacheKeyOut)
 {
+    if (mUsesDescriptorBuffer)
+    {
+        // Descriptors are written directly to the CPU copy of the descriptor buffer; there is no
+        // descriptor set to cache, so nothing needs to track this set for invalidation either.
+        const uint32_t *dynamicOffsets = setIndex == DescriptorSetIndex::UniformsAndXfb
+                                             ? mDynamicUniformDescriptorOffsets.data()
+                                             : descriptorSetDesc.getDynamicOffsets();
+        descriptorSetDesc.writeDescriptorBuffer(context->getRenderer(), writeDescriptorDescs,
+                                                dynamicOffsets, &mDescriptorBufferSets[setIndex]);
+        *newSharedCacheKeyOut = nullptr;
+        return angle::Result::Continue;
+    }
+
+    if (mUsesPushDescriptor && setIndex == DescriptorSetIndex::UniformsAndXfb)
+    {
+        // The descriptors are recorded to be pushed at bind time, which also resolves the dynamic
+        // offsets of the default uniforms.  As with descriptor buffers, there is no set to cache.
+        descriptorSetDesc.writePushDescriptors(
+            writeDescriptorDescs, mDynamicUniformDescriptorOffsets.data(), &mPushDescriptorSet);
+        *newSharedCacheKeyOut = nullptr;
+        return angle::Result::Continue;
+    }
+
     ANGLE_TRY(mDescriptorPools[setIndex].get().getOrAllocateDescriptorSet(
         context, commandBufferHelper, descriptorSetDesc.getDesc(),
         mDescriptorSetLayouts[setIndex].get(), &mDescriptorPoolBindings[setIndex],
@@ -1758,8 +2249,19 @@ angle::Result ProgramExecutableVk::getOrAllocateDescriptorSet(
     if (*newSharedCacheKeyOut != nullptr)
     {
         // Cache miss. A new cache entry has been created.
-        descriptorSetDesc.updateDescriptorSet(context->getRenderer(), writeDescriptorDescs,
-                                              updateBuilder, mDescriptorSets[setIndex]);
+        const vk::DescriptorUpdateTemplate *updateTemplate =
+            getDescriptorUpdateTemplate(setIndex, writeDescriptorDescs);
+        if (updateTemplate != nullptr)
+        {
+            descriptorSetDesc.updateDescriptorSetWithTemplate(
+                context->getRenderer(), writeDescriptorDescs, *updateTemplate, updateBuilder,
+                mDescriptorSets[setIndex]);
+        }
+        else
+        {
+            descriptorSetDesc.updateDescriptorSet(context->getRenderer(), writeDescriptorDescs,
+                                                  updateBuilder, mDescriptorSets[setIndex]);
+        }
     }
     else
     {
@@ -1777,6 +2279,13 @@ angle::Result ProgramExecutableVk::updateShaderResourcesDescriptorSet(
     const vk::DescriptorSetDescBuilder &shaderResourcesDesc,
     vk::SharedDescriptorSetCacheKey *newSharedCacheKeyOut)
 {
+    if (mUsesDescriptorBuffer)
+    {
+        return getOrAllocateDescriptorSet(context, updateBuilder, commandBufferHelper,
+                                          shaderResourcesDesc, writeDescriptorDescs,
+                                          DescriptorSetIndex::ShaderResource, newSharedCacheKeyOut);
+    }
+
     if (!mDescriptorPools[DescriptorSetIndex::ShaderResource].get().valid())
     {
         *newSharedCacheKeyOut = nullptr;
@@ -1824,6 +2333,18 @@ angle::Result ProgramExecutableVk::updateTexturesDescriptorSet(
     vk::CommandBufferHelperCommon *commandBufferHelper,
     const vk::DescriptorSetDesc &texturesDesc)
 {
+    if (mUsesDescriptorBuffer)
+    {
+        vk::DescriptorSetDescBuilder fullDesc(
+            mTextureWriteDescriptorDescs.getTotalDescriptorCount());
+        ANGLE_TRY(fullDesc.updateFullActiveTextures(context, mVariableInfoMap,
+                                                    mTextureWriteDescriptorDescs, *mExecutable,
+                                                    textures, samplers, pipelineType, nullptr));
+        fullDesc.writeDescriptorBuffer(context->getRenderer(), mTextureWriteDescriptorDescs,
+                                       nullptr, &mDescriptorBufferSets[DescriptorSetIndex::Texture]);
+        return angle::Result::Continue;
+    }
+
     vk::SharedDescriptorSetCacheKey newSharedCacheKey;
     ANGLE_TRY(mDescriptorPools[DescriptorSetIndex::Texture].get().getOrAllocateDescriptorSet(
         context, commandBufferHelper, texturesDesc,
@@ -1840,8 +2361,20 @@ angle::Result ProgramExecutableVk::updateTexturesDescriptorSet(
         ANGLE_TRY(fullDesc.updateFullActiveTextures(
             context, mVariableInfoMap, mTextureWriteDescriptorDescs, *mExecutable, textures,
             samplers, pipelineType, newSharedCacheKey));
-        fullDesc.updateDescriptorSet(context->getRenderer(), mTextureWriteDescriptorDescs,
-                                     updateBuilder, mDescriptorSets[DescriptorSetIndex::Texture]);
+        const vk::DescriptorUpdateTemplate *updateTemplate =
+            getDescriptorUpdateTemplate(DescriptorSetIndex::Texture, mTextureWriteDescriptorDescs);
+        if (updateTemplate != nullptr)
+        {
+            fullDesc.updateDescriptorSetWithTemplate(
+                context->getRenderer(), mTextureWriteDescriptorDescs, *updateTemplate,
+                updateBuilder, mDescriptorSets[DescriptorSetIndex::Texture]);
+        }
+        else
+        {
+            fullDesc.updateDescriptorSet(context->getRenderer(), mTextureWriteDescriptorDescs,
+                                         updateBuilder,
+                                         mDescriptorSets[DescriptorSetIndex::Texture]);
+        }
     }
     else
     {
@@ -1857,8 +2390,76 @@ angle::Result ProgramExecutableVk::bindDescriptorSets(
     vk::Context *context,
     vk::CommandBufferHelperCommon *commandBufferHelper,
     CommandBufferT *commandBuffer,
-    PipelineType pipelineType)
+    PipelineType pipelineType,
+    vk::DynamicBuffer *descriptorBufferStorage)
 {
+    const VkPipelineBindPoint pipelineBindPoint = pipelineType == PipelineType::Compute
+                                                      ? VK_PIPELINE_BIND_POINT_COMPUTE
+                                                      : VK_PIPELINE_BIND_POINT_GRAPHICS;
+
+    if (mUsesDescriptorBuffer)
+    {
+        // Copy the descriptors of all sets in one allocation of the descriptor buffer, and bind
+        // them in one go.  The descriptors are kept on the CPU side because the buffer region
+        // they are copied to may not be reused until the GPU is done with it.
+        vk::Renderer *renderer = context->getRenderer();
+        const VkDeviceSize alignment =
+            renderer->getPhysicalDeviceDescriptorBufferProperties().descriptorBufferOffsetAlignment;
+
+        std::array<VkDeviceSize, vk::kMaxDescriptorSetLayouts> setOffsets = {};
+        VkDeviceSize totalSize                                            = 0;
+        for (DescriptorSetIndex descriptorSetIndex : angle::AllEnums<DescriptorSetIndex>())
+        {
+            setOffsets[ToUnderlying(descriptorSetIndex)] = totalSize;
+            totalSize = roundUp(totalSize + mDescriptorBufferSets[descriptorSetIndex].getSize(),
+                                alignment);
+        }
+        totalSize = std::max(totalSize, alignment);
+
+        vk::BufferHelper *descriptorBuffer = nullptr;
+        ANGLE_TRY(descriptorBufferStorage->allocate(context, static_cast<size_t>(totalSize),
+                                                    &descriptorBuffer, nullptr));
+
+        uint8_t *bufferData = descriptorBuffer->getMappedMemory();
+        for (DescriptorSetIndex descriptorSetIndex : angle::AllEnums<DescriptorSetIndex>())
+        {
+            const vk::DescriptorBufferSet &descriptorBufferSet =
+                mDescriptorBufferSets[descriptorSetIndex];
+            VkDeviceSize &setOffset = setOffsets[ToUnderlying(descriptorSetIndex)];
+            if (descriptorBufferSet.getSize() > 0)
+            {
+                memcpy(bufferData + setOffset, descriptorBufferSet.getData(),
+                       static_cast<size_t>(descriptorBufferSet.getSize()));
+            }
+            setOffset += descriptorBuffer->getOffset();
+        }
+        ANGLE_TRY(descriptorBuffer->flush(renderer));
+
+        constexpr VkBufferUsageFlags kDescriptorBufferUsage =
+            VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT |
+            VK_BUFFER_USAGE_SAMPLER_DESCRIPTOR_BUFFER_BIT_EXT;
+        commandBuffer->bindDescriptorBuffers(
+            vk::GetBufferDeviceAddress(renderer->getDevice(),
+                                       descriptorBuffer->getBuffer().getHandle()),
+            kDescriptorBufferUsage);
+
+        constexpr std::array<uint32_t, vk::kMaxDescriptorSetLayouts> kBufferIndices = {};
+        commandBuffer->setDescriptorBufferOffsets(
+            getPipelineLayout(), pipelineBindPoint, DescriptorSetIndex::UniformsAndXfb,
+            static_cast<uint32_t>(vk::kMaxDescriptorSetLayouts), kBufferIndices.data(),
+            setOffsets.data());
+
+        return angle::Result::Continue;
+    }
+
+    if (mUsesPushDescriptor && mPushDescriptorSet.getWriteCount() > 0)
+    {
+        commandBuffer->pushDescriptorSet(getPipelineLayout(), pipelineBindPoint,
+                                         DescriptorSetIndex::UniformsAndXfb,
+                                         mPushDescriptorSet.getWriteCount(),
+                                         mPushDescriptorSet.getWrites());
+    }
+
     // Can probably use better dirty bits here.
 
     // Find the maximum non-null descriptor set.  This is used in conjunction with a driver
@@ -1873,10 +2474,6 @@ angle::Result ProgramExecutableVk::bindDescriptorSets(
         }
     }
 
-    const VkPipelineBindPoint pipelineBindPoint = pipelineType == PipelineType::Compute
-                                                      ? VK_PIPELINE_BIND_POINT_COMPUTE
-                                                      : VK_PIPELINE_BIND_POINT_GRAPHICS;
-
     for (DescriptorSetIndex descriptorSetIndex : angle::AllEnums<DescriptorSetIndex>())
     {
         if (ToUnderlying(descriptorSetIndex) > ToUnderlying(lastNonNullDescriptorSetIndex))
@@ -1921,12 +2518,14 @@ template angle::Result ProgramExecutableVk::bindDescriptorSets<vk::priv::Seconda
     vk::Context *context,
     vk::CommandBufferHelperCommon *commandBufferHelper,
     vk::priv::SecondaryCommandBuffer *commandBuffer,
-    PipelineType pipelineType);
+    PipelineType pipelineType,
+    vk::DynamicBuffer *descriptorBufferStorage);
 template angle::Result ProgramExecutableVk::bindDescriptorSets<vk::VulkanSecondaryCommandBuffer>(
     vk::Context *context,
     vk::CommandBufferHelperCommon *commandBufferHelper,
     vk::VulkanSecondaryCommandBuffer *commandBuffer,
-    PipelineType pipelineType);
+    PipelineType pipelineType,
+    vk::DynamicBuffer *descriptorBufferStorage);
 
 void ProgramExecutableVk::setAllDefaultUniformsDirty()
 {
@@ -2000,7 +2599,10 @@ angle::Result ProgramExecutableVk::updateUniforms(
     // use that recorded BufferSerial compare to the current uniform buffer to quickly detect if
     // there is a buffer switch or not. We need to retrieve from the descriptor set cache or
     // allocate a new descriptor set whenever there is uniform buffer switch.
-    if (mCurrentDefaultUniformBufferSerial != defaultUniformBuffer->getBufferSerial())
+    // With descriptor buffers and push descriptors, the dynamic offsets are part of the descriptors
+    // themselves, so the set is rewritten every time the uniforms are updated.
+    if (mUsesDescriptorBuffer || mUsesPushDescriptor ||
+        mCurrentDefaultUniformBufferSerial != defaultUniformBuffer->getBufferSerial())
     {
         // We need to reinitialize the descriptor sets if we newly allocated buffers since we can't
         // modify the descriptor sets once initialized.
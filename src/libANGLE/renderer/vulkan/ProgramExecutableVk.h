@@ -241,11 +241,21 @@ class ProgramExecutableVk : public ProgramExecutableImpl
         vk::DescriptorSetDescBuilder *uniformsAndXfbDesc,
         vk::SharedDescriptorSetCacheKey *sharedCacheKeyOut);
 
+    // |descriptorBufferStorage| is only used when the executable uses descriptor buffers, in which
+    // case the descriptors of all sets are copied into it and bound with
+    // vkCmdSetDescriptorBufferOffsetsEXT.
     template <typename CommandBufferT>
     angle::Result bindDescriptorSets(vk::Context *context,
                                      vk::CommandBufferHelperCommon *commandBufferHelper,
                                      CommandBufferT *commandBuffer,
-                                     PipelineType pipelineType);
+                                     PipelineType pipelineType,
+                                     vk::DynamicBuffer *descriptorBufferStorage);
+
+    // Whether descriptors of this executable are written to descriptor buffers
+    // (VK_EXT_descriptor_buffer) instead of being allocated from descriptor pools.
+    bool usesDescriptorBuffer() const { return mUsesDescriptorBuffer; }
+    // Whether the default uniforms set is pushed with VK_KHR_push_descriptor.
+    bool usesPushDescriptor() const { return mUsesPushDescriptor; }
 
     bool usesDynamicUniformBufferDescriptors() const
     {
@@ -342,6 +352,18 @@ class ProgramExecutableVk : public ProgramExecutableImpl
     void waitForGraphicsPostLinkTasks(ContextVk *contextVk,
                                       const vk::GraphicsPipelineDesc &currentGraphicsPipelineDesc);
 
+    // Looks up the graphics pipelines that draw calls used with this program in previous runs, as
+    // recorded in the blob cache.  From then on, new pipelines created by draw calls are recorded
+    // too.  May be called from the link or load task.
+    void loadGraphicsPipelineHistory(vk::Renderer *renderer);
+    // Creates tasks that precompile the recorded graphics pipelines of a program that is loaded
+    // from a binary.  After link, these tasks are created by getPipelineCacheWarmUpTasks().
+    angle::Result getGraphicsPipelinePrecompileTasks(
+        vk::Context *context,
+        vk::PipelineRobustness pipelineRobustness,
+        vk::PipelineProtectedAccess pipelineProtectedAccess,
+        std::vector<std::shared_ptr<LinkSubTask>> *postLinkSubTasksOut);
+
     angle::Result mergePipelineCacheToRenderer(vk::Context *context) const;
 
     const vk::WriteDescriptorDescs &getShaderResourceWriteDescriptorDescs() const
@@ -384,6 +406,14 @@ class ProgramExecutableVk : public ProgramExecutableImpl
     class WarmUpComputeTask;
     class WarmUpGraphicsTask;
 
+    // A graphics pipeline that was created for a draw call, identified by its desc and the
+    // permutation of the program it was created for.
+    struct RecordedGraphicsPipeline
+    {
+        ProgramTransformOptions transformOptions;
+        vk::GraphicsPipelineDesc desc;
+    };
+
     friend class ProgramVk;
     friend class ProgramPipelineVk;
 
@@ -493,12 +523,35 @@ class ProgramExecutableVk : public ProgramExecutableImpl
                                               vk::PipelineRobustness pipelineRobustness,
                                               vk::PipelineProtectedAccess pipelineProtectedAccess,
                                               vk::GraphicsPipelineSubset subset,
-                                              const bool isSurfaceRotated,
+                                              ProgramTransformOptions transformOptions,
                                               const vk::GraphicsPipelineDesc &graphicsPipelineDesc,
-                                              const vk::RenderPass &renderPass,
+                                              const vk::RenderPass *renderPass,
                                               vk::PipelineHelper *placeholderPipelineHelper);
     void waitForPostLinkTasksImpl(ContextVk *contextVk);
 
+    // Helpers for precompiling the graphics pipelines recorded in mGraphicsPipelineHistory.  The
+    // shader programs of all recorded permutations are initialized first, so that creating the
+    // tasks cannot fail.
+    angle::Result initGraphicsPipelineHistoryPrograms(vk::Context *context);
+    void addGraphicsPipelinePrecompileTasks(
+        vk::Renderer *renderer,
+        vk::PipelineRobustness pipelineRobustness,
+        vk::PipelineProtectedAccess pipelineProtectedAccess,
+        vk::GraphicsPipelineSubset subset,
+        vk::AtomicRefCounted<vk::RenderPass> *sharedRenderPass,
+        std::vector<std::shared_ptr<LinkSubTask>> *tasksOut);
+    bool isPendingPrecompiledGraphicsPipeline(ProgramTransformOptions transformOptions,
+                                              const vk::GraphicsPipelineDesc &desc,
+                                              vk::GraphicsPipelineSubset subset) const;
+    void onPrecompiledGraphicsPipelineUsed(ContextVk *contextVk,
+                                           ProgramTransformOptions transformOptions,
+                                           const vk::GraphicsPipelineDesc &desc,
+                                           vk::GraphicsPipelineSubset subset);
+    void recordGraphicsPipeline(ContextVk *contextVk,
+                                ProgramTransformOptions transformOptions,
+                                const vk::GraphicsPipelineDesc &desc,
+                                vk::GraphicsPipelineSubset subset);
+
     angle::Result getOrAllocateDescriptorSet(vk::Context *context,
                                              UpdateDescriptorSetsBuilder *updateBuilder,
                                              vk::CommandBufferHelperCommon *commandBufferHelper,
@@ -516,6 +569,17 @@ class ProgramExecutableVk : public ProgramExecutableImpl
 
     void initializeWriteDescriptorDesc(vk::Context *context);
 
+    // Texel buffer descriptors are not written to descriptor buffers, so programs that use them
+    // fall back to descriptor sets.
+    bool usesTexelBuffers() const;
+
+    angle::Result initDescriptorUpdateTemplates(vk::Context *context);
+    // Returns the template to update a descriptor set of |setIndex| described by
+    // |writeDescriptorDescs|, or nullptr if there is none.
+    const vk::DescriptorUpdateTemplate *getDescriptorUpdateTemplate(
+        DescriptorSetIndex setIndex,
+        const vk::WriteDescriptorDescs &writeDescriptorDescs) const;
+
     // Descriptor sets and pools for shader resources for this program.
     vk::DescriptorSetArray<VkDescriptorSet> mDescriptorSets;
     vk::DescriptorSetArray<vk::DescriptorPoolPointer> mDescriptorPools;
@@ -534,14 +598,30 @@ class ProgramExecutableVk : public ProgramExecutableImpl
     gl::ShaderVector<uint32_t> mDynamicUniformDescriptorOffsets;
     std::vector<uint32_t> mDynamicShaderResourceDescriptorOffsets;
 
+    // With VK_EXT_descriptor_buffer, descriptors are written to a CPU-side copy of each set and
+    // copied to a descriptor buffer at bind time.
+    bool mUsesDescriptorBuffer;
+    vk::DescriptorSetArray<vk::DescriptorBufferSet> mDescriptorBufferSets;
+
+    // With VK_KHR_push_descriptor, the default uniforms and transform feedback descriptors are
+    // recorded here when updated, and pushed at bind time.
+    bool mUsesPushDescriptor;
+    vk::PushDescriptorSet mPushDescriptorSet;
+
+    // Templates that write each descriptor set in a single call, created from the "layout"
+    // information below.  The uniforms set has a separate template for when transform feedback
+    // buffers are also written.
+    vk::DescriptorSetArray<vk::DescriptorUpdateTemplate> mDescriptorUpdateTemplates;
+    vk::DescriptorUpdateTemplate mDefaultUniformAndXfbDescriptorUpdateTemplate;
+
     ShaderInterfaceVariableInfoMap mVariableInfoMap;
 
     static_assert((ProgramTransformOptions::kPermutationCount == 16),
                   "ProgramTransformOptions::kPermutationCount must be 16.");
     angle::BitSet16<ProgramTransformOptions::kPermutationCount> mValidGraphicsPermutations;
 
-    static_assert((vk::ComputePipelineOptions::kPermutationCount == 4),
-                  "ComputePipelineOptions::kPermutationCount must be 4.");
+    static_assert((vk::ComputePipelineOptions::kPermutationCount == 8),
+                  "ComputePipelineOptions::kPermutationCount must be 8.");
     angle::BitSet8<vk::ComputePipelineOptions::kPermutationCount> mValidComputePermutations;
 
     // We store all permutations of surface rotation and transformed SPIR-V programs here. We may
@@ -582,6 +662,17 @@ class ProgramExecutableVk : public ProgramExecutableImpl
 
     vk::GraphicsPipelineDesc mWarmUpGraphicsPipelineDesc;
 
+    // The graphics pipelines that draw calls needed with this program, most recent last.  This
+    // list is kept in the blob cache under |mGraphicsPipelineHistoryKey|, which is derived from the
+    // program's SPIR-V so that it is shared between glLinkProgram and glProgramBinary.  The next
+    // time the program is linked or loaded, these pipelines are precompiled in post-link tasks.
+    bool mRecordGraphicsPipelines = false;
+    angle::BlobCacheKey mGraphicsPipelineHistoryKey;
+    std::vector<RecordedGraphicsPipeline> mGraphicsPipelineHistory;
+    // The precompiled pipelines that no draw call has used yet.  Draw calls that need one of these
+    // pipelines wait for the post-link tasks.
+    std::vector<RecordedGraphicsPipeline> mPendingPrecompiledGraphicsPipelines;
+
     // The "layout" information for descriptorSets
     vk::WriteDescriptorDescs mShaderResourceWriteDescriptorDescs;
     vk::WriteDescriptorDescs mTextureWriteDescriptorDescs;
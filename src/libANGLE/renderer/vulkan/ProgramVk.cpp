@@ -170,6 +170,75 @@ class LinkTaskVk final : public vk::Context, public LinkTask
     unsigned int mErrorLine    = 0;
 };
 
+// When a program is loaded from a binary, its pipeline cache is restored from the binary instead of
+// being warmed up.  The load task only precompiles the pipelines that draw calls used in previous
+// runs of the program.
+class LoadTaskVk final : public vk::Context, public LinkTask
+{
+  public:
+    LoadTaskVk(vk::Renderer *renderer,
+               const gl::ProgramState &state,
+               vk::PipelineRobustness pipelineRobustness,
+               vk::PipelineProtectedAccess pipelineProtectedAccess)
+        : vk::Context(renderer),
+          mExecutable(&state.getExecutable()),
+          mPipelineRobustness(pipelineRobustness),
+          mPipelineProtectedAccess(pipelineProtectedAccess)
+    {}
+    ~LoadTaskVk() override = default;
+
+    void load(std::vector<std::shared_ptr<LinkSubTask>> *linkSubTasksOut,
+              std::vector<std::shared_ptr<LinkSubTask>> *postLinkSubTasksOut) override
+    {
+        ASSERT(linkSubTasksOut && linkSubTasksOut->empty());
+        ASSERT(postLinkSubTasksOut && postLinkSubTasksOut->empty());
+
+        ProgramExecutableVk *executableVk = vk::GetImpl(mExecutable);
+        executableVk->loadGraphicsPipelineHistory(mRenderer);
+
+        angle::Result result = executableVk->getGraphicsPipelinePrecompileTasks(
+            this, mPipelineRobustness, mPipelineProtectedAccess, postLinkSubTasksOut);
+        ASSERT((result == angle::Result::Continue) == (mErrorCode == VK_SUCCESS));
+    }
+
+    void handleError(VkResult result,
+                     const char *file,
+                     const char *function,
+                     unsigned int line) override
+    {
+        mErrorCode     = result;
+        mErrorFile     = file;
+        mErrorFunction = function;
+        mErrorLine     = line;
+    }
+
+    angle::Result getResult(const gl::Context *context, gl::InfoLog &infoLog) override
+    {
+        // Forward any errors
+        if (mErrorCode != VK_SUCCESS)
+        {
+            ContextVk *contextVk = vk::GetImpl(context);
+            contextVk->handleError(mErrorCode, mErrorFile, mErrorFunction, mErrorLine);
+            return angle::Result::Stop;
+        }
+
+        return angle::Result::Continue;
+    }
+
+  private:
+    // The front-end ensures that the program is not accessed while loading, so it is safe to
+    // directly access the executable from a potentially parallel job.
+    const gl::ProgramExecutable *mExecutable;
+    const vk::PipelineRobustness mPipelineRobustness;
+    const vk::PipelineProtectedAccess mPipelineProtectedAccess;
+
+    // Error handling
+    VkResult mErrorCode        = VK_SUCCESS;
+    const char *mErrorFile     = nullptr;
+    const char *mErrorFunction = nullptr;
+    unsigned int mErrorLine    = 0;
+};
+
 angle::Result LinkTaskVk::linkImpl(const gl::ProgramLinkedResources &resources,
                                    const gl::ProgramMergedVaryings &mergedVaryings,
                                    std::vector<std::shared_ptr<LinkSubTask>> *postLinkSubTasksOut)
@@ -216,6 +285,13 @@ angle::Result LinkTaskVk::linkImpl(const gl::ProgramLinkedResources &resources,
     // - Individual GLES1 tests are long, and this adds a considerable overhead to those tests
     if (!mState.isSeparable() && !mIsGLES1 && getFeatures().warmUpPipelineCacheAtLink.enabled)
     {
+        // The pipelines that draw calls used in previous runs of this program are precompiled
+        // along with the warm up.
+        if (getFeatures().precompileRecordedGraphicsPipelines.enabled)
+        {
+            executableVk->loadGraphicsPipelineHistory(mRenderer);
+        }
+
         ANGLE_TRY(executableVk->getPipelineCacheWarmUpTasks(
             mRenderer, mPipelineRobustness, mPipelineProtectedAccess, postLinkSubTasksOut));
     }
@@ -351,7 +427,20 @@ angle::Result ProgramVk::load(const gl::Context *context,
     // TODO: parallelize program load.  http://anglebug.com/41488637
     *loadTaskOut = {};
 
-    return getExecutable()->load(contextVk, mState.isSeparable(), stream, resultOut);
+    ANGLE_TRY(getExecutable()->load(contextVk, mState.isSeparable(), stream, resultOut));
+
+    // Precompile the pipelines that draw calls used in previous runs of this program.  Like the
+    // pipeline cache warm up after link, this is not done for separable and GLES1 programs.
+    if (*resultOut == egl::CacheGetResult::Success && !mState.isSeparable() &&
+        !context->getState().isGLES1() &&
+        contextVk->getFeatures().precompileRecordedGraphicsPipelines.enabled)
+    {
+        *loadTaskOut = std::shared_ptr<LinkTask>(
+            new LoadTaskVk(contextVk->getRenderer(), mState, contextVk->pipelineRobustness(),
+                           contextVk->pipelineProtectedAccess()));
+    }
+
+    return angle::Result::Continue;
 }
 
 void ProgramVk::save(const gl::Context *context, gl::BinaryOutputStream *stream)
@@ -34,6 +34,8 @@ const char *GetCommandString(CommandID id)
             return "BeginTransformFeedback";
         case CommandID::BindComputePipeline:
             return "BindComputePipeline";
+        case CommandID::BindDescriptorBuffers:
+            return "BindDescriptorBuffers";
         case CommandID::BindDescriptorSets:
             return "BindDescriptorSets";
         case CommandID::BindGraphicsPipeline:
@@ -88,6 +90,10 @@ const char *GetCommandString(CommandID id)
             return "DrawInstanced";
         case CommandID::DrawInstancedBaseInstance:
             return "DrawInstancedBaseInstance";
+        case CommandID::DrawMulti:
+            return "DrawMulti";
+        case CommandID::DrawMultiIndexed:
+            return "DrawMultiIndexed";
         case CommandID::EndDebugUtilsLabel:
             return "EndDebugUtilsLabel";
         case CommandID::EndQuery:
@@ -110,6 +116,8 @@ const char *GetCommandString(CommandID id)
             return "PipelineBarrier";
         case CommandID::PushConstants:
             return "PushConstants";
+        case CommandID::PushDescriptorSet:
+            return "PushDescriptorSet";
         case CommandID::ResetEvent:
             return "ResetEvent";
         case CommandID::ResetQueryPool:
@@ -130,6 +138,8 @@ const char *GetCommandString(CommandID id)
             return "SetDepthTestEnable";
         case CommandID::SetDepthWriteEnable:
             return "SetDepthWriteEnable";
+        case CommandID::SetDescriptorBufferOffsets:
+            return "SetDescriptorBufferOffsets";
         case CommandID::SetEvent:
             return "SetEvent";
         case CommandID::SetFragmentShadingRate:
@@ -251,6 +261,17 @@ void SecondaryCommandBuffer::executeCommands(PrimaryCommandBuffer *primary)
                     vkCmdBindPipeline(cmdBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, params->pipeline);
                     break;
                 }
+                case CommandID::BindDescriptorBuffers:
+                {
+                    const BindDescriptorBuffersParams *params =
+                        getParamPtr<BindDescriptorBuffersParams>(currentCommand);
+                    VkDescriptorBufferBindingInfoEXT bindingInfo = {};
+                    bindingInfo.sType   = VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_INFO_EXT;
+                    bindingInfo.address = params->address;
+                    bindingInfo.usage   = params->usage;
+                    vkCmdBindDescriptorBuffersEXT(cmdBuffer, 1, &bindingInfo);
+                    break;
+                }
                 case CommandID::BindDescriptorSets:
                 {
                     const BindDescriptorSetParams *params =
@@ -494,6 +515,26 @@ void SecondaryCommandBuffer::executeCommands(PrimaryCommandBuffer *primary)
                               params->firstVertex, params->firstInstance);
                     break;
                 }
+                case CommandID::DrawMulti:
+                {
+                    const DrawMultiParams *params = getParamPtr<DrawMultiParams>(currentCommand);
+                    const VkMultiDrawInfoEXT *vertexInfo =
+                        GetFirstArrayParameter<VkMultiDrawInfoEXT>(params);
+                    vkCmdDrawMultiEXT(cmdBuffer, params->drawCount, vertexInfo,
+                                      params->instanceCount, params->firstInstance,
+                                      sizeof(VkMultiDrawInfoEXT));
+                    break;
+                }
+                case CommandID::DrawMultiIndexed:
+                {
+                    const DrawMultiParams *params = getParamPtr<DrawMultiParams>(currentCommand);
+                    const VkMultiDrawIndexedInfoEXT *indexInfo =
+                        GetFirstArrayParameter<VkMultiDrawIndexedInfoEXT>(params);
+                    vkCmdDrawMultiIndexedEXT(cmdBuffer, params->drawCount, indexInfo,
+                                             params->instanceCount, params->firstInstance,
+                                             sizeof(VkMultiDrawIndexedInfoEXT), nullptr);
+                    break;
+                }
                 case CommandID::EndDebugUtilsLabel:
                 {
                     ASSERT(vkCmdEndDebugUtilsLabelEXT);
@@ -657,6 +698,33 @@ void SecondaryCommandBuffer::executeCommands(PrimaryCommandBuffer *primary)
                                        params->size, data);
                     break;
                 }
+                case CommandID::PushDescriptorSet:
+                {
+                    const PushDescriptorSetParams *params =
+                        getParamPtr<PushDescriptorSetParams>(currentCommand);
+                    const PushDescriptorSetWrite *compactWrites =
+                        GetFirstArrayParameter<PushDescriptorSetWrite>(params);
+                    const VkDescriptorBufferInfo *bufferInfos =
+                        GetNextArrayParameter<VkDescriptorBufferInfo>(compactWrites,
+                                                                      params->writeCount);
+
+                    angle::FastVector<VkWriteDescriptorSet, 8> writes(params->writeCount);
+                    for (uint32_t writeIndex = 0; writeIndex < params->writeCount; ++writeIndex)
+                    {
+                        const PushDescriptorSetWrite &compactWrite = compactWrites[writeIndex];
+                        VkWriteDescriptorSet &write                = writes[writeIndex];
+                        write                                      = {};
+                        write.sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+                        write.dstBinding      = compactWrite.binding;
+                        write.descriptorCount = compactWrite.descriptorCount;
+                        write.descriptorType  = compactWrite.descriptorType;
+                        write.pBufferInfo     = bufferInfos;
+                        bufferInfos += compactWrite.descriptorCount;
+                    }
+                    vkCmdPushDescriptorSetKHR(cmdBuffer, params->pipelineBindPoint, params->layout,
+                                              params->set, params->writeCount, writes.data());
+                    break;
+                }
                 case CommandID::ResetEvent:
                 {
                     const ResetEventParams *params = getParamPtr<ResetEventParams>(currentCommand);
@@ -730,6 +798,18 @@ void SecondaryCommandBuffer::executeCommands(PrimaryCommandBuffer *primary)
                     vkCmdSetDepthWriteEnableEXT(cmdBuffer, params->depthWriteEnable);
                     break;
                 }
+                case CommandID::SetDescriptorBufferOffsets:
+                {
+                    const SetDescriptorBufferOffsetsParams *params =
+                        getParamPtr<SetDescriptorBufferOffsetsParams>(currentCommand);
+                    const VkDeviceSize *offsets = GetFirstArrayParameter<VkDeviceSize>(params);
+                    const uint32_t *bufferIndices =
+                        GetNextArrayParameter<uint32_t>(offsets, params->setCount);
+                    vkCmdSetDescriptorBufferOffsetsEXT(cmdBuffer, params->pipelineBindPoint,
+                                                       params->layout, params->firstSet,
+                                                       params->setCount, bufferIndices, offsets);
+                    break;
+                }
                 case CommandID::SetEvent:
                 {
                     const SetEventParams *params = getParamPtr<SetEventParams>(currentCommand);
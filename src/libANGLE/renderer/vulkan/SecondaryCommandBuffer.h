@@ -55,6 +55,7 @@ enum class CommandID : uint16_t
     BeginQuery,
     BeginTransformFeedback,
     BindComputePipeline,
+    BindDescriptorBuffers,
     BindDescriptorSets,
     BindGraphicsPipeline,
     BindIndexBuffer,
@@ -83,6 +84,8 @@ enum class CommandID : uint16_t
     DrawIndirect,
     DrawInstanced,
     DrawInstancedBaseInstance,
+    DrawMulti,
+    DrawMultiIndexed,
     EndDebugUtilsLabel,
     EndQuery,
     EndTransformFeedback,
@@ -97,6 +100,7 @@ enum class CommandID : uint16_t
     PipelineBarrier,
     PipelineBarrier2,
     PushConstants,
+    PushDescriptorSet,
     ResetEvent,
     ResetQueryPool,
     ResolveImage,
@@ -107,6 +111,7 @@ enum class CommandID : uint16_t
     SetDepthCompareOp,
     SetDepthTestEnable,
     SetDepthWriteEnable,
+    SetDescriptorBufferOffsets,
     SetEvent,
     SetFragmentShadingRate,
     SetFrontFace,
@@ -160,6 +165,16 @@ struct BeginTransformFeedbackParams
 };
 VERIFY_8_BYTE_ALIGNMENT(BeginTransformFeedbackParams)
 
+struct BindDescriptorBuffersParams
+{
+    CommandHeader header;
+
+    // ANGLE always binds a single descriptor buffer
+    VkBufferUsageFlags usage;
+    VkDeviceAddress address;
+};
+VERIFY_8_BYTE_ALIGNMENT(BindDescriptorBuffersParams)
+
 struct BindDescriptorSetParams
 {
     CommandHeader header;
@@ -445,6 +460,18 @@ struct DrawInstancedBaseInstanceParams
 };
 VERIFY_8_BYTE_ALIGNMENT(DrawInstancedBaseInstanceParams)
 
+// Used by both DrawMulti and DrawMultiIndexed.  The VkMultiDrawInfoEXT or
+// VkMultiDrawIndexedInfoEXT array follows.
+struct DrawMultiParams
+{
+    CommandHeader header;
+
+    uint32_t drawCount;
+    uint32_t instanceCount;
+    uint32_t firstInstance;
+};
+VERIFY_8_BYTE_ALIGNMENT(DrawMultiParams)
+
 // A special struct used with commands that don't have params
 struct EmptyParams
 {
@@ -560,6 +587,27 @@ struct PushConstantsParams
 };
 VERIFY_8_BYTE_ALIGNMENT(PushConstantsParams)
 
+struct PushDescriptorSetParams
+{
+    CommandHeader header;
+
+    VkPipelineBindPoint pipelineBindPoint : 8;
+    uint32_t set : 8;
+    uint32_t writeCount : 16;
+
+    VkPipelineLayout layout;
+};
+VERIFY_8_BYTE_ALIGNMENT(PushDescriptorSetParams)
+
+// Compact form of a VkWriteDescriptorSet with buffer descriptors, stored after
+// PushDescriptorSetParams.  The VkDescriptorBufferInfos of all writes follow.
+struct PushDescriptorSetWrite
+{
+    uint32_t binding;
+    VkDescriptorType descriptorType;
+    uint32_t descriptorCount;
+};
+
 struct ResetEventParams
 {
     CommandHeader header;
@@ -648,6 +696,19 @@ struct SetDepthWriteEnableParams
 };
 VERIFY_8_BYTE_ALIGNMENT(SetDepthWriteEnableParams)
 
+struct SetDescriptorBufferOffsetsParams
+{
+    CommandHeader header;
+
+    VkPipelineBindPoint pipelineBindPoint : 8;
+    uint32_t firstSet : 8;
+    uint32_t setCount : 8;
+    uint32_t padding : 8;
+
+    VkPipelineLayout layout;
+};
+VERIFY_8_BYTE_ALIGNMENT(SetDescriptorBufferOffsetsParams)
+
 struct SetEventParams
 {
     CommandHeader header;
@@ -862,6 +923,8 @@ class SecondaryCommandBuffer final : angle::NonCopyable
 
     void bindComputePipeline(const Pipeline &pipeline);
 
+    void bindDescriptorBuffers(VkDeviceAddress address, VkBufferUsageFlags usage);
+
     void bindDescriptorSets(const PipelineLayout &layout,
                             VkPipelineBindPoint pipelineBindPoint,
                             DescriptorSetIndex firstSet,
@@ -979,6 +1042,14 @@ class SecondaryCommandBuffer final : angle::NonCopyable
                                    uint32_t instanceCount,
                                    uint32_t firstVertex,
                                    uint32_t firstInstance);
+    void drawMulti(uint32_t drawCount,
+                   const VkMultiDrawInfoEXT *vertexInfo,
+                   uint32_t instanceCount,
+                   uint32_t firstInstance);
+    void drawMultiIndexed(uint32_t drawCount,
+                          const VkMultiDrawIndexedInfoEXT *indexInfo,
+                          uint32_t instanceCount,
+                          uint32_t firstInstance);
 
     void endDebugUtilsLabelEXT();
 
@@ -1040,6 +1111,12 @@ class SecondaryCommandBuffer final : angle::NonCopyable
                        uint32_t size,
                        const void *data);
 
+    void pushDescriptorSet(const PipelineLayout &layout,
+                           VkPipelineBindPoint pipelineBindPoint,
+                           DescriptorSetIndex set,
+                           uint32_t writeCount,
+                           const VkWriteDescriptorSet *writes);
+
     void resetEvent(VkEvent event, VkPipelineStageFlags stageMask);
 
     void resetQueryPool(const QueryPool &queryPool, uint32_t firstQuery, uint32_t queryCount);
@@ -1060,6 +1137,12 @@ class SecondaryCommandBuffer final : angle::NonCopyable
     void setDepthCompareOp(VkCompareOp depthCompareOp);
     void setDepthTestEnable(VkBool32 depthTestEnable);
     void setDepthWriteEnable(VkBool32 depthWriteEnable);
+    void setDescriptorBufferOffsets(const PipelineLayout &layout,
+                                    VkPipelineBindPoint pipelineBindPoint,
+                                    DescriptorSetIndex firstSet,
+                                    uint32_t setCount,
+                                    const uint32_t *bufferIndices,
+                                    const VkDeviceSize *offsets);
     void setEvent(VkEvent event, VkPipelineStageFlags stageMask);
     void setFragmentShadingRate(const VkExtent2D *fragmentSize,
                                 VkFragmentShadingRateCombinerOpKHR ops[2]);
@@ -1175,6 +1258,11 @@ class SecondaryCommandBuffer final : angle::NonCopyable
 
   private:
     void commonDebugUtilsLabel(CommandID cmd, const VkDebugUtilsLabelEXT &label);
+    template <CommandID kCommandID, typename DrawInfoT>
+    void drawMultiImpl(uint32_t drawCount,
+                       const DrawInfoT *drawInfo,
+                       uint32_t instanceCount,
+                       uint32_t firstInstance);
     template <class StructType>
     ANGLE_INLINE StructType *commonInit(CommandID cmdID,
                                         size_t allocationSize,
@@ -1339,6 +1427,15 @@ ANGLE_INLINE void SecondaryCommandBuffer::bindComputePipeline(const Pipeline &pi
     paramStruct->pipeline = pipeline.getHandle();
 }
 
+ANGLE_INLINE void SecondaryCommandBuffer::bindDescriptorBuffers(VkDeviceAddress address,
+                                                                VkBufferUsageFlags usage)
+{
+    BindDescriptorBuffersParams *paramStruct =
+        initCommand<BindDescriptorBuffersParams>(CommandID::BindDescriptorBuffers);
+    paramStruct->usage   = usage;
+    paramStruct->address = address;
+}
+
 ANGLE_INLINE void SecondaryCommandBuffer::bindDescriptorSets(const PipelineLayout &layout,
                                                              VkPipelineBindPoint pipelineBindPoint,
                                                              DescriptorSetIndex firstSet,
@@ -1753,6 +1850,57 @@ ANGLE_INLINE void SecondaryCommandBuffer::drawInstancedBaseInstance(uint32_t ver
     mCommandTracker.onDraw();
 }
 
+template <CommandID kCommandID, typename DrawInfoT>
+ANGLE_INLINE void SecondaryCommandBuffer::drawMultiImpl(uint32_t drawCount,
+                                                        const DrawInfoT *drawInfo,
+                                                        uint32_t instanceCount,
+                                                        uint32_t firstInstance)
+{
+    // The command size is limited, so large batches are split in multiple commands.
+    constexpr uint32_t kMaxDrawsPerCommand = 1024;
+    static_assert(sizeof(DrawMultiParams) + sizeof(DrawInfoT) * kMaxDrawsPerCommand <=
+                      std::numeric_limits<uint16_t>::max(),
+                  "Too many draws per command");
+
+    while (drawCount > 0)
+    {
+        const uint32_t commandDrawCount = std::min(drawCount, kMaxDrawsPerCommand);
+        const ArrayParamSize drawInfoSize =
+            calculateArrayParameterSize<DrawInfoT>(commandDrawCount);
+        uint8_t *writePtr;
+        DrawMultiParams *paramStruct =
+            initCommand<DrawMultiParams>(kCommandID, drawInfoSize.allocateBytes, &writePtr);
+        paramStruct->drawCount     = commandDrawCount;
+        paramStruct->instanceCount = instanceCount;
+        paramStruct->firstInstance = firstInstance;
+        // Copy variable sized data
+        storeArrayParameter(writePtr, drawInfo, drawInfoSize);
+
+        drawInfo += commandDrawCount;
+        drawCount -= commandDrawCount;
+    }
+
+    mCommandTracker.onDraw();
+}
+
+ANGLE_INLINE void SecondaryCommandBuffer::drawMulti(uint32_t drawCount,
+                                                    const VkMultiDrawInfoEXT *vertexInfo,
+                                                    uint32_t instanceCount,
+                                                    uint32_t firstInstance)
+{
+    drawMultiImpl<CommandID::DrawMulti>(drawCount, vertexInfo, instanceCount, firstInstance);
+}
+
+ANGLE_INLINE void SecondaryCommandBuffer::drawMultiIndexed(
+    uint32_t drawCount,
+    const VkMultiDrawIndexedInfoEXT *indexInfo,
+    uint32_t instanceCount,
+    uint32_t firstInstance)
+{
+    drawMultiImpl<CommandID::DrawMultiIndexed>(drawCount, indexInfo, instanceCount,
+                                               firstInstance);
+}
+
 ANGLE_INLINE void SecondaryCommandBuffer::endDebugUtilsLabelEXT()
 {
     initCommand<EmptyParams>(CommandID::EndDebugUtilsLabel);
@@ -1978,6 +2126,48 @@ ANGLE_INLINE void SecondaryCommandBuffer::pushConstants(const PipelineLayout &la
     storeArrayParameter(writePtr, data, dataSize);
 }
 
+ANGLE_INLINE void SecondaryCommandBuffer::pushDescriptorSet(const PipelineLayout &layout,
+                                                            VkPipelineBindPoint pipelineBindPoint,
+                                                            DescriptorSetIndex set,
+                                                            uint32_t writeCount,
+                                                            const VkWriteDescriptorSet *writes)
+{
+    uint32_t bufferInfoCount = 0;
+    for (uint32_t writeIndex = 0; writeIndex < writeCount; ++writeIndex)
+    {
+        ASSERT(writes[writeIndex].pBufferInfo != nullptr);
+        bufferInfoCount += writes[writeIndex].descriptorCount;
+    }
+
+    const ArrayParamSize writeSize =
+        calculateArrayParameterSize<PushDescriptorSetWrite>(writeCount);
+    const ArrayParamSize bufferInfoSize =
+        calculateArrayParameterSize<VkDescriptorBufferInfo>(bufferInfoCount);
+    uint8_t *writePtr;
+    PushDescriptorSetParams *paramStruct = initCommand<PushDescriptorSetParams>(
+        CommandID::PushDescriptorSet, writeSize.allocateBytes + bufferInfoSize.allocateBytes,
+        &writePtr);
+    paramStruct->layout = layout.getHandle();
+    SetBitField(paramStruct->pipelineBindPoint, pipelineBindPoint);
+    SetBitField(paramStruct->set, ToUnderlying(set));
+    SetBitField(paramStruct->writeCount, writeCount);
+
+    // Copy variable sized data
+    PushDescriptorSetWrite *compactWrites = reinterpret_cast<PushDescriptorSetWrite *>(writePtr);
+    VkDescriptorBufferInfo *bufferInfos =
+        reinterpret_cast<VkDescriptorBufferInfo *>(writePtr + writeSize.allocateBytes);
+    for (uint32_t writeIndex = 0; writeIndex < writeCount; ++writeIndex)
+    {
+        const VkWriteDescriptorSet &write        = writes[writeIndex];
+        compactWrites[writeIndex].binding         = write.dstBinding;
+        compactWrites[writeIndex].descriptorType  = write.descriptorType;
+        compactWrites[writeIndex].descriptorCount = write.descriptorCount;
+        memcpy(bufferInfos, write.pBufferInfo,
+               write.descriptorCount * sizeof(VkDescriptorBufferInfo));
+        bufferInfos += write.descriptorCount;
+    }
+}
+
 ANGLE_INLINE void SecondaryCommandBuffer::resetEvent(VkEvent event, VkPipelineStageFlags stageMask)
 {
     ResetEventParams *paramStruct = initCommand<ResetEventParams>(CommandID::ResetEvent);
@@ -2067,6 +2257,31 @@ ANGLE_INLINE void SecondaryCommandBuffer::setDepthWriteEnable(VkBool32 depthWrit
     paramStruct->depthWriteEnable = depthWriteEnable;
 }
 
+ANGLE_INLINE void SecondaryCommandBuffer::setDescriptorBufferOffsets(
+    const PipelineLayout &layout,
+    VkPipelineBindPoint pipelineBindPoint,
+    DescriptorSetIndex firstSet,
+    uint32_t setCount,
+    const uint32_t *bufferIndices,
+    const VkDeviceSize *offsets)
+{
+    const ArrayParamSize offsetSize  = calculateArrayParameterSize<VkDeviceSize>(setCount);
+    const ArrayParamSize indicesSize = calculateArrayParameterSize<uint32_t>(setCount);
+    uint8_t *writePtr;
+    SetDescriptorBufferOffsetsParams *paramStruct = initCommand<SetDescriptorBufferOffsetsParams>(
+        CommandID::SetDescriptorBufferOffsets, offsetSize.allocateBytes + indicesSize.allocateBytes,
+        &writePtr);
+    // Copy params into memory
+    paramStruct->layout = layout.getHandle();
+    SetBitField(paramStruct->pipelineBindPoint, pipelineBindPoint);
+    SetBitField(paramStruct->firstSet, ToUnderlying(firstSet));
+    SetBitField(paramStruct->setCount, setCount);
+    paramStruct->padding = 0;
+    // Copy variable sized data.  Offsets go first to keep them 8-byte aligned.
+    writePtr = storeArrayParameter(writePtr, offsets, offsetSize);
+    storeArrayParameter(writePtr, bufferIndices, indicesSize);
+}
+
 ANGLE_INLINE void SecondaryCommandBuffer::setEvent(VkEvent event, VkPipelineStageFlags stageMask)
 {
     SetEventParams *paramStruct = initCommand<SetEventParams>(CommandID::SetEvent);
@@ -58,7 +58,7 @@ void ShaderInterfaceVariableInfoMap::clear()
     }
 }
 
-void ShaderInterfaceVariableInfoMap::save(gl::BinaryOutputStream *stream)
+void ShaderInterfaceVariableInfoMap::save(gl::BinaryOutputStream *stream) const
 {
     ASSERT(mXFBData.size() <= mData.size());
     stream->writeStruct(mPod);
@@ -85,7 +85,7 @@ void ShaderInterfaceVariableInfoMap::save(gl::BinaryOutputStream *stream)
             }
             stream->writeInt(xfbIndex);
             xfbInfoCount++;
-            XFBInterfaceVariableInfo &info = *mXFBData[xfbIndex];
+            const XFBInterfaceVariableInfo &info = *mXFBData[xfbIndex];
             SaveShaderInterfaceVariableXfbInfo(info.xfb, stream);
             stream->writeInt(info.fieldXfb.size());
             for (const ShaderInterfaceVariableXfbInfo &xfb : info.fieldXfb)
@@ -10,6 +10,7 @@
 #include "libANGLE/renderer/vulkan/TextureVk.h"
 #include <vulkan/vulkan.h>
 
+#include "common/WorkerThread.h"
 #include "common/debug.h"
 #include "image_util/generatemip.inc"
 #include "libANGLE/Config.h"
@@ -30,6 +31,8 @@
 #include "libANGLE/renderer/vulkan/vk_renderer.h"
 #include "libANGLE/renderer/vulkan/vk_utils.h"
 
+#include <thread>
+
 namespace rx
 {
 namespace
@@ -486,6 +489,115 @@ bool NeedsRGBAEmulation(vk::Renderer *renderer, angle::FormatID formatID)
     return true;
 }
 
+// Mips of large levels are generated on multiple threads, as every row (or slice of 3D textures)
+// of a mip is generated independently.  Below this size of the source level, the threading
+// overhead outweighs the benefit.
+constexpr size_t kParallelMipGenerationMinSize      = 1024 * 1024;
+constexpr size_t kParallelMipGenerationMaxTaskCount = 16;
+
+class MipGenerationTask final : public angle::Closure
+{
+  public:
+    MipGenerationTask(MipGenerationFunction mipGenerationFunction,
+                      size_t sourceWidth,
+                      size_t sourceHeight,
+                      size_t sourceDepth,
+                      const uint8_t *sourceData,
+                      size_t sourceRowPitch,
+                      size_t sourceDepthPitch,
+                      uint8_t *destData,
+                      size_t destRowPitch,
+                      size_t destDepthPitch)
+        : mMipGenerationFunction(mipGenerationFunction),
+          mSourceWidth(sourceWidth),
+          mSourceHeight(sourceHeight),
+          mSourceDepth(sourceDepth),
+          mSourceData(sourceData),
+          mSourceRowPitch(sourceRowPitch),
+          mSourceDepthPitch(sourceDepthPitch),
+          mDestData(destData),
+          mDestRowPitch(destRowPitch),
+          mDestDepthPitch(destDepthPitch)
+    {}
+
+    void operator()() override
+    {
+        ANGLE_TRACE_EVENT0("gpu.angle", "MipGenerationTask");
+        mMipGenerationFunction(mSourceWidth, mSourceHeight, mSourceDepth, mSourceData,
+                               mSourceRowPitch, mSourceDepthPitch, mDestData, mDestRowPitch,
+                               mDestDepthPitch);
+    }
+
+  private:
+    MipGenerationFunction mMipGenerationFunction;
+    size_t mSourceWidth;
+    size_t mSourceHeight;
+    size_t mSourceDepth;
+    const uint8_t *mSourceData;
+    size_t mSourceRowPitch;
+    size_t mSourceDepthPitch;
+    uint8_t *mDestData;
+    size_t mDestRowPitch;
+    size_t mDestDepthPitch;
+};
+
+// Calls |mipGenerationFunction| on the whole level, splitting the rows (or the slices of 3D
+// levels) of the mip over the multi-threaded pool of |context| if worthwhile.
+void GenerateMipLevel(const angle::ImageLoadContext &context,
+                      MipGenerationFunction mipGenerationFunction,
+                      size_t sourceWidth,
+                      size_t sourceHeight,
+                      size_t sourceDepth,
+                      const uint8_t *sourceData,
+                      size_t sourceRowPitch,
+                      size_t sourceDepthPitch,
+                      uint8_t *destData,
+                      size_t destRowPitch,
+                      size_t destDepthPitch)
+{
+    const bool splitSlices = sourceDepth > 1;
+    const size_t destCount = splitSlices ? sourceDepth / 2 : sourceHeight / 2;
+
+    size_t taskCount = 1;
+    if (destCount > 1 && sourceDepthPitch * sourceDepth >= kParallelMipGenerationMinSize &&
+        context.multiThreadPool && context.multiThreadPool->isAsync())
+    {
+        const size_t threadCount = std::max(1u, std::thread::hardware_concurrency());
+        taskCount = std::min({destCount, threadCount, kParallelMipGenerationMaxTaskCount});
+    }
+
+    if (taskCount == 1)
+    {
+        mipGenerationFunction(sourceWidth, sourceHeight, sourceDepth, sourceData, sourceRowPitch,
+                              sourceDepthPitch, destData, destRowPitch, destDepthPitch);
+        return;
+    }
+
+    // Every part covers an even number of source rows (or slices), so it takes the same path in
+    // the mip generation function as the whole level, and generates the same result.
+    const size_t destPerTask  = (destCount + taskCount - 1) / taskCount;
+    const size_t sourceStride = splitSlices ? sourceDepthPitch : sourceRowPitch;
+    const size_t destStride   = splitSlices ? destDepthPitch : destRowPitch;
+
+    std::vector<std::shared_ptr<angle::WaitableEvent>> waitEvents;
+    for (size_t first = destPerTask; first < destCount; first += destPerTask)
+    {
+        const size_t partSize = 2 * std::min(destPerTask, destCount - first);
+        std::shared_ptr<MipGenerationTask> task = std::make_shared<MipGenerationTask>(
+            mipGenerationFunction, sourceWidth, splitSlices ? sourceHeight : partSize,
+            splitSlices ? partSize : 1, sourceData + 2 * first * sourceStride, sourceRowPitch,
+            sourceDepthPitch, destData + first * destStride, destRowPitch, destDepthPitch);
+        waitEvents.push_back(context.multiThreadPool->postWorkerTask(task));
+    }
+
+    // The first part is generated on this thread while the workers generate the rest.
+    const size_t firstPartSize = 2 * destPerTask;
+    mipGenerationFunction(sourceWidth, splitSlices ? sourceHeight : firstPartSize,
+                          splitSlices ? firstPartSize : 1, sourceData, sourceRowPitch,
+                          sourceDepthPitch, destData, destRowPitch, destDepthPitch);
+
+    angle::WaitableEvent::WaitMany(&waitEvents);
+}
 }  // anonymous namespace
 
 // TextureVk implementation.
@@ -2536,6 +2648,11 @@ angle::Result TextureVk::generateMipmap(const gl::Context *context)
     vk::LevelIndex maxLevel  = mImage->toVkLevel(gl::LevelIndex(mState.getMipmapMaxLevel()));
     ASSERT(maxLevel != vk::LevelIndex(0));
 
+    if (renderer->getFeatures().forceGenerateMipmapOnCPU.enabled)
+    {
+        return generateMipmapsWithCPU(context);
+    }
+
     // If it's possible to generate mipmap in compute, that would give the best possible
     // performance on some hardware.
     if (CanGenerateMipmapWithCompute(renderer, mImage->getType(), mImage->getActualFormatID(),
@@ -4125,9 +4242,10 @@ angle::Result TextureVk::generateMipmapLevelsWithCPU(ContextVk *contextVk,
             mipLevelExtents, gl::Offset(), &destData, sourceFormat.id));
 
         // Generate the mipmap into that new buffer
-        sourceFormat.mipGenerationFunction(
-            previousLevelWidth, previousLevelHeight, previousLevelDepth, previousLevelData,
-            previousLevelRowPitch, previousLevelDepthPitch, destData, destRowPitch, destDepthPitch);
+        GenerateMipLevel(contextVk->getImageLoadContext(), sourceFormat.mipGenerationFunction,
+                         previousLevelWidth, previousLevelHeight, previousLevelDepth,
+                         previousLevelData, previousLevelRowPitch, previousLevelDepthPitch,
+                         destData, destRowPitch, destDepthPitch);
 
         // Swap for the next iteration
         previousLevelWidth      = mipWidth;
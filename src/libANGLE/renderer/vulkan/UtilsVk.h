@@ -569,7 +569,8 @@ class UtilsVk : angle::NonCopyable
     struct GraphicsShaderProgramAndPipelines
     {
         vk::ShaderProgramHelper program;
-        CompleteGraphicsPipelineCache pipelines;
+        // Only used by the context that owns UtilsVk, so it doesn't need to be concurrent.
+        GraphicsPipelineCache<GraphicsPipelineDescCompleteHash> pipelines;
     };
     struct ComputeShaderProgramAndPipelines
     {
@@ -155,6 +155,14 @@ class VulkanSecondaryCommandBuffer : public priv::CommandBuffer
                       VkDeviceSize offset,
                       uint32_t drawCount,
                       uint32_t stride);
+    void drawMulti(uint32_t drawCount,
+                   const VkMultiDrawInfoEXT *vertexInfo,
+                   uint32_t instanceCount,
+                   uint32_t firstInstance);
+    void drawMultiIndexed(uint32_t drawCount,
+                          const VkMultiDrawIndexedInfoEXT *indexInfo,
+                          uint32_t instanceCount,
+                          uint32_t firstInstance);
 
     void endQuery(const QueryPool &queryPool, uint32_t query);
 
@@ -514,6 +522,27 @@ ANGLE_INLINE void VulkanSecondaryCommandBuffer::drawIndirect(const Buffer &buffe
     CommandBuffer::drawIndirect(buffer, offset, drawCount, stride);
 }
 
+ANGLE_INLINE void VulkanSecondaryCommandBuffer::drawMulti(uint32_t drawCount,
+                                                          const VkMultiDrawInfoEXT *vertexInfo,
+                                                          uint32_t instanceCount,
+                                                          uint32_t firstInstance)
+{
+    onRecordCommand();
+    mCommandTracker.onDraw();
+    CommandBuffer::drawMulti(drawCount, vertexInfo, instanceCount, firstInstance);
+}
+
+ANGLE_INLINE void VulkanSecondaryCommandBuffer::drawMultiIndexed(
+    uint32_t drawCount,
+    const VkMultiDrawIndexedInfoEXT *indexInfo,
+    uint32_t instanceCount,
+    uint32_t firstInstance)
+{
+    onRecordCommand();
+    mCommandTracker.onDraw();
+    CommandBuffer::drawMultiIndexed(drawCount, indexInfo, instanceCount, firstInstance);
+}
+
 ANGLE_INLINE void VulkanSecondaryCommandBuffer::dispatch(uint32_t groupCountX,
                                                          uint32_t groupCountY,
                                                          uint32_t groupCountZ)
@@ -13,6 +13,9 @@
 #include <cctype>
 #include <numeric>
 
+#include <anglebase/sha1.h>
+
+#include "common/BinaryStream.h"
 #include "common/FixedVector.h"
 #include "common/spirv/spirv_instruction_builder_autogen.h"
 #include "common/spirv/spirv_instruction_parser_autogen.h"
@@ -5401,4 +5404,37 @@ angle::Result SpvTransformSpirvCode(const SpvTransformOptions &options,
 
     return angle::Result::Continue;
 }
+
+angle::BlobCacheKey SpvGetTransformedSpirvCacheKey(
+    const SpvTransformOptions &options,
+    const ShaderInterfaceVariableInfoMap &variableInfoMap,
+    const spirv::Blob &initialSpirvBlob)
+{
+    // |options.validate| is left out, as it does not affect the output.
+    const uint8_t optionBytes[] = {
+        static_cast<uint8_t>(options.shaderType),
+        options.isLastPreFragmentStage,
+        options.isTransformFeedbackStage,
+        options.isTransformFeedbackEmulated,
+        options.isMultisampledFramebufferFetch,
+        options.enableSampleShading,
+        options.useSpirvVaryingPrecisionFixer,
+    };
+
+    // The variable info map decides the locations, bindings etc that are assigned, so programs
+    // that share a shader but not its interface get different keys.
+    gl::BinaryOutputStream variableInfoStream;
+    variableInfoMap.save(&variableInfoStream);
+
+    angle::base::SecureHashAlgorithm hasher;
+    hasher.Update(optionBytes, sizeof(optionBytes));
+    hasher.Update(variableInfoStream.data(), variableInfoStream.length());
+    hasher.Update(initialSpirvBlob.data(),
+                  initialSpirvBlob.size() * sizeof(*initialSpirvBlob.data()));
+    hasher.Final();
+
+    angle::BlobCacheKey key;
+    memcpy(key.data(), hasher.Digest(), key.size());
+    return key;
+}
 }  // namespace rx
@@ -171,6 +171,13 @@ angle::Result SpvTransformSpirvCode(const SpvTransformOptions &options,
                                     const angle::spirv::Blob &initialSpirvBlob,
                                     angle::spirv::Blob *spirvBlobOut);
 
+// Hashes everything the output of |SpvTransformSpirvCode| depends on, for use as the key of the
+// transformed SPIR-V cache.
+angle::BlobCacheKey SpvGetTransformedSpirvCacheKey(
+    const SpvTransformOptions &options,
+    const ShaderInterfaceVariableInfoMap &variableInfoMap,
+    const angle::spirv::Blob &initialSpirvBlob);
+
 }  // namespace rx
 
 #endif  // LIBANGLE_RENDERER_VULKAN_SPV_UTILS_H_
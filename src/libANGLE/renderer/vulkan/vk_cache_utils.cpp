@@ -33,6 +33,9 @@ constexpr bool kDumpPipelineCacheGraph = true;
 constexpr bool kDumpPipelineCacheGraph = false;
 #endif  // ANGLE_DUMP_PIPELINE_CACHE_GRAPH
 
+// The least recently used transformed SPIR-V modules are evicted past this total size.
+constexpr size_t kTransformedSpirvCacheMaxSize = 16 * 1024 * 1024;
+
 namespace vk
 {
 
@@ -2537,13 +2540,9 @@ PipelineState GetPipelineState(size_t stateIndex, bool *isRangedOut, size_t *sub
     }
 }
 
-template <typename Hash>
-void DumpPipelineCacheGraph(
-    Context *context,
-    const std::unordered_map<GraphicsPipelineDesc,
-                             PipelineHelper,
-                             Hash,
-                             typename GraphicsPipelineCacheTypeHelper<Hash>::KeyEqual> &cache)
+// |cache| is a range of (GraphicsPipelineDesc, PipelineHelper) pairs.
+template <typename Hash, typename DescAndPipelineRange>
+void DumpPipelineCacheGraph(Context *context, const DescAndPipelineRange &cache)
 {
     constexpr GraphicsPipelineSubset kSubset = GraphicsPipelineCacheTypeHelper<Hash>::kSubset;
 
@@ -3293,6 +3292,85 @@ bool GraphicsPipelineDesc::keyEqual(const GraphicsPipelineDesc &other,
     return memcmp(key, otherKey, std::min(keySize, otherKeySize)) == 0;
 }
 
+bool GraphicsPipelineDesc::hasValidPackedState(Renderer *renderer) const
+{
+    const gl::Caps &caps = renderer->getNativeCaps();
+
+    const PackedInputAssemblyState &inputAssembly = mVertexInput.inputAssembly;
+    if (inputAssembly.bits.topology > VK_PRIMITIVE_TOPOLOGY_PATCH_LIST)
+    {
+        return false;
+    }
+    for (size_t attribIndex :
+         gl::AttributesMask(inputAssembly.bits.programActiveAttributeLocations))
+    {
+        if (mVertexInput.vertex.attribs[attribIndex].format >= angle::kNumANGLEFormats)
+        {
+            return false;
+        }
+    }
+
+    const PackedPreRasterizationAndFragmentStates &shaders = mShaders.shaders;
+    if (shaders.bits.polygonMode > VK_POLYGON_MODE_POINT ||
+        shaders.bits.cullMode > VK_CULL_MODE_FRONT_AND_BACK ||
+        shaders.bits.frontFace > VK_FRONT_FACE_CLOCKWISE ||
+        shaders.bits.depthCompareOp > VK_COMPARE_OP_ALWAYS ||
+        static_cast<GLint>(shaders.bits.patchVertices) > caps.maxPatchVertices)
+    {
+        return false;
+    }
+    for (const PackedStencilOpState &stencilOp : {shaders.front, shaders.back})
+    {
+        if (stencilOp.fail > VK_STENCIL_OP_DECREMENT_AND_WRAP ||
+            stencilOp.pass > VK_STENCIL_OP_DECREMENT_AND_WRAP ||
+            stencilOp.depthFail > VK_STENCIL_OP_DECREMENT_AND_WRAP ||
+            stencilOp.compare > VK_COMPARE_OP_ALWAYS)
+        {
+            return false;
+        }
+    }
+
+    if (!gl::isPow2(mSharedNonVertexInput.multisample.bits.rasterizationSamplesMinusOne + 1))
+    {
+        return false;
+    }
+
+    const RenderPassDesc &renderPass = mSharedNonVertexInput.renderPass;
+    if (renderPass.colorAttachmentRange() > gl::IMPLEMENTATION_MAX_DRAW_BUFFERS ||
+        renderPass.samples() > 16 || (renderPass.samples() & (renderPass.samples() - 1)) != 0 ||
+        renderPass.viewCount() > caps.maxViews)
+    {
+        return false;
+    }
+    // The depth/stencil format is right after the color formats.
+    for (size_t attachmentIndex = 0; attachmentIndex <= renderPass.colorAttachmentRange();
+         ++attachmentIndex)
+    {
+        if (static_cast<uint32_t>(renderPass[attachmentIndex]) >= angle::kNumANGLEFormats)
+        {
+            return false;
+        }
+    }
+
+    // Advanced blend equations are packed after VK_BLEND_OP_MAX, see PackGLBlendOp.
+    constexpr uint8_t kMaxPackedBlendOp =
+        static_cast<uint8_t>(VK_BLEND_OP_HSL_LUMINOSITY_EXT - VK_BLEND_OP_ZERO_EXT);
+    for (const PackedColorBlendAttachmentState &attachment : mFragmentOutput.blend.attachments)
+    {
+        if (attachment.srcColorBlendFactor > VK_BLEND_FACTOR_ONE_MINUS_SRC1_ALPHA ||
+            attachment.dstColorBlendFactor > VK_BLEND_FACTOR_ONE_MINUS_SRC1_ALPHA ||
+            attachment.srcAlphaBlendFactor > VK_BLEND_FACTOR_ONE_MINUS_SRC1_ALPHA ||
+            attachment.dstAlphaBlendFactor > VK_BLEND_FACTOR_ONE_MINUS_SRC1_ALPHA ||
+            attachment.colorBlendOp > kMaxPackedBlendOp ||
+            attachment.alphaBlendOp > kMaxPackedBlendOp)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 // Initialize PSO states, it is consistent with initial value of gl::State.
 //
 // Some states affect the pipeline, but they are not derived from the GL state, but rather the
@@ -3347,6 +3425,7 @@ void GraphicsPipelineDesc::initDefaults(const Context *context,
         SetBitField(mShaders.shaders.bits.depthCompareOp, VK_COMPARE_OP_LESS);
         mShaders.shaders.bits.surfaceRotation  = 0;
         mShaders.shaders.emulatedDitherControl = 0;
+        mShaders.shaders.usesDescriptorBuffer  = 0;
         mShaders.shaders.padding               = 0;
         SetBitField(mShaders.shaders.front.fail, VK_STENCIL_OP_KEEP);
         SetBitField(mShaders.shaders.front.pass, VK_STENCIL_OP_KEEP);
@@ -3539,6 +3618,15 @@ VkResult GraphicsPipelineDesc::initializePipeline(Context *context,
         createInfo.flags |= VK_PIPELINE_CREATE_NO_PROTECTED_ACCESS_BIT_EXT;
     }
 
+    // Descriptor buffers are never used with pipeline libraries, so only complete pipelines can
+    // have this flag.
+    if (hasShaders && mShaders.shaders.usesDescriptorBuffer)
+    {
+        ASSERT(subset == GraphicsPipelineSubset::Complete);
+        ASSERT(context->getRenderer()->useDescriptorBuffer());
+        createInfo.flags |= VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
+    }
+
     VkPipelineCreationFeedback feedback = {};
     gl::ShaderMap<VkPipelineCreationFeedback> perStageFeedback;
 
@@ -4734,6 +4822,19 @@ void GraphicsPipelineDesc::updateEmulatedDitherControl(GraphicsPipelineTransitio
     transition->set(ANGLE_GET_TRANSITION_BIT(mShaders.shaders.emulatedDitherControl));
 }
 
+void GraphicsPipelineDesc::setUsesDescriptorBuffer(bool usesDescriptorBuffer)
+{
+    mShaders.shaders.usesDescriptorBuffer = usesDescriptorBuffer;
+}
+
+void GraphicsPipelineDesc::updateUsesDescriptorBuffer(GraphicsPipelineTransitionBits *transition,
+                                                      bool usesDescriptorBuffer)
+{
+    setUsesDescriptorBuffer(usesDescriptorBuffer);
+    // The flag shares its transition bit with emulatedDitherControl.
+    transition->set(ANGLE_GET_TRANSITION_BIT(mShaders.shaders.emulatedDitherControl));
+}
+
 void GraphicsPipelineDesc::updateNonZeroStencilWriteMaskWorkaround(
     GraphicsPipelineTransitionBits *transition,
     bool enabled)
@@ -4870,7 +4971,7 @@ bool operator==(const AttachmentOpsArray &lhs, const AttachmentOpsArray &rhs)
 
 // DescriptorSetLayoutDesc implementation.
 DescriptorSetLayoutDesc::DescriptorSetLayoutDesc()
-    : mImmutableSamplers{}, mDescriptorSetLayoutBindings{}
+    : mImmutableSamplers{}, mDescriptorSetLayoutBindings{}, mFlags(0)
 {}
 
 DescriptorSetLayoutDesc::~DescriptorSetLayoutDesc() = default;
@@ -4901,13 +5002,13 @@ size_t DescriptorSetLayoutDesc::hash() const
                                                  validImmutableSamplersCount * sizeof(VkSampler));
     }
 
-    return genericHash;
+    return genericHash ^ mFlags;
 }
 
 bool DescriptorSetLayoutDesc::operator==(const DescriptorSetLayoutDesc &other) const
 {
     return mDescriptorSetLayoutBindings == other.mDescriptorSetLayoutBindings &&
-           mImmutableSamplers == other.mImmutableSamplers;
+           mImmutableSamplers == other.mImmutableSamplers && mFlags == other.mFlags;
 }
 
 void DescriptorSetLayoutDesc::addBinding(uint32_t bindingIndex,
@@ -6033,6 +6134,51 @@ void WriteDescriptorDescs::updateDynamicDescriptorsCount()
     }
 }
 
+angle::Result WriteDescriptorDescs::initDescriptorUpdateTemplate(
+    Context *context,
+    const DescriptorSetLayout &descriptorSetLayout,
+    DescriptorUpdateTemplate *templateOut) const
+{
+    angle::FastVector<VkDescriptorUpdateTemplateEntry, kDefaultDescriptorSetLayoutBindingsCount>
+        entries;
+
+    for (uint32_t writeIndex = 0; writeIndex < mDescs.size(); ++writeIndex)
+    {
+        const WriteDescriptorDesc &writeDesc = mDescs[writeIndex];
+        if (writeDesc.descriptorCount == 0)
+        {
+            continue;
+        }
+
+        // The descriptors of each binding are consecutive in the template data, starting at the
+        // binding's first DescriptorInfoDesc.
+        VkDescriptorUpdateTemplateEntry entry = {};
+        entry.dstBinding                      = writeIndex;
+        entry.dstArrayElement                 = 0;
+        entry.descriptorCount                 = writeDesc.descriptorCount;
+        entry.descriptorType = static_cast<VkDescriptorType>(writeDesc.descriptorType);
+        entry.offset         = writeDesc.descriptorInfoIndex * sizeof(DescriptorUpdateInfo);
+        entry.stride         = sizeof(DescriptorUpdateInfo);
+        entries.push_back(entry);
+    }
+
+    if (entries.empty())
+    {
+        return angle::Result::Continue;
+    }
+
+    VkDescriptorUpdateTemplateCreateInfo createInfo = {};
+    createInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO;
+    createInfo.descriptorUpdateEntryCount = static_cast<uint32_t>(entries.size());
+    createInfo.pDescriptorUpdateEntries   = entries.data();
+    createInfo.templateType               = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET;
+    createInfo.descriptorSetLayout        = descriptorSetLayout.getHandle();
+
+    ANGLE_VK_TRY(context, templateOut->init(context->getDevice(), createInfo));
+
+    return angle::Result::Continue;
+}
+
 void WriteDescriptorDescs::streamOut(std::ostream &ostr) const
 {
     ostr << mDescs.size() << " write descriptor descs:\n";
@@ -6047,6 +6193,83 @@ void WriteDescriptorDescs::streamOut(std::ostream &ostr) const
     }
 }
 
+// DescriptorBufferSet implementation.
+DescriptorBufferSet::DescriptorBufferSet() = default;
+
+DescriptorBufferSet::~DescriptorBufferSet() = default;
+
+void DescriptorBufferSet::init(Renderer *renderer,
+                               const DescriptorSetLayoutDesc &layoutDesc,
+                               const DescriptorSetLayout &layout)
+{
+    ASSERT(layoutDesc.getFlags() & VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT);
+
+    VkDevice device = renderer->getDevice();
+
+    VkDeviceSize layoutSize = 0;
+    vkGetDescriptorSetLayoutSizeEXT(device, layout.getHandle(), &layoutSize);
+    mData.assign(static_cast<size_t>(layoutSize), 0);
+
+    DescriptorSetLayoutBindingVector bindings;
+    layoutDesc.unpackBindings(&bindings);
+
+    mBindingOffsets.clear();
+    for (const VkDescriptorSetLayoutBinding &binding : bindings)
+    {
+        if (binding.binding >= mBindingOffsets.size())
+        {
+            mBindingOffsets.resize(binding.binding + 1, 0);
+        }
+        vkGetDescriptorSetLayoutBindingOffsetEXT(device, layout.getHandle(), binding.binding,
+                                                 &mBindingOffsets[binding.binding]);
+    }
+}
+
+void DescriptorBufferSet::reset()
+{
+    mBindingOffsets.clear();
+    mData.clear();
+}
+
+// PushDescriptorSet implementation.
+PushDescriptorSet::PushDescriptorSet() = default;
+
+PushDescriptorSet::~PushDescriptorSet() = default;
+
+void PushDescriptorSet::reset()
+{
+    mBufferInfos.clear();
+    mWrites.clear();
+}
+
+VkDescriptorBufferInfo *PushDescriptorSet::addBufferWrite(uint32_t binding,
+                                                          VkDescriptorType descriptorType,
+                                                          uint32_t descriptorCount)
+{
+    VkWriteDescriptorSet write = {};
+    write.sType                = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    write.dstBinding           = binding;
+    write.descriptorCount      = descriptorCount;
+    write.descriptorType       = descriptorType;
+    mWrites.push_back(write);
+
+    // pBufferInfo is assigned in finalize(), as mBufferInfos may be reallocated until then.
+    const size_t firstInfo = mBufferInfos.size();
+    mBufferInfos.resize(firstInfo + descriptorCount);
+    return &mBufferInfos[firstInfo];
+}
+
+void PushDescriptorSet::finalize()
+{
+    size_t infoIndex = 0;
+    for (VkWriteDescriptorSet &write : mWrites)
+    {
+        write.pBufferInfo = &mBufferInfos[infoIndex];
+        infoIndex += write.descriptorCount;
+    }
+    ASSERT(infoIndex == mBufferInfos.size());
+}
+
 // DescriptorSetDesc implementation.
 void DescriptorSetDesc::updateDescriptorSet(Renderer *renderer,
                                             const WriteDescriptorDescs &writeDescriptorDescs,
@@ -6141,6 +6364,299 @@ void DescriptorSetDesc::updateDescriptorSet(Renderer *renderer,
     }
 }
 
+void DescriptorSetDesc::updateDescriptorSetWithTemplate(
+    Renderer *renderer,
+    const WriteDescriptorDescs &writeDescriptorDescs,
+    const DescriptorUpdateTemplate &updateTemplate,
+    UpdateDescriptorSetsBuilder *updateBuilder,
+    const DescriptorDescHandles *handles,
+    VkDescriptorSet descriptorSet) const
+{
+    DescriptorUpdateInfo *updateInfos =
+        updateBuilder->getDescriptorUpdateInfos(writeDescriptorDescs.getTotalDescriptorCount());
+
+    for (uint32_t writeIndex = 0; writeIndex < writeDescriptorDescs.size(); ++writeIndex)
+    {
+        const WriteDescriptorDesc &writeDesc = writeDescriptorDescs[writeIndex];
+
+        if (writeDesc.descriptorCount == 0)
+        {
+            continue;
+        }
+
+        const uint32_t infoDescIndex = writeDesc.descriptorInfoIndex;
+
+        switch (static_cast<VkDescriptorType>(writeDesc.descriptorType))
+        {
+            case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+            case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+            {
+                ASSERT(writeDesc.descriptorCount == 1);
+                updateInfos[infoDescIndex].bufferView = handles[infoDescIndex].bufferView;
+                break;
+            }
+            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+            {
+                for (uint32_t arrayElement = 0; arrayElement < writeDesc.descriptorCount;
+                     ++arrayElement)
+                {
+                    const uint32_t infoIndex           = infoDescIndex + arrayElement;
+                    const DescriptorInfoDesc &infoDesc = mDescriptorInfos[infoIndex];
+                    VkDescriptorBufferInfo &bufferInfo = updateInfos[infoIndex].buffer;
+                    bufferInfo.buffer                  = handles[infoIndex].buffer;
+                    bufferInfo.offset                  = infoDesc.imageViewSerialOrOffset;
+                    bufferInfo.range                   = infoDesc.imageLayoutOrRange;
+                }
+                break;
+            }
+            case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+            case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+            case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+            case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+            {
+                for (uint32_t arrayElement = 0; arrayElement < writeDesc.descriptorCount;
+                     ++arrayElement)
+                {
+                    const uint32_t infoIndex           = infoDescIndex + arrayElement;
+                    const DescriptorInfoDesc &infoDesc = mDescriptorInfos[infoIndex];
+                    VkDescriptorImageInfo &imageInfo   = updateInfos[infoIndex].image;
+
+                    ImageLayout imageLayout = static_cast<ImageLayout>(infoDesc.imageLayoutOrRange);
+
+                    imageInfo.imageLayout =
+                        ConvertImageLayoutToVkImageLayout(renderer, imageLayout);
+                    imageInfo.imageView = handles[infoIndex].imageView;
+                    imageInfo.sampler   = handles[infoIndex].sampler;
+                }
+                break;
+            }
+
+            default:
+                UNREACHABLE();
+                break;
+        }
+    }
+
+    updateTemplate.updateDescriptorSet(renderer->getDevice(), descriptorSet, updateInfos);
+}
+
+void DescriptorSetDesc::writeDescriptorBuffer(Renderer *renderer,
+                                              const WriteDescriptorDescs &writeDescriptorDescs,
+                                              const DescriptorDescHandles *handles,
+                                              const uint32_t *dynamicOffsets,
+                                              DescriptorBufferSet *descriptorBufferSet) const
+{
+    const VkPhysicalDeviceDescriptorBufferPropertiesEXT &properties =
+        renderer->getPhysicalDeviceDescriptorBufferProperties();
+    const bool robustBufferAccess =
+        renderer->getEnabledFeatures().features.robustBufferAccess == VK_TRUE;
+    VkDevice device = renderer->getDevice();
+
+    uint32_t dynamicOffsetIndex = 0;
+
+    for (uint32_t writeIndex = 0; writeIndex < writeDescriptorDescs.size(); ++writeIndex)
+    {
+        const WriteDescriptorDesc &writeDesc = writeDescriptorDescs[writeIndex];
+
+        if (writeDesc.descriptorCount == 0)
+        {
+            continue;
+        }
+
+        const VkDescriptorType descriptorType =
+            static_cast<VkDescriptorType>(writeDesc.descriptorType);
+        uint32_t infoDescIndex = writeDesc.descriptorInfoIndex;
+        uint8_t *bindingData   = descriptorBufferSet->getBindingData(writeIndex);
+
+        VkDescriptorGetInfoEXT getInfo = {};
+        getInfo.sType                  = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT;
+
+        switch (descriptorType)
+        {
+            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+            {
+                // Descriptor buffers have no dynamic descriptors; the dynamic offset is instead
+                // baked in the descriptor itself.
+                const bool isUniformBuffer =
+                    descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER ||
+                    descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+                const bool isDynamic = IsDynamicDescriptor(descriptorType);
+                size_t descriptorSize;
+                if (isUniformBuffer)
+                {
+                    getInfo.type   = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+                    descriptorSize = robustBufferAccess
+                                         ? properties.robustUniformBufferDescriptorSize
+                                         : properties.uniformBufferDescriptorSize;
+                }
+                else
+                {
+                    getInfo.type   = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+                    descriptorSize = robustBufferAccess
+                                         ? properties.robustStorageBufferDescriptorSize
+                                         : properties.storageBufferDescriptorSize;
+                }
+
+                for (uint32_t arrayElement = 0; arrayElement < writeDesc.descriptorCount;
+                     ++arrayElement)
+                {
+                    const DescriptorInfoDesc &infoDesc =
+                        mDescriptorInfos[infoDescIndex + arrayElement];
+                    VkDeviceSize offset = infoDesc.imageViewSerialOrOffset;
+                    if (isDynamic)
+                    {
+                        ASSERT(dynamicOffsets != nullptr);
+                        offset += dynamicOffsets[dynamicOffsetIndex++];
+                    }
+
+                    VkDescriptorAddressInfoEXT addressInfo = {};
+                    addressInfo.sType   = VK_STRUCTURE_TYPE_DESCRIPTOR_ADDRESS_INFO_EXT;
+                    addressInfo.address = GetBufferDeviceAddress(
+                                              device, handles[infoDescIndex + arrayElement].buffer) +
+                                          offset;
+                    addressInfo.range  = infoDesc.imageLayoutOrRange;
+                    addressInfo.format = VK_FORMAT_UNDEFINED;
+
+                    if (isUniformBuffer)
+                    {
+                        getInfo.data.pUniformBuffer = &addressInfo;
+                    }
+                    else
+                    {
+                        getInfo.data.pStorageBuffer = &addressInfo;
+                    }
+                    vkGetDescriptorEXT(device, &getInfo, descriptorSize,
+                                       bindingData + arrayElement * descriptorSize);
+                }
+                break;
+            }
+            case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+            case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+            case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+            case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+            {
+                getInfo.type = descriptorType;
+                size_t descriptorSize;
+                switch (descriptorType)
+                {
+                    case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+                        descriptorSize = properties.combinedImageSamplerDescriptorSize;
+                        break;
+                    case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+                        descriptorSize = properties.inputAttachmentDescriptorSize;
+                        break;
+                    case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+                        descriptorSize = properties.sampledImageDescriptorSize;
+                        break;
+                    default:
+                        descriptorSize = properties.storageImageDescriptorSize;
+                        break;
+                }
+
+                for (uint32_t arrayElement = 0; arrayElement < writeDesc.descriptorCount;
+                     ++arrayElement)
+                {
+                    const DescriptorInfoDesc &infoDesc =
+                        mDescriptorInfos[infoDescIndex + arrayElement];
+                    ImageLayout imageLayout = static_cast<ImageLayout>(infoDesc.imageLayoutOrRange);
+
+                    VkDescriptorImageInfo imageInfo = {};
+                    imageInfo.imageLayout = ConvertImageLayoutToVkImageLayout(renderer, imageLayout);
+                    imageInfo.imageView   = handles[infoDescIndex + arrayElement].imageView;
+                    imageInfo.sampler     = handles[infoDescIndex + arrayElement].sampler;
+
+                    switch (descriptorType)
+                    {
+                        case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+                            getInfo.data.pCombinedImageSampler = &imageInfo;
+                            break;
+                        case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+                            getInfo.data.pInputAttachmentImage = &imageInfo;
+                            break;
+                        case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+                            getInfo.data.pSampledImage = &imageInfo;
+                            break;
+                        default:
+                            getInfo.data.pStorageImage = &imageInfo;
+                            break;
+                    }
+                    vkGetDescriptorEXT(device, &getInfo, descriptorSize,
+                                       bindingData + arrayElement * descriptorSize);
+                }
+                break;
+            }
+
+            default:
+                // Texel buffers are not supported with descriptor buffers; such programs use
+                // descriptor sets instead.
+                UNREACHABLE();
+                break;
+        }
+    }
+}
+
+void DescriptorSetDesc::writePushDescriptors(const WriteDescriptorDescs &writeDescriptorDescs,
+                                             const DescriptorDescHandles *handles,
+                                             const uint32_t *dynamicOffsets,
+                                             PushDescriptorSet *pushDescriptorSet) const
+{
+    pushDescriptorSet->reset();
+
+    uint32_t dynamicOffsetIndex = 0;
+
+    for (uint32_t writeIndex = 0; writeIndex < writeDescriptorDescs.size(); ++writeIndex)
+    {
+        const WriteDescriptorDesc &writeDesc = writeDescriptorDescs[writeIndex];
+
+        if (writeDesc.descriptorCount == 0)
+        {
+            continue;
+        }
+
+        // Push descriptors cannot be dynamic; the dynamic offset is folded in the buffer offset.
+        VkDescriptorType descriptorType = static_cast<VkDescriptorType>(writeDesc.descriptorType);
+        const bool isDynamic            = IsDynamicDescriptor(descriptorType);
+        if (descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC)
+        {
+            descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        }
+        else if (descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC)
+        {
+            descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        }
+        ASSERT(descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER ||
+               descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+
+        VkDescriptorBufferInfo *bufferInfos = pushDescriptorSet->addBufferWrite(
+            writeDesc.binding, descriptorType, writeDesc.descriptorCount);
+
+        uint32_t infoDescIndex = writeDesc.descriptorInfoIndex;
+        for (uint32_t arrayElement = 0; arrayElement < writeDesc.descriptorCount; ++arrayElement)
+        {
+            const DescriptorInfoDesc &infoDesc = mDescriptorInfos[infoDescIndex + arrayElement];
+            VkDeviceSize offset                = infoDesc.imageViewSerialOrOffset;
+            if (isDynamic)
+            {
+                ASSERT(dynamicOffsets != nullptr);
+                offset += dynamicOffsets[dynamicOffsetIndex++];
+            }
+
+            VkDescriptorBufferInfo &bufferInfo = bufferInfos[arrayElement];
+            bufferInfo.buffer = handles[infoDescIndex + arrayElement].buffer;
+            bufferInfo.offset = offset;
+            bufferInfo.range  = infoDesc.imageLayoutOrRange;
+        }
+    }
+
+    pushDescriptorSet->finalize();
+}
+
 void DescriptorSetDesc::streamOut(std::ostream &ostr) const
 {
     ostr << mDescriptorInfos.size() << " descriptor descs:\n";
@@ -6389,7 +6905,10 @@ angle::Result DescriptorSetDescBuilder::updateFullActiveTextures(
                 infoDesc.samplerOrBufferSerial   = 0;
                 infoDesc.imageSubresourceRange   = 0;
 
-                textureVk->onNewDescriptorSet(sharedCacheKey);
+                if (sharedCacheKey)
+                {
+                    textureVk->onNewDescriptorSet(sharedCacheKey);
+                }
 
                 const BufferView *view = nullptr;
                 ANGLE_TRY(textureVk->getBufferViewAndRecordUse(context, nullptr, &samplerBinding,
@@ -6410,7 +6929,10 @@ angle::Result DescriptorSetDescBuilder::updateFullActiveTextures(
                 ImageOrBufferViewSubresourceSerial imageViewSerial =
                     textureVk->getImageViewSubresourceSerial(samplerState);
 
-                textureVk->onNewDescriptorSet(sharedCacheKey);
+                if (sharedCacheKey)
+                {
+                    textureVk->onNewDescriptorSet(sharedCacheKey);
+                }
 
                 ImageLayout imageLayout = textureVk->getImage().getCurrentImageLayout();
                 SetBitField(infoDesc.imageLayoutOrRange, imageLayout);
@@ -6894,6 +7416,36 @@ void DescriptorSetDescBuilder::updateDescriptorSet(Renderer *renderer,
                               descriptorSet);
 }
 
+void DescriptorSetDescBuilder::updateDescriptorSetWithTemplate(
+    Renderer *renderer,
+    const WriteDescriptorDescs &writeDescriptorDescs,
+    const DescriptorUpdateTemplate &updateTemplate,
+    UpdateDescriptorSetsBuilder *updateBuilder,
+    VkDescriptorSet descriptorSet) const
+{
+    mDesc.updateDescriptorSetWithTemplate(renderer, writeDescriptorDescs, updateTemplate,
+                                          updateBuilder, mHandles.data(), descriptorSet);
+}
+
+void DescriptorSetDescBuilder::writeDescriptorBuffer(
+    Renderer *renderer,
+    const WriteDescriptorDescs &writeDescriptorDescs,
+    const uint32_t *dynamicOffsets,
+    DescriptorBufferSet *descriptorBufferSet) const
+{
+    mDesc.writeDescriptorBuffer(renderer, writeDescriptorDescs, mHandles.data(), dynamicOffsets,
+                                descriptorBufferSet);
+}
+
+void DescriptorSetDescBuilder::writePushDescriptors(
+    const WriteDescriptorDescs &writeDescriptorDescs,
+    const uint32_t *dynamicOffsets,
+    PushDescriptorSet *pushDescriptorSet) const
+{
+    mDesc.writePushDescriptors(writeDescriptorDescs, mHandles.data(), dynamicOffsets,
+                               pushDescriptorSet);
+}
+
 // SharedCacheKeyManager implementation.
 template <class SharedCacheKeyT>
 void SharedCacheKeyManager<SharedCacheKeyT>::addKey(const SharedCacheKeyT &key)
@@ -7120,6 +7672,15 @@ VkBufferView *UpdateDescriptorSetsBuilder::allocBufferViews(size_t count)
         &mBufferViews, count);
 }
 
+vk::DescriptorUpdateInfo *UpdateDescriptorSetsBuilder::getDescriptorUpdateInfos(size_t count)
+{
+    if (mDescriptorUpdateInfos.size() < count)
+    {
+        mDescriptorUpdateInfos.resize(count);
+    }
+    return mDescriptorUpdateInfos.data();
+}
+
 uint32_t UpdateDescriptorSetsBuilder::flushDescriptorSetUpdates(VkDevice device)
 {
     if (mWriteDescriptorSets.empty())
@@ -7810,6 +8371,29 @@ angle::Result RenderPassCache::MakeRenderPass(vk::Context *context,
     return angle::Result::Continue;
 }
 
+namespace
+{
+vk::CacheLookUpFeedback GetPipelineCacheFeedbackForSource(PipelineSource source,
+                                                          vk::CacheLookUpFeedback feedback)
+{
+    switch (source)
+    {
+        case PipelineSource::WarmUp:
+            return feedback == vk::CacheLookUpFeedback::Hit ? vk::CacheLookUpFeedback::WarmUpHit
+                                                            : vk::CacheLookUpFeedback::WarmUpMiss;
+        case PipelineSource::DrawLinked:
+            return feedback == vk::CacheLookUpFeedback::Hit
+                       ? vk::CacheLookUpFeedback::LinkedDrawHit
+                       : vk::CacheLookUpFeedback::LinkedDrawMiss;
+        case PipelineSource::Utils:
+            return feedback == vk::CacheLookUpFeedback::Hit ? vk::CacheLookUpFeedback::UtilsHit
+                                                            : vk::CacheLookUpFeedback::UtilsMiss;
+        default:
+            return feedback;
+    }
+}
+}  // anonymous namespace
+
 // GraphicsPipelineCache implementation.
 template <typename Hash>
 void GraphicsPipelineCache<Hash>::destroy(vk::Context *context)
@@ -7929,27 +8513,7 @@ void GraphicsPipelineCache<Hash>::addToCache(PipelineSource source,
 
     mCacheStats.missAndIncrementSize();
 
-    switch (source)
-    {
-        case PipelineSource::WarmUp:
-            feedback = feedback == vk::CacheLookUpFeedback::Hit
-                           ? vk::CacheLookUpFeedback::WarmUpHit
-                           : vk::CacheLookUpFeedback::WarmUpMiss;
-            break;
-        case PipelineSource::DrawLinked:
-            feedback = feedback == vk::CacheLookUpFeedback::Hit
-                           ? vk::CacheLookUpFeedback::LinkedDrawHit
-                           : vk::CacheLookUpFeedback::LinkedDrawMiss;
-            break;
-        case PipelineSource::Utils:
-            feedback = feedback == vk::CacheLookUpFeedback::Hit
-                           ? vk::CacheLookUpFeedback::UtilsHit
-                           : vk::CacheLookUpFeedback::UtilsMiss;
-            break;
-        default:
-            break;
-    }
-
+    feedback          = GetPipelineCacheFeedbackForSource(source, feedback);
     auto insertedItem = mPayload.emplace(std::piecewise_construct, std::forward_as_tuple(desc),
                                          std::forward_as_tuple(std::move(pipeline), feedback));
     *descPtrOut       = &insertedItem.first->first;
@@ -8071,6 +8635,322 @@ template void GraphicsPipelineCache<GraphicsPipelineDescFragmentOutputHash>::pop
     vk::Pipeline &&pipeline,
     vk::PipelineHelper **pipelineHelperOut);
 
+// ConcurrentGraphicsPipelineCache implementation.
+template <typename Hash>
+ConcurrentGraphicsPipelineCache<Hash>::ConcurrentGraphicsPipelineCache() = default;
+
+template <typename Hash>
+ConcurrentGraphicsPipelineCache<Hash>::~ConcurrentGraphicsPipelineCache()
+{
+    ASSERT(mShards.load(std::memory_order_relaxed) == nullptr);
+}
+
+template <typename Hash>
+void ConcurrentGraphicsPipelineCache<Hash>::destroy(vk::Context *context)
+{
+    accumulateCacheStats(context->getRenderer());
+
+    Shard *shards = mShards.load(std::memory_order_relaxed);
+    if (shards == nullptr)
+    {
+        return;
+    }
+
+    if (vk::ShouldDumpPipelineCacheGraph(context))
+    {
+        dumpPipelineCacheGraph(context);
+    }
+
+    VkDevice device = context->getDevice();
+
+    for (size_t shardIndex = 0; shardIndex < kShardCount; ++shardIndex)
+    {
+        for (std::unique_ptr<Entry> &entry : shards[shardIndex].entries)
+        {
+            entry->pipeline.destroy(device);
+        }
+    }
+
+    clearShards();
+}
+
+template <typename Hash>
+void ConcurrentGraphicsPipelineCache<Hash>::release(vk::Context *context)
+{
+    Shard *shards = mShards.load(std::memory_order_relaxed);
+    if (shards == nullptr)
+    {
+        return;
+    }
+
+    if (vk::ShouldDumpPipelineCacheGraph(context))
+    {
+        dumpPipelineCacheGraph(context);
+    }
+
+    for (size_t shardIndex = 0; shardIndex < kShardCount; ++shardIndex)
+    {
+        for (std::unique_ptr<Entry> &entry : shards[shardIndex].entries)
+        {
+            entry->pipeline.release(context);
+        }
+    }
+
+    clearShards();
+}
+
+template <typename Hash>
+void ConcurrentGraphicsPipelineCache<Hash>::reset()
+{
+    clearShards();
+}
+
+template <typename Hash>
+void ConcurrentGraphicsPipelineCache<Hash>::dumpPipelineCacheGraph(vk::Context *context) const
+{
+    const Shard *shards = mShards.load(std::memory_order_relaxed);
+    ASSERT(shards != nullptr);
+
+    std::vector<std::pair<const vk::GraphicsPipelineDesc &, const vk::PipelineHelper &>> entries;
+    for (size_t shardIndex = 0; shardIndex < kShardCount; ++shardIndex)
+    {
+        for (const std::unique_ptr<Entry> &entry : shards[shardIndex].entries)
+        {
+            entries.emplace_back(entry->desc, entry->pipeline);
+        }
+    }
+
+    if (!entries.empty())
+    {
+        vk::DumpPipelineCacheGraph<Hash>(context, entries);
+    }
+}
+
+template <typename Hash>
+void ConcurrentGraphicsPipelineCache<Hash>::clearShards()
+{
+    delete[] mShards.exchange(nullptr, std::memory_order_relaxed);
+}
+
+template <typename Hash>
+typename ConcurrentGraphicsPipelineCache<Hash>::Shard &
+ConcurrentGraphicsPipelineCache<Hash>::getOrAllocateShard(size_t hash)
+{
+    Shard *shards = mShards.load(std::memory_order_acquire);
+    if (shards == nullptr)
+    {
+        // If another thread allocated the shards in the meantime, use those instead.
+        std::unique_ptr<Shard[]> newShards(new Shard[kShardCount]);
+        if (mShards.compare_exchange_strong(shards, newShards.get(), std::memory_order_acq_rel,
+                                            std::memory_order_acquire))
+        {
+            shards = newShards.release();
+        }
+    }
+
+    return shards[GetShardIndex(hash)];
+}
+
+template <typename Hash>
+angle::Result ConcurrentGraphicsPipelineCache<Hash>::createPipeline(
+    vk::Context *context,
+    vk::PipelineCacheAccess *pipelineCache,
+    const vk::RenderPass &compatibleRenderPass,
+    const vk::PipelineLayout &pipelineLayout,
+    const vk::ShaderModuleMap &shaders,
+    const vk::SpecializationConstants &specConsts,
+    PipelineSource source,
+    const vk::GraphicsPipelineDesc &desc,
+    const vk::GraphicsPipelineDesc **descPtrOut,
+    vk::PipelineHelper **pipelineOut)
+{
+    vk::Pipeline newPipeline;
+    vk::CacheLookUpFeedback feedback = vk::CacheLookUpFeedback::None;
+
+    // This "if" is left here for the benefit of VulkanPipelineCachePerfTest.
+    if (context != nullptr)
+    {
+        constexpr vk::GraphicsPipelineSubset kSubset =
+            GraphicsPipelineCacheTypeHelper<Hash>::kSubset;
+
+        ANGLE_VK_TRY(context, desc.initializePipeline(context, pipelineCache, kSubset,
+                                                      compatibleRenderPass, pipelineLayout, shaders,
+                                                      specConsts, &newPipeline, &feedback));
+    }
+
+    if (source == PipelineSource::WarmUp)
+    {
+        **pipelineOut =
+            vk::PipelineHelper(std::move(newPipeline), vk::CacheLookUpFeedback::WarmUpMiss);
+    }
+    else if (!addToCache(source, desc, std::move(newPipeline), feedback, descPtrOut, pipelineOut))
+    {
+        // Another thread created the same pipeline in the meantime.
+        if (context != nullptr)
+        {
+            newPipeline.destroy(context->getDevice());
+        }
+    }
+    return angle::Result::Continue;
+}
+
+template <typename Hash>
+angle::Result ConcurrentGraphicsPipelineCache<Hash>::linkLibraries(
+    vk::Context *context,
+    vk::PipelineCacheAccess *pipelineCache,
+    const vk::GraphicsPipelineDesc &desc,
+    const vk::PipelineLayout &pipelineLayout,
+    vk::PipelineHelper *vertexInputPipeline,
+    vk::PipelineHelper *shadersPipeline,
+    vk::PipelineHelper *fragmentOutputPipeline,
+    const vk::GraphicsPipelineDesc **descPtrOut,
+    vk::PipelineHelper **pipelineOut)
+{
+    vk::Pipeline newPipeline;
+    vk::CacheLookUpFeedback feedback = vk::CacheLookUpFeedback::None;
+
+    ANGLE_TRY(vk::InitializePipelineFromLibraries(
+        context, pipelineCache, pipelineLayout, *vertexInputPipeline, *shadersPipeline,
+        *fragmentOutputPipeline, desc, &newPipeline, &feedback));
+
+    if (addToCache(PipelineSource::DrawLinked, desc, std::move(newPipeline), feedback, descPtrOut,
+                   pipelineOut))
+    {
+        (*pipelineOut)->setLinkedLibraryReferences(shadersPipeline);
+    }
+    else
+    {
+        newPipeline.destroy(context->getDevice());
+    }
+
+    return angle::Result::Continue;
+}
+
+template <typename Hash>
+void ConcurrentGraphicsPipelineCache<Hash>::populate(const vk::GraphicsPipelineDesc &desc,
+                                                     vk::Pipeline &&pipeline,
+                                                     vk::PipelineHelper **pipelineHelperOut)
+{
+    const size_t hash = Hash()(desc);
+    Shard &shard      = getOrAllocateShard(hash);
+
+    std::lock_guard<angle::SimpleMutex> lock(shard.mutex);
+    if (shard.find(desc, hash) != nullptr)
+    {
+        return;
+    }
+
+    auto entry = std::make_unique<Entry>(desc, std::move(pipeline), vk::CacheLookUpFeedback::None,
+                                         hash);
+    if (pipelineHelperOut)
+    {
+        *pipelineHelperOut = &entry->pipeline;
+    }
+    shard.insert(std::move(entry));
+}
+
+template <typename Hash>
+bool ConcurrentGraphicsPipelineCache<Hash>::addToCache(PipelineSource source,
+                                                       const vk::GraphicsPipelineDesc &desc,
+                                                       vk::Pipeline &&pipeline,
+                                                       vk::CacheLookUpFeedback feedback,
+                                                       const vk::GraphicsPipelineDesc **descPtrOut,
+                                                       vk::PipelineHelper **pipelineOut)
+{
+    const size_t hash = Hash()(desc);
+    Shard &shard      = getOrAllocateShard(hash);
+
+    std::lock_guard<angle::SimpleMutex> lock(shard.mutex);
+    ++shard.missCount;
+
+    // The lookup that preceded this call is racy, so check again under the lock.
+    Entry *existingEntry = shard.find(desc, hash);
+    if (existingEntry != nullptr)
+    {
+        *descPtrOut  = &existingEntry->desc;
+        *pipelineOut = &existingEntry->pipeline;
+        return false;
+    }
+
+    auto entry = std::make_unique<Entry>(
+        desc, std::move(pipeline), GetPipelineCacheFeedbackForSource(source, feedback), hash);
+    *descPtrOut  = &entry->desc;
+    *pipelineOut = &entry->pipeline;
+    shard.insert(std::move(entry));
+    return true;
+}
+
+template <typename Hash>
+void ConcurrentGraphicsPipelineCache<Hash>::collectCacheStats(CacheStats *accum, bool reset)
+{
+    Shard *shards = mShards.load(std::memory_order_acquire);
+    if (shards == nullptr)
+    {
+        return;
+    }
+
+    uint32_t size = 0;
+    for (size_t shardIndex = 0; shardIndex < kShardCount; ++shardIndex)
+    {
+        Shard &shard = shards[shardIndex];
+        std::lock_guard<angle::SimpleMutex> lock(shard.mutex);
+
+        accum->hit(reset ? shard.hitCount.exchange(0, std::memory_order_relaxed)
+                         : shard.hitCount.load(std::memory_order_relaxed));
+        accum->miss(shard.missCount);
+        if (reset)
+        {
+            shard.missCount = 0;
+        }
+        size += static_cast<uint32_t>(shard.entries.size());
+    }
+    accum->setSize(accum->getSize() + size);
+}
+
+template <typename Hash>
+void ConcurrentGraphicsPipelineCache<Hash>::Table::insert(Entry *entry)
+{
+    size_t index = entry->hash & mask;
+    while (slots[index].load(std::memory_order_relaxed) != nullptr)
+    {
+        index = (index + 1) & mask;
+    }
+
+    // Publish the fully constructed entry to lock-free readers.
+    slots[index].store(entry, std::memory_order_release);
+}
+
+template <typename Hash>
+void ConcurrentGraphicsPipelineCache<Hash>::Shard::insert(std::unique_ptr<Entry> &&entry)
+{
+    Table *currentTable = tables.empty() ? nullptr : tables.back().get();
+
+    // Keep the table at most half full so probes stay short.  Readers may still be probing the
+    // current table, so it's retired rather than freed once replaced.
+    if (currentTable == nullptr || (entries.size() + 1) * 2 > currentTable->mask + 1)
+    {
+        const size_t newSize =
+            currentTable == nullptr ? kInitialTableSize : (currentTable->mask + 1) * 2;
+        tables.push_back(std::make_unique<Table>(newSize));
+        currentTable = tables.back().get();
+
+        for (const std::unique_ptr<Entry> &existingEntry : entries)
+        {
+            currentTable->insert(existingEntry.get());
+        }
+    }
+
+    currentTable->insert(entry.get());
+    entries.push_back(std::move(entry));
+
+    table.store(currentTable, std::memory_order_release);
+}
+
+template class ConcurrentGraphicsPipelineCache<GraphicsPipelineDescCompleteHash>;
+template class ConcurrentGraphicsPipelineCache<GraphicsPipelineDescVertexInputHash>;
+template class ConcurrentGraphicsPipelineCache<GraphicsPipelineDescShadersHash>;
+template class ConcurrentGraphicsPipelineCache<GraphicsPipelineDescFragmentOutputHash>;
+
 // DescriptorSetLayoutCache implementation.
 DescriptorSetLayoutCache::DescriptorSetLayoutCache() = default;
 
@@ -8113,7 +8993,7 @@ angle::Result DescriptorSetLayoutCache::getDescriptorSetLayout(
     }
 
     // If DescriptorSetLayoutDesc is empty, reuse placeholder descriptor set layout handle
-    if (desc.empty())
+    if (desc.empty() && desc.getFlags() == 0)
     {
         descriptorSetLayoutOut->set(context->getRenderer()->getDescriptorLayoutForEmptyDesc());
         return angle::Result::Continue;
@@ -8126,7 +9006,7 @@ angle::Result DescriptorSetLayoutCache::getDescriptorSetLayout(
 
     VkDescriptorSetLayoutCreateInfo createInfo = {};
     createInfo.sType        = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
-    createInfo.flags        = 0;
+    createInfo.flags        = desc.getFlags();
     createInfo.bindingCount = static_cast<uint32_t>(bindingVector.size());
     createInfo.pBindings    = bindingVector.data();
 
@@ -8343,4 +9223,46 @@ angle::Result SamplerCache::getSampler(ContextVk *contextVk,
 
     return angle::Result::Continue;
 }
+
+// TransformedSpirvCache implementation.
+TransformedSpirvCache::TransformedSpirvCache() : mPayload(kTransformedSpirvCacheMaxSize) {}
+
+TransformedSpirvCache::~TransformedSpirvCache()
+{
+    ASSERT(mPayload.empty());
+}
+
+void TransformedSpirvCache::destroy(vk::Renderer *renderer)
+{
+    std::unique_lock<angle::SimpleMutex> lock(mMutex);
+
+    mCacheStats.setSize(static_cast<uint32_t>(mPayload.entryCount()));
+    renderer->accumulateCacheStats(VulkanCacheType::TransformedSpirv, mCacheStats);
+
+    mPayload.clear();
+}
+
+bool TransformedSpirvCache::get(const angle::BlobCacheKey &key, angle::spirv::Blob *spirvBlobOut)
+{
+    std::unique_lock<angle::SimpleMutex> lock(mMutex);
+
+    const angle::spirv::Blob *cachedBlob = nullptr;
+    if (!mPayload.get(key, &cachedBlob))
+    {
+        mCacheStats.miss();
+        return false;
+    }
+
+    mCacheStats.hit();
+    *spirvBlobOut = *cachedBlob;
+    return true;
+}
+
+void TransformedSpirvCache::put(const angle::BlobCacheKey &key, const angle::spirv::Blob &spirvBlob)
+{
+    std::unique_lock<angle::SimpleMutex> lock(mMutex);
+
+    angle::spirv::Blob blobCopy = spirvBlob;
+    mPayload.put(key, std::move(blobCopy), spirvBlob.size() * sizeof(*spirvBlob.data()));
+}
 }  // namespace rx
@@ -15,6 +15,7 @@
 #include "common/FixedVector.h"
 #include "common/SimpleMutex.h"
 #include "common/WorkerThread.h"
+#include "libANGLE/SizedMRUCache.h"
 #include "libANGLE/Uniform.h"
 #include "libANGLE/renderer/vulkan/ShaderInterfaceVariableInfoMap.h"
 #include "libANGLE/renderer/vulkan/vk_resource.h"
@@ -557,7 +558,9 @@ struct PackedPreRasterizationAndFragmentStates final
     static_assert(gl::IMPLEMENTATION_MAX_DRAW_BUFFERS <= 8,
                   "2 bits per draw buffer is needed for dither emulation");
     uint16_t emulatedDitherControl;
-    uint16_t padding;
+    // Whether the program's descriptors are bound through VK_EXT_descriptor_buffer
+    uint16_t usesDescriptorBuffer : 1;
+    uint16_t padding : 15;
 
     // Affecting VkPipelineDepthStencilStateCreateInfo
     // Dynamic in VK_EXT_extended_dynamic_state
@@ -776,6 +779,10 @@ class GraphicsPipelineDesc final
     size_t hash(GraphicsPipelineSubset subset) const;
     bool keyEqual(const GraphicsPipelineDesc &other, GraphicsPipelineSubset subset) const;
 
+    // Whether the packed enums, formats and counts are all in the range that the update functions
+    // can produce.  Used to reject descs that are read back from the blob cache.
+    bool hasValidPackedState(Renderer *renderer) const;
+
     void initDefaults(const Context *context,
                       GraphicsPipelineSubset subset,
                       PipelineRobustness contextRobustness,
@@ -951,6 +958,10 @@ class GraphicsPipelineDesc final
     void updateEmulatedDitherControl(GraphicsPipelineTransitionBits *transition, uint16_t value);
     uint32_t getEmulatedDitherControl() const { return mShaders.shaders.emulatedDitherControl; }
 
+    void setUsesDescriptorBuffer(bool usesDescriptorBuffer);
+    void updateUsesDescriptorBuffer(GraphicsPipelineTransitionBits *transition,
+                                    bool usesDescriptorBuffer);
+
     bool isLegacyDitherEnabled() const
     {
         return mSharedNonVertexInput.renderPass.isLegacyDitherEnabled();
@@ -1051,6 +1062,18 @@ class DescriptorSetLayoutDesc final
 
     void unpackBindings(DescriptorSetLayoutBindingVector *bindings) const;
 
+    // Layouts used with VK_EXT_descriptor_buffer are created with
+    // VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT.
+    void setUsesDescriptorBuffer()
+    {
+        mFlags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
+    }
+    void setUsesPushDescriptor()
+    {
+        mFlags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR;
+    }
+    VkDescriptorSetLayoutCreateFlags getFlags() const { return mFlags; }
+
     bool empty() const { return mDescriptorSetLayoutBindings.empty(); }
 
   private:
@@ -1083,7 +1106,9 @@ class DescriptorSetLayoutDesc final
     angle::FastVector<PackedDescriptorSetBinding, kDefaultDescriptorSetLayoutBindingsCount>
         mDescriptorSetLayoutBindings;
 
-#if !defined(ANGLE_IS_64_BIT_CPU)
+    // Stores a packed VkDescriptorSetLayoutCreateFlags.
+    uint32_t mFlags;
+#if defined(ANGLE_IS_64_BIT_CPU)
     ANGLE_MAYBE_UNUSED_PRIVATE_FIELD uint32_t mPadding = 0;
 #endif
 };
@@ -1678,6 +1703,15 @@ struct DescriptorDescHandles
     VkBufferView bufferView;
 };
 
+// The data consumed by descriptor update templates created by WriteDescriptorDescs.  There is one
+// entry per descriptor, at the same index as its DescriptorInfoDesc.
+union DescriptorUpdateInfo
+{
+    VkDescriptorImageInfo image;
+    VkDescriptorBufferInfo buffer;
+    VkBufferView bufferView;
+};
+
 class WriteDescriptorDescs
 {
   public:
@@ -1725,6 +1759,12 @@ class WriteDescriptorDescs
     size_t getTotalDescriptorCount() const { return mCurrentInfoIndex; }
     size_t getDynamicDescriptorSetCount() const { return mDynamicDescriptorSetCount; }
 
+    // Creates a template that updates all the descriptors described here from an array of
+    // DescriptorUpdateInfo.  No template is created if there are no descriptors to write.
+    angle::Result initDescriptorUpdateTemplate(Context *context,
+                                               const DescriptorSetLayout &descriptorSetLayout,
+                                               DescriptorUpdateTemplate *templateOut) const;
+
     void streamOut(std::ostream &os) const;
 
   private:
@@ -1750,6 +1790,60 @@ class WriteDescriptorDescs
     uint32_t mCurrentInfoIndex        = 0;
 };
 
+// CPU copy of a descriptor set's contents when it is bound through VK_EXT_descriptor_buffer.
+// Descriptors are written here when the set is updated, and copied into the context's descriptor
+// buffer ring every time the set is bound.
+class DescriptorBufferSet final : angle::NonCopyable
+{
+  public:
+    DescriptorBufferSet();
+    ~DescriptorBufferSet();
+
+    void init(Renderer *renderer,
+              const DescriptorSetLayoutDesc &layoutDesc,
+              const DescriptorSetLayout &layout);
+    void reset();
+
+    VkDeviceSize getSize() const { return mData.size(); }
+    const uint8_t *getData() const { return mData.data(); }
+    uint8_t *getBindingData(uint32_t binding)
+    {
+        ASSERT(binding < mBindingOffsets.size());
+        return mData.data() + mBindingOffsets[binding];
+    }
+
+  private:
+    angle::FastVector<VkDeviceSize, kDefaultDescriptorSetLayoutBindingsCount> mBindingOffsets;
+    std::vector<uint8_t> mData;
+};
+
+// Descriptors of a set created with VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR.  They
+// are recorded when the set is updated, and pushed to the command buffer every time the set is
+// bound.  Only buffer descriptors are supported.
+class PushDescriptorSet final : angle::NonCopyable
+{
+  public:
+    PushDescriptorSet();
+    ~PushDescriptorSet();
+
+    void reset();
+
+    // Returns the VkDescriptorBufferInfo to fill for |descriptorCount| descriptors at |binding|.
+    // The writes are only valid after the last binding is added.
+    VkDescriptorBufferInfo *addBufferWrite(uint32_t binding,
+                                           VkDescriptorType descriptorType,
+                                           uint32_t descriptorCount);
+    void finalize();
+
+    uint32_t getWriteCount() const { return static_cast<uint32_t>(mWrites.size()); }
+    const VkWriteDescriptorSet *getWrites() const { return mWrites.data(); }
+
+  private:
+    angle::FastVector<VkDescriptorBufferInfo, kDefaultDescriptorSetLayoutBindingsCount>
+        mBufferInfos;
+    angle::FastVector<VkWriteDescriptorSet, kDefaultDescriptorSetLayoutBindingsCount> mWrites;
+};
+
 class DescriptorSetDesc
 {
   public:
@@ -1788,6 +1882,29 @@ class DescriptorSetDesc
                              const DescriptorDescHandles *handles,
                              VkDescriptorSet descriptorSet) const;
 
+    // Same as updateDescriptorSet, but the update is done immediately with |updateTemplate|, which
+    // must have been created from |writeDescriptorDescs|.
+    void updateDescriptorSetWithTemplate(Renderer *renderer,
+                                         const WriteDescriptorDescs &writeDescriptorDescs,
+                                         const DescriptorUpdateTemplate &updateTemplate,
+                                         UpdateDescriptorSetsBuilder *updateBuilder,
+                                         const DescriptorDescHandles *handles,
+                                         VkDescriptorSet descriptorSet) const;
+
+    // Dynamic descriptors are written as their non-dynamic counterparts with |dynamicOffsets|
+    // (in binding order) folded into the address.
+    void writeDescriptorBuffer(Renderer *renderer,
+                               const WriteDescriptorDescs &writeDescriptorDescs,
+                               const DescriptorDescHandles *handles,
+                               const uint32_t *dynamicOffsets,
+                               DescriptorBufferSet *descriptorBufferSet) const;
+
+    // Similarly, records the buffer descriptors to be pushed with vkCmdPushDescriptorSetKHR.
+    void writePushDescriptors(const WriteDescriptorDescs &writeDescriptorDescs,
+                              const DescriptorDescHandles *handles,
+                              const uint32_t *dynamicOffsets,
+                              PushDescriptorSet *pushDescriptorSet) const;
+
     void streamOut(std::ostream &os) const;
 
   private:
@@ -1908,6 +2025,8 @@ class DescriptorSetDescBuilder final
                                       const gl::ActiveTextureArray<TextureVk *> &textures,
                                       const gl::SamplerBindingVector &samplers);
 
+    // |sharedCacheKey| may be null if the descriptors are not cached, such as when they are
+    // written to a descriptor buffer.
     angle::Result updateFullActiveTextures(Context *context,
                                            const ShaderInterfaceVariableInfoMap &variableInfoMap,
                                            const WriteDescriptorDescs &writeDescriptorDescs,
@@ -1921,6 +2040,19 @@ class DescriptorSetDescBuilder final
                              const WriteDescriptorDescs &writeDescriptorDescs,
                              UpdateDescriptorSetsBuilder *updateBuilder,
                              VkDescriptorSet descriptorSet) const;
+    void updateDescriptorSetWithTemplate(Renderer *renderer,
+                                         const WriteDescriptorDescs &writeDescriptorDescs,
+                                         const DescriptorUpdateTemplate &updateTemplate,
+                                         UpdateDescriptorSetsBuilder *updateBuilder,
+                                         VkDescriptorSet descriptorSet) const;
+
+    void writeDescriptorBuffer(Renderer *renderer,
+                               const WriteDescriptorDescs &writeDescriptorDescs,
+                               const uint32_t *dynamicOffsets,
+                               DescriptorBufferSet *descriptorBufferSet) const;
+    void writePushDescriptors(const WriteDescriptorDescs &writeDescriptorDescs,
+                              const uint32_t *dynamicOffsets,
+                              PushDescriptorSet *pushDescriptorSet) const;
 
     const uint32_t *getDynamicOffsets() const { return mDynamicOffsets.data(); }
     size_t getDynamicOffsetsSize() const { return mDynamicOffsets.size(); }
@@ -2233,6 +2365,7 @@ enum class VulkanCacheType
     ShaderResourcesDescriptors,
     Framebuffer,
     DescriptorMetaCache,
+    TransformedSpirv,
     EnumCount
 };
 
@@ -2257,6 +2390,8 @@ class CacheStats final : angle::NonCopyable
 
     ANGLE_INLINE void hit() { mHitCount++; }
     ANGLE_INLINE void miss() { mMissCount++; }
+    ANGLE_INLINE void hit(uint32_t count) { mHitCount += count; }
+    ANGLE_INLINE void miss(uint32_t count) { mMissCount += count; }
     ANGLE_INLINE void incrementSize() { mSize++; }
     ANGLE_INLINE void decrementSize() { mSize--; }
     ANGLE_INLINE void missAndIncrementSize()
@@ -2596,11 +2731,210 @@ class GraphicsPipelineCache final : public HasCacheStats<VulkanCacheType::Graphi
     std::unordered_map<vk::GraphicsPipelineDesc, vk::PipelineHelper, Hash, KeyEqual> mPayload;
 };
 
-using CompleteGraphicsPipelineCache    = GraphicsPipelineCache<GraphicsPipelineDescCompleteHash>;
-using VertexInputGraphicsPipelineCache = GraphicsPipelineCache<GraphicsPipelineDescVertexInputHash>;
-using ShadersGraphicsPipelineCache     = GraphicsPipelineCache<GraphicsPipelineDescShadersHash>;
+// A variant of GraphicsPipelineCache that multiple threads can use at the same time, for example
+// contexts of the same share group rendering on different threads.  Looking up an existing
+// pipeline does not take any lock, so concurrent contexts that hit the cache do not serialize on
+// each other.
+//
+// The cache is split into shards by hash, which are allocated on first insertion as most programs
+// only ever use a few of their permutations.  Each shard publishes an open-addressing table of
+// entry pointers, which readers probe with acquire loads only.  Inserting into a shard takes that
+// shard's mutex; when the table grows, the new table is published atomically and the old one is
+// retired, but kept alive as concurrent readers may still be probing it.  Like
+// GraphicsPipelineCache, entries are never evicted, so the pointers returned by lookups stay valid
+// until destroy() or release(), which must not run concurrently with any other call.
+//
+// The cache only synchronizes its own bookkeeping.  The state of the returned PipelineHelper
+// objects, such as their transitions, is not protected by it.
+template <typename Hash>
+class ConcurrentGraphicsPipelineCache final : angle::NonCopyable
+{
+  public:
+    ConcurrentGraphicsPipelineCache();
+    ~ConcurrentGraphicsPipelineCache();
+
+    void destroy(vk::Context *context);
+    void release(vk::Context *context);
+
+    void populate(const vk::GraphicsPipelineDesc &desc,
+                  vk::Pipeline &&pipeline,
+                  vk::PipelineHelper **pipelineHelperOut);
+
+    // Get a pipeline from the cache, if it exists
+    ANGLE_INLINE bool getPipeline(const vk::GraphicsPipelineDesc &desc,
+                                  const vk::GraphicsPipelineDesc **descPtrOut,
+                                  vk::PipelineHelper **pipelineOut)
+    {
+        Shard *shards = mShards.load(std::memory_order_acquire);
+        if (shards == nullptr)
+        {
+            return false;
+        }
+
+        const size_t hash = Hash()(desc);
+        Shard &shard      = shards[GetShardIndex(hash)];
+
+        Entry *entry = shard.find(desc, hash);
+        if (entry == nullptr)
+        {
+            return false;
+        }
+
+        *descPtrOut  = &entry->desc;
+        *pipelineOut = &entry->pipeline;
+
+        shard.hitCount.fetch_add(1, std::memory_order_relaxed);
+
+        return true;
+    }
+
+    // Unlike GraphicsPipelineCache, these may be called for a pipeline that is already in the
+    // cache, as another thread may have created the same pipeline after this thread's lookup
+    // missed.  In that case, the new pipeline is discarded and the cached one is returned.
+    angle::Result createPipeline(vk::Context *context,
+                                 vk::PipelineCacheAccess *pipelineCache,
+                                 const vk::RenderPass &compatibleRenderPass,
+                                 const vk::PipelineLayout &pipelineLayout,
+                                 const vk::ShaderModuleMap &shaders,
+                                 const vk::SpecializationConstants &specConsts,
+                                 PipelineSource source,
+                                 const vk::GraphicsPipelineDesc &desc,
+                                 const vk::GraphicsPipelineDesc **descPtrOut,
+                                 vk::PipelineHelper **pipelineOut);
+
+    angle::Result linkLibraries(vk::Context *context,
+                                vk::PipelineCacheAccess *pipelineCache,
+                                const vk::GraphicsPipelineDesc &desc,
+                                const vk::PipelineLayout &pipelineLayout,
+                                vk::PipelineHelper *vertexInputPipeline,
+                                vk::PipelineHelper *shadersPipeline,
+                                vk::PipelineHelper *fragmentOutputPipeline,
+                                const vk::GraphicsPipelineDesc **descPtrOut,
+                                vk::PipelineHelper **pipelineOut);
+
+    template <typename Accumulator>
+    void accumulateCacheStats(Accumulator *accum)
+    {
+        CacheStats stats;
+        collectCacheStats(&stats, true);
+        accum->accumulateCacheStats(VulkanCacheType::GraphicsPipeline, stats);
+    }
+
+    void getCacheStats(CacheStats *accum) { collectCacheStats(accum, false); }
+
+    // Helper for VulkanPipelineCachePerf that resets the object without destroying any object.
+    void reset();
+
+  private:
+    static constexpr size_t kShardCount       = 16;
+    static constexpr size_t kInitialTableSize = 16;
+
+    using KeyEqual = typename GraphicsPipelineCacheTypeHelper<Hash>::KeyEqual;
+
+    struct Entry
+    {
+        Entry(const vk::GraphicsPipelineDesc &descIn,
+              vk::Pipeline &&pipelineIn,
+              vk::CacheLookUpFeedback feedback,
+              size_t hashIn)
+            : desc(descIn), pipeline(std::move(pipelineIn), feedback), hash(hashIn)
+        {}
+
+        vk::GraphicsPipelineDesc desc;
+        vk::PipelineHelper pipeline;
+        size_t hash;
+    };
+
+    struct Table
+    {
+        explicit Table(size_t size) : mask(size - 1), slots(new std::atomic<Entry *>[size])
+        {
+            ASSERT(gl::isPow2(size));
+            for (size_t index = 0; index < size; ++index)
+            {
+                slots[index].store(nullptr, std::memory_order_relaxed);
+            }
+        }
+
+        // Must be called with the shard's mutex held.
+        void insert(Entry *entry);
+
+        const size_t mask;
+        std::unique_ptr<std::atomic<Entry *>[]> slots;
+    };
+
+    // Shards are cache line aligned so threads that hit different shards don't contend on
+    // |hitCount|.
+    struct alignas(64) Shard
+    {
+        ANGLE_INLINE Entry *find(const vk::GraphicsPipelineDesc &desc, size_t hash) const
+        {
+            const Table *currentTable = table.load(std::memory_order_acquire);
+            if (currentTable == nullptr)
+            {
+                return nullptr;
+            }
+
+            // The table is never full, so the probe always ends on an empty slot.
+            for (size_t index = hash & currentTable->mask;;
+                 index        = (index + 1) & currentTable->mask)
+            {
+                Entry *entry = currentTable->slots[index].load(std::memory_order_acquire);
+                if (entry == nullptr)
+                {
+                    return nullptr;
+                }
+                if (entry->hash == hash && KeyEqual()(entry->desc, desc))
+                {
+                    return entry;
+                }
+            }
+        }
+
+        // Must be called with |mutex| held.  |entry| must not already be in the shard.
+        void insert(std::unique_ptr<Entry> &&entry);
+
+        std::atomic<Table *> table{nullptr};
+        std::atomic<uint32_t> hitCount{0};
+
+        angle::SimpleMutex mutex;
+        // The following are protected by |mutex|.  |tables| holds the published table last,
+        // preceded by the retired ones.
+        std::vector<std::unique_ptr<Entry>> entries;
+        std::vector<std::unique_ptr<Table>> tables;
+        uint32_t missCount = 0;
+    };
+
+    // Use bits of the hash that are not used to index the shard's table.
+    static size_t GetShardIndex(size_t hash) { return (hash >> 24) % kShardCount; }
+
+    // Adds the pipeline to the cache, unless another thread has already added |desc|, in which
+    // case |pipeline| is left untouched.  Returns whether the pipeline was added.
+    bool addToCache(PipelineSource source,
+                    const vk::GraphicsPipelineDesc &desc,
+                    vk::Pipeline &&pipeline,
+                    vk::CacheLookUpFeedback feedback,
+                    const vk::GraphicsPipelineDesc **descPtrOut,
+                    vk::PipelineHelper **pipelineOut);
+
+    void collectCacheStats(CacheStats *accum, bool reset);
+    Shard &getOrAllocateShard(size_t hash);
+    void dumpPipelineCacheGraph(vk::Context *context) const;
+    void clearShards();
+
+    // An array of kShardCount shards, or nullptr until the first insertion.
+    std::atomic<Shard *> mShards{nullptr};
+};
+
+// The caches of programs and ShareGroupVk, which are looked up by all contexts of the share group.
+using CompleteGraphicsPipelineCache =
+    ConcurrentGraphicsPipelineCache<GraphicsPipelineDescCompleteHash>;
+using VertexInputGraphicsPipelineCache =
+    ConcurrentGraphicsPipelineCache<GraphicsPipelineDescVertexInputHash>;
+using ShadersGraphicsPipelineCache =
+    ConcurrentGraphicsPipelineCache<GraphicsPipelineDescShadersHash>;
 using FragmentOutputGraphicsPipelineCache =
-    GraphicsPipelineCache<GraphicsPipelineDescFragmentOutputHash>;
+    ConcurrentGraphicsPipelineCache<GraphicsPipelineDescFragmentOutputHash>;
 
 class DescriptorSetLayoutCache final : angle::NonCopyable
 {
@@ -2681,6 +3015,25 @@ class SamplerYcbcrConversionCache final
     SamplerYcbcrConversionMap mVkFormatPayload;
 };
 
+// Transformed SPIR-V Cache.  Programs that share shaders (and the same variant) transform their
+// SPIR-V identically, so the output of SpvTransformSpirvCode is cached by a hash of all its
+// inputs (see SpvGetTransformedSpirvCacheKey).  Used from link and warm up threads.
+class TransformedSpirvCache final : public HasCacheStats<VulkanCacheType::TransformedSpirv>
+{
+  public:
+    TransformedSpirvCache();
+    ~TransformedSpirvCache() override;
+
+    void destroy(vk::Renderer *renderer);
+
+    bool get(const angle::BlobCacheKey &key, angle::spirv::Blob *spirvBlobOut);
+    void put(const angle::BlobCacheKey &key, const angle::spirv::Blob &spirvBlob);
+
+  private:
+    angle::SimpleMutex mMutex;
+    angle::SizedMRUCache<angle::BlobCacheKey, angle::spirv::Blob> mPayload;
+};
+
 // Descriptor Set Cache
 class DescriptorSetCache final : angle::NonCopyable
 {
@@ -2781,6 +3134,10 @@ class UpdateDescriptorSetsBuilder final : angle::NonCopyable
     VkWriteDescriptorSet &allocWriteDescriptorSet() { return *allocWriteDescriptorSets(1); }
     VkBufferView &allocBufferView() { return *allocBufferViews(1); }
 
+    // Descriptor update templates are applied immediately, so their data is not retained until
+    // flushDescriptorSetUpdates() and the same storage is reused for every update.
+    vk::DescriptorUpdateInfo *getDescriptorUpdateInfos(size_t count);
+
     // Returns the number of written descriptor sets.
     uint32_t flushDescriptorSetUpdates(VkDevice device);
 
@@ -2794,6 +3151,7 @@ class UpdateDescriptorSetsBuilder final : angle::NonCopyable
     std::vector<VkDescriptorImageInfo> mDescriptorImageInfos;
     std::vector<VkWriteDescriptorSet> mWriteDescriptorSets;
     std::vector<VkBufferView> mBufferViews;
+    std::vector<vk::DescriptorUpdateInfo> mDescriptorUpdateInfos;
 };
 
 }  // namespace rx
@@ -8,6 +8,7 @@
 
 #include "libANGLE/renderer/vulkan/vk_helpers.h"
 
+#include "common/WorkerThread.h"
 #include "common/utilities.h"
 #include "common/vulkan/vk_headers.h"
 #include "image_util/loadimage.h"
@@ -25,6 +26,8 @@
 #include "libANGLE/renderer/vulkan/vk_renderer.h"
 #include "libANGLE/renderer/vulkan/vk_utils.h"
 
+#include <thread>
+
 namespace rx
 {
 namespace vk
@@ -1151,6 +1154,100 @@ void GetVkClearDepthStencilValueFromBytes(uint8_t *intendedData,
     clearValueOut->depthStencil.depth   = static_cast<float>(depthValue);
     clearValueOut->depthStencil.stencil = dsData[2];
 }
+
+// Uploads with many layers (or 3D slices) are converted on multiple threads, as every slice is
+// converted independently.  Below this size, the threading overhead outweighs the benefit.
+constexpr size_t kParallelImageLoadMinSize      = 1024 * 1024;
+constexpr size_t kParallelImageLoadMaxTaskCount = 16;
+
+class ImageLoadTask final : public angle::Closure
+{
+  public:
+    ImageLoadTask(LoadImageFunction loadFunction,
+                  const angle::ImageLoadContext &context,
+                  const gl::Extents &extents,
+                  const uint8_t *input,
+                  size_t inputRowPitch,
+                  size_t inputDepthPitch,
+                  uint8_t *output,
+                  size_t outputRowPitch,
+                  size_t outputDepthPitch)
+        : mLoadFunction(loadFunction),
+          mContext(context),
+          mExtents(extents),
+          mInput(input),
+          mInputRowPitch(inputRowPitch),
+          mInputDepthPitch(inputDepthPitch),
+          mOutput(output),
+          mOutputRowPitch(outputRowPitch),
+          mOutputDepthPitch(outputDepthPitch)
+    {}
+
+    void operator()() override
+    {
+        ANGLE_TRACE_EVENT0("gpu.angle", "ImageLoadTask");
+        mLoadFunction(mContext, mExtents.width, mExtents.height, mExtents.depth, mInput,
+                      mInputRowPitch, mInputDepthPitch, mOutput, mOutputRowPitch,
+                      mOutputDepthPitch);
+    }
+
+  private:
+    LoadImageFunction mLoadFunction;
+    angle::ImageLoadContext mContext;
+    gl::Extents mExtents;
+    const uint8_t *mInput;
+    size_t mInputRowPitch;
+    size_t mInputDepthPitch;
+    uint8_t *mOutput;
+    size_t mOutputRowPitch;
+    size_t mOutputDepthPitch;
+};
+
+// Calls |loadFunction| on the whole image, splitting the slices over the multi-threaded pool of
+// |context| if worthwhile.  |canSplit| must only be set if the load function converts each slice
+// independently and does not use the thread pools itself.
+void LoadImage(const angle::ImageLoadContext &context,
+               LoadImageFunction loadFunction,
+               bool canSplit,
+               const gl::Extents &extents,
+               const uint8_t *input,
+               size_t inputRowPitch,
+               size_t inputDepthPitch,
+               uint8_t *output,
+               size_t outputRowPitch,
+               size_t outputDepthPitch)
+{
+    const size_t depth = static_cast<size_t>(extents.depth);
+
+    size_t taskCount = 1;
+    if (canSplit && depth > 1 && outputDepthPitch * depth >= kParallelImageLoadMinSize &&
+        context.multiThreadPool && context.multiThreadPool->isAsync())
+    {
+        const size_t threadCount = std::max(1u, std::thread::hardware_concurrency());
+        taskCount                = std::min({depth, threadCount, kParallelImageLoadMaxTaskCount});
+    }
+
+    const size_t slicesPerTask = (depth + taskCount - 1) / taskCount;
+    gl::Extents sliceExtents   = extents;
+
+    std::vector<std::shared_ptr<angle::WaitableEvent>> waitEvents;
+    for (size_t firstSlice = slicesPerTask; firstSlice < depth; firstSlice += slicesPerTask)
+    {
+        sliceExtents.depth = static_cast<int>(std::min(slicesPerTask, depth - firstSlice));
+        std::shared_ptr<ImageLoadTask> task = std::make_shared<ImageLoadTask>(
+            loadFunction, context, sliceExtents, input + firstSlice * inputDepthPitch,
+            inputRowPitch, inputDepthPitch, output + firstSlice * outputDepthPitch, outputRowPitch,
+            outputDepthPitch);
+        waitEvents.push_back(context.multiThreadPool->postWorkerTask(task));
+    }
+
+    // The first slices are converted on this thread while the workers convert the rest.
+    sliceExtents.depth = static_cast<int>(std::min(slicesPerTask, depth));
+    loadFunction(context, sliceExtents.width, sliceExtents.height, sliceExtents.depth, input,
+                 inputRowPitch, inputDepthPitch, output, outputRowPitch, outputDepthPitch);
+
+    angle::WaitableEvent::WaitMany(&waitEvents);
+}
 }  // anonymous namespace
 
 // This is an arbitrary max. We can change this later if necessary.
@@ -8247,9 +8344,12 @@ angle::Result ImageHelper::stageSubresourceUpdateImpl(ContextVk *contextVk,
                                                 MemoryCoherency::CachedNonCoherent,
                                                 storageFormat.id, &stagingOffset, &stagingPointer));
 
-    loadFunctionInfo.loadFunction(
-        contextVk->getImageLoadContext(), glExtents.width, glExtents.height, glExtents.depth,
-        source, inputRowPitch, inputDepthPitch, stagingPointer, outputRowPitch, outputDepthPitch);
+    // The layers of array textures and slices of 3D textures are converted independently, except
+    // by the decompression functions, which may use the thread pools themselves.
+    const bool canSplitLoad = !formatInfo.compressed && !storageFormat.isBlock;
+    LoadImage(contextVk->getImageLoadContext(), loadFunctionInfo.loadFunction, canSplitLoad,
+              glExtents, source, inputRowPitch, inputDepthPitch, stagingPointer, outputRowPitch,
+              outputDepthPitch);
 
     // YUV formats need special handling.
     if (storageFormat.isYUV)
@@ -12400,6 +12500,12 @@ angle::Result ShaderProgramHelper::getOrCreateComputePipeline(
         createInfo.flags |= VK_PIPELINE_CREATE_NO_PROTECTED_ACCESS_BIT_EXT;
     }
 
+    if (pipelineOptions.descriptorBuffer != 0)
+    {
+        ASSERT(context->getRenderer()->useDescriptorBuffer());
+        createInfo.flags |= VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
+    }
+
     VkPipelineCreationFeedback feedback               = {};
     VkPipelineCreationFeedback perStageFeedback       = {};
     VkPipelineCreationFeedbackCreateInfo feedbackInfo = {};
@@ -3643,10 +3643,13 @@ union ComputePipelineOptions final
         // protected-only. Similar to robustness, EGL allows protected and unprotected to be in the
         // same share group.
         uint8_t protectedAccess : 1;
-        uint8_t reserved : 6;  // must initialize to zero
+        // Whether the program binds its descriptors through VK_EXT_descriptor_buffer.  This is a
+        // property of the program's pipeline layout, not of the context.
+        uint8_t descriptorBuffer : 1;
+        uint8_t reserved : 5;  // must initialize to zero
     };
     uint8_t permutationIndex;
-    static constexpr uint32_t kPermutationCount = 0x1 << 2;
+    static constexpr uint32_t kPermutationCount = 0x1 << 3;
 };
 static_assert(sizeof(ComputePipelineOptions) == 1, "Size check failed");
 ComputePipelineOptions GetComputePipelineOptions(vk::PipelineRobustness robustness,
@@ -3667,10 +3670,10 @@ class ShaderProgramHelper : angle::NonCopyable
 
     // Create a graphics pipeline and place it in the cache.  Must not be called if the pipeline
     // exists in cache.
-    template <typename PipelineHash>
+    template <typename PipelineCacheType>
     ANGLE_INLINE angle::Result createGraphicsPipeline(
         vk::Context *context,
-        GraphicsPipelineCache<PipelineHash> *graphicsPipelines,
+        PipelineCacheType *graphicsPipelines,
         PipelineCacheAccess *pipelineCache,
         const RenderPass &compatibleRenderPass,
         const PipelineLayout &pipelineLayout,
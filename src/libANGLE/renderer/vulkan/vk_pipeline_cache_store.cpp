@@ -0,0 +1,308 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// vk_pipeline_cache_store.cpp:
+//    Implements PipelineCacheDiskStore.
+//
+
+#include "libANGLE/renderer/vulkan/vk_pipeline_cache_store.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include <iomanip>
+#include <random>
+#include <sstream>
+
+#include "common/debug.h"
+#include "libANGLE/angletypes.h"
+#include "libANGLE/trace.h"
+
+namespace rx
+{
+namespace vk
+{
+namespace
+{
+constexpr uint32_t kStoreMagic   = 0x43505641;  // "AVPC"
+constexpr uint32_t kStoreVersion = 2;
+
+// Rewrite the file once it accumulates this many records, to keep loads cheap.
+constexpr uint32_t kMaxRecordCount = 64;
+
+ANGLE_ENABLE_STRUCT_PADDING_WARNINGS
+struct StoreHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    // Random ID given to the file every time it is rewritten.
+    uint32_t fileID;
+    uint32_t vendorID;
+    uint32_t deviceID;
+    uint32_t driverVersion;
+    uint8_t pipelineCacheUUID[VK_UUID_SIZE];
+};
+
+struct RecordHeader
+{
+    uint32_t size;
+    uint32_t crc;
+};
+ANGLE_DISABLE_STRUCT_PADDING_WARNINGS
+
+bool WriteRecord(FILE *file, const uint8_t *data, size_t size)
+{
+    RecordHeader record;
+    record.size = static_cast<uint32_t>(size);
+    record.crc  = angle::GenerateCRC32(data, size);
+
+    return fwrite(&record, sizeof(record), 1, file) == 1 && fwrite(data, 1, size, file) == size;
+}
+
+uint32_t GenerateFileID()
+{
+    std::random_device randomDevice;
+    return randomDevice();
+}
+}  // anonymous namespace
+
+PipelineCacheDiskStore::PipelineCacheDiskStore()
+    : mVendorID(0),
+      mDeviceID(0),
+      mDriverVersion(0),
+      mPipelineCacheUUID{},
+      mFileID(0),
+      mFileSize(0),
+      mStoredSize(0),
+      mStoredCRC(angle::InitCRC32()),
+      mRecordCount(0),
+      mNeedsRewrite(true)
+{}
+
+PipelineCacheDiskStore::~PipelineCacheDiskStore() = default;
+
+void PipelineCacheDiskStore::init(const std::string &directory,
+                                  const VkPhysicalDeviceProperties &properties)
+{
+    mVendorID      = properties.vendorID;
+    mDeviceID      = properties.deviceID;
+    mDriverVersion = properties.driverVersion;
+    memcpy(mPipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE);
+
+    std::ostringstream fileName("angle_vk_pipeline_cache_", std::ios_base::ate);
+    fileName << std::hex << std::setfill('0');
+    for (const uint8_t c : properties.pipelineCacheUUID)
+    {
+        fileName << std::setw(2) << static_cast<uint32_t>(c);
+    }
+    fileName << "_" << properties.vendorID << "_" << properties.deviceID << ".bin";
+
+    mDirectory = directory;
+    mPath      = angle::ConcatenatePath(directory, fileName.str());
+    mLockPath  = mPath + ".lock";
+}
+
+bool PipelineCacheDiskStore::load(std::vector<uint8_t> *scratchOut,
+                                  const uint8_t **dataOut,
+                                  size_t *sizeOut)
+{
+    ASSERT(valid());
+    ANGLE_TRACE_EVENT0("gpu.angle", "PipelineCacheDiskStore::load");
+
+    mStoredSize   = 0;
+    mStoredCRC    = angle::InitCRC32();
+    mRecordCount  = 0;
+    mNeedsRewrite = true;
+
+    // Don't observe records that another process is in the middle of appending.
+    angle::ScopedFileLock lock(mLockPath.c_str());
+    if (!mMappedFile.open(mPath.c_str()) || mMappedFile.size() < sizeof(StoreHeader))
+    {
+        return false;
+    }
+
+    StoreHeader header;
+    memcpy(&header, mMappedFile.data(), sizeof(header));
+    if (header.magic != kStoreMagic || header.version != kStoreVersion ||
+        header.vendorID != mVendorID || header.deviceID != mDeviceID ||
+        header.driverVersion != mDriverVersion ||
+        memcmp(header.pipelineCacheUUID, mPipelineCacheUUID, VK_UUID_SIZE) != 0)
+    {
+        mMappedFile.close();
+        return false;
+    }
+
+    // Walk the records, stopping at the first one that is truncated or fails the CRC check.
+    const uint8_t *firstRecordData = nullptr;
+    size_t offset                  = sizeof(StoreHeader);
+    while (offset + sizeof(RecordHeader) <= mMappedFile.size())
+    {
+        RecordHeader record;
+        memcpy(&record, mMappedFile.data() + offset, sizeof(record));
+        offset += sizeof(record);
+
+        const uint8_t *recordData = mMappedFile.data() + offset;
+        if (record.size > mMappedFile.size() - offset ||
+            angle::GenerateCRC32(recordData, record.size) != record.crc)
+        {
+            WARN() << "Ignoring corrupt data at the end of the pipeline cache file " << mPath;
+            break;
+        }
+        offset += record.size;
+
+        if (mRecordCount == 0)
+        {
+            firstRecordData = recordData;
+        }
+        else
+        {
+            // The data is split over multiple records, so it needs to be stitched together.
+            if (mRecordCount == 1)
+            {
+                scratchOut->assign(firstRecordData, firstRecordData + mStoredSize);
+            }
+            scratchOut->insert(scratchOut->end(), recordData, recordData + record.size);
+        }
+
+        mStoredSize += record.size;
+        mStoredCRC = angle::UpdateCRC32(mStoredCRC, recordData, record.size);
+        ++mRecordCount;
+    }
+
+    if (mRecordCount == 0)
+    {
+        mMappedFile.close();
+        return false;
+    }
+
+    mFileID       = header.fileID;
+    mFileSize     = offset;
+    mNeedsRewrite = offset != mMappedFile.size();
+    *dataOut      = mRecordCount == 1 ? firstRecordData : scratchOut->data();
+    *sizeOut      = mStoredSize;
+    return true;
+}
+
+void PipelineCacheDiskStore::releaseLoadedData()
+{
+    mMappedFile.close();
+}
+
+void PipelineCacheDiskStore::store(const std::vector<uint8_t> &data)
+{
+    ASSERT(valid());
+    ASSERT(!data.empty());
+    ANGLE_TRACE_EVENT0("gpu.angle", "PipelineCacheDiskStore::store");
+
+    angle::ScopedFileLock lock(mLockPath.c_str());
+    if (!lock.isLocked())
+    {
+        WARN() << "Failed to lock the pipeline cache file " << mPath;
+        mNeedsRewrite = true;
+        return;
+    }
+
+    // The data can only be appended if what is on disk is a prefix of it.
+    const bool canAppend =
+        !mNeedsRewrite && mRecordCount < kMaxRecordCount && data.size() > mStoredSize &&
+        angle::GenerateCRC32(data.data(), mStoredSize) == mStoredCRC;
+
+    if (canAppend && append(data.data() + mStoredSize, data.size() - mStoredSize))
+    {
+        mStoredCRC = angle::UpdateCRC32(mStoredCRC, data.data() + mStoredSize,
+                                        data.size() - mStoredSize);
+        mFileSize += sizeof(RecordHeader) + data.size() - mStoredSize;
+        mStoredSize = data.size();
+        ++mRecordCount;
+        return;
+    }
+
+    if (rewrite(data))
+    {
+        mFileSize     = sizeof(StoreHeader) + sizeof(RecordHeader) + data.size();
+        mStoredSize   = data.size();
+        mStoredCRC    = angle::GenerateCRC32(data.data(), data.size());
+        mRecordCount  = 1;
+        mNeedsRewrite = false;
+    }
+    else
+    {
+        WARN() << "Failed to write the pipeline cache file " << mPath;
+        mNeedsRewrite = true;
+    }
+}
+
+bool PipelineCacheDiskStore::rewrite(const std::vector<uint8_t> &data)
+{
+    // The mapping must be gone before the file is replaced.
+    ASSERT(mMappedFile.data() == nullptr);
+
+    // Write to a uniquely named temporary file first and move it in place, so a partially written
+    // file is never observed under the real name.
+    const Optional<std::string> tempPath = angle::CreateTemporaryFileInDirectory(mDirectory);
+    if (!tempPath.valid())
+    {
+        return false;
+    }
+
+    FILE *file = fopen(tempPath.value().c_str(), "wb");
+    if (file == nullptr)
+    {
+        remove(tempPath.value().c_str());
+        return false;
+    }
+
+    // Pick a new ID, so other stores that last saw the old file don't append to this one.
+    uint32_t fileID = GenerateFileID();
+    if (fileID == mFileID)
+    {
+        ++fileID;
+    }
+
+    StoreHeader header;
+    header.magic         = kStoreMagic;
+    header.version       = kStoreVersion;
+    header.fileID        = fileID;
+    header.vendorID      = mVendorID;
+    header.deviceID      = mDeviceID;
+    header.driverVersion = mDriverVersion;
+    memcpy(header.pipelineCacheUUID, mPipelineCacheUUID, VK_UUID_SIZE);
+
+    bool success = fwrite(&header, sizeof(header), 1, file) == 1 &&
+                   WriteRecord(file, data.data(), data.size());
+    success = fclose(file) == 0 && success;
+    success = success && angle::RenameFile(tempPath.value().c_str(), mPath.c_str());
+
+    if (!success)
+    {
+        remove(tempPath.value().c_str());
+        return false;
+    }
+
+    mFileID = fileID;
+    return true;
+}
+
+bool PipelineCacheDiskStore::append(const uint8_t *data, size_t size)
+{
+    FILE *file = fopen(mPath.c_str(), "r+b");
+    if (file == nullptr)
+    {
+        return false;
+    }
+
+    // Only append if nobody else wrote to the file since this store last did; another process
+    // may have appended its own records or replaced the file.
+    StoreHeader header;
+    bool success = fread(&header, sizeof(header), 1, file) == 1 && header.fileID == mFileID &&
+                   fseek(file, 0, SEEK_END) == 0 &&
+                   static_cast<size_t>(ftell(file)) == mFileSize;
+
+    // If the write fails midway, the record fails validation on the next load and is ignored.
+    success = success && WriteRecord(file, data, size);
+    return fclose(file) == 0 && success;
+}
+}  // namespace vk
+}  // namespace rx
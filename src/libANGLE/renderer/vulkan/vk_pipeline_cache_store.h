@@ -0,0 +1,91 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// vk_pipeline_cache_store.h:
+//    Declares PipelineCacheDiskStore, which keeps a copy of the global VkPipelineCache data in a
+//    file on disk.
+//
+
+#ifndef LIBANGLE_RENDERER_VULKAN_VK_PIPELINE_CACHE_STORE_H_
+#define LIBANGLE_RENDERER_VULKAN_VK_PIPELINE_CACHE_STORE_H_
+
+#include <string>
+#include <vector>
+
+#include "common/angleutils.h"
+#include "common/system_utils.h"
+#include "common/vulkan/vk_headers.h"
+
+namespace rx
+{
+namespace vk
+{
+// The pipeline cache data is stored as a log of records whose concatenation is the data last
+// handed to store().  Drivers typically grow the pipeline cache data by appending to it, so
+// most syncs only need to append the new tail of the data as one more record instead of
+// rewriting (and recompressing) the whole cache.  When the data is not an extension of what is
+// already stored, or there are too many records, the file is rewritten with a single record.
+//
+// The file is memory-mapped on load, so a single-record file is handed to vkCreatePipelineCache
+// without any copy.  Truncated or corrupt records at the end of the file (for example, if the
+// process was killed during a write) are ignored and the file is rewritten on the next store.
+//
+// The directory may be shared by multiple processes.  Writers hold a lock file while they write,
+// and a rewrite gives the file a new random ID.  A record is only appended if the file still has
+// the ID and size this store last saw, i.e. if nobody else wrote to it since; otherwise the file
+// is rewritten, so records of different writers are never mixed.
+//
+// The store is not thread-safe.  The renderer loads it once while creating the pipeline cache,
+// and stores to it from at most one task at a time.
+class PipelineCacheDiskStore : angle::NonCopyable
+{
+  public:
+    PipelineCacheDiskStore();
+    ~PipelineCacheDiskStore();
+
+    // Selects the file for this device inside |directory|.  The file name includes the pipeline
+    // cache UUID and the vendor and device IDs, so incompatible data is never loaded.
+    void init(const std::string &directory, const VkPhysicalDeviceProperties &properties);
+    bool valid() const { return !mPath.empty(); }
+
+    // Maps the file and returns the stored pipeline cache data through |dataOut| and |sizeOut|.
+    // The returned pointer stays valid until releaseLoadedData() is called.  |scratchOut| is used
+    // if the data is split over multiple records.  Returns false if there is no usable data.
+    bool load(std::vector<uint8_t> *scratchOut, const uint8_t **dataOut, size_t *sizeOut);
+    void releaseLoadedData();
+
+    // Brings the file up to date with |data|, the full pipeline cache data.
+    void store(const std::vector<uint8_t> &data);
+
+    const std::string &getPath() const { return mPath; }
+
+  private:
+    bool rewrite(const std::vector<uint8_t> &data);
+    bool append(const uint8_t *data, size_t size);
+
+    std::string mDirectory;
+    std::string mPath;
+    std::string mLockPath;
+    uint32_t mVendorID;
+    uint32_t mDeviceID;
+    uint32_t mDriverVersion;
+    uint8_t mPipelineCacheUUID[VK_UUID_SIZE];
+
+    angle::MemoryMappedFile mMappedFile;
+
+    // ID and size of the file as last loaded or written by this store.
+    uint32_t mFileID;
+    size_t mFileSize;
+    // Size and CRC of the data stored in the file, i.e. the concatenation of all records.
+    size_t mStoredSize;
+    uint32_t mStoredCRC;
+    uint32_t mRecordCount;
+    // Set when the file is missing, stale or has a corrupt tail.
+    bool mNeedsRewrite;
+};
+}  // namespace vk
+}  // namespace rx
+
+#endif  // LIBANGLE_RENDERER_VULKAN_VK_PIPELINE_CACHE_STORE_H_
@@ -0,0 +1,337 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// vk_pipeline_cache_store_unittest.cpp: Unit tests for the on-disk pipeline cache record log.
+
+#include <gtest/gtest.h>
+
+#include <stdio.h>
+#include <string.h>
+
+#include "libANGLE/renderer/vulkan/vk_pipeline_cache_store.h"
+#include "util/test_utils.h"
+
+namespace rx
+{
+namespace vk
+{
+namespace
+{
+// Size of the header of every record: the size and the CRC of the data.
+constexpr size_t kRecordHeaderSize = 8;
+
+std::vector<uint8_t> MakeData(size_t size, uint8_t start)
+{
+    std::vector<uint8_t> data(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        data[i] = static_cast<uint8_t>(start + i * 7);
+    }
+    return data;
+}
+
+std::vector<uint8_t> Concatenate(const std::vector<uint8_t> &first,
+                                 const std::vector<uint8_t> &second)
+{
+    std::vector<uint8_t> result = first;
+    result.insert(result.end(), second.begin(), second.end());
+    return result;
+}
+
+size_t GetFileSize(const std::string &path)
+{
+    FILE *file = fopen(path.c_str(), "rb");
+    if (file == nullptr)
+    {
+        return 0;
+    }
+    fseek(file, 0, SEEK_END);
+    const long size = ftell(file);
+    fclose(file);
+    return static_cast<size_t>(size);
+}
+
+std::vector<uint8_t> ReadFile(const std::string &path)
+{
+    std::vector<uint8_t> contents(GetFileSize(path));
+    FILE *file = fopen(path.c_str(), "rb");
+    EXPECT_NE(nullptr, file);
+    EXPECT_EQ(contents.size(), fread(contents.data(), 1, contents.size(), file));
+    fclose(file);
+    return contents;
+}
+
+void WriteFile(const std::string &path, const std::vector<uint8_t> &contents)
+{
+    FILE *file = fopen(path.c_str(), "wb");
+    ASSERT_NE(nullptr, file);
+    EXPECT_EQ(contents.size(), fwrite(contents.data(), 1, contents.size(), file));
+    fclose(file);
+}
+
+class PipelineCacheDiskStoreTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        // Use a directory next to a new temporary file, so tests never see each other's files.
+        Optional<std::string> tempFile = angle::CreateTemporaryFile();
+        ASSERT_TRUE(tempFile.valid());
+        mTempFile  = tempFile.value();
+        mDirectory = mTempFile + "_pipeline_cache";
+        ASSERT_TRUE(angle::CreateDirectories(mDirectory));
+
+        mProperties               = {};
+        mProperties.vendorID      = 0x10DE;
+        mProperties.deviceID      = 0x1234;
+        mProperties.driverVersion = 42;
+        for (uint32_t i = 0; i < VK_UUID_SIZE; ++i)
+        {
+            mProperties.pipelineCacheUUID[i] = static_cast<uint8_t>(i);
+        }
+    }
+
+    void TearDown() override
+    {
+        for (const std::string &path : mCreatedFiles)
+        {
+            angle::DeleteSystemFile(path.c_str());
+            angle::DeleteSystemFile((path + ".lock").c_str());
+        }
+        angle::DeleteSystemFile(mDirectory.c_str());
+        angle::DeleteSystemFile(mTempFile.c_str());
+    }
+
+    void initStore(PipelineCacheDiskStore *store)
+    {
+        store->init(mDirectory, mProperties);
+        ASSERT_TRUE(store->valid());
+        mCreatedFiles.push_back(store->getPath());
+    }
+
+    // Loads the file with a new store, the way the next process would, and compares the data.
+    void expectLoadedData(const std::vector<uint8_t> &expected)
+    {
+        PipelineCacheDiskStore store;
+        initStore(&store);
+
+        std::vector<uint8_t> scratch;
+        const uint8_t *data = nullptr;
+        size_t size         = 0;
+        ASSERT_TRUE(store.load(&scratch, &data, &size));
+        ASSERT_EQ(expected.size(), size);
+        EXPECT_EQ(0, memcmp(expected.data(), data, size));
+        store.releaseLoadedData();
+    }
+
+    std::string mTempFile;
+    std::string mDirectory;
+    VkPhysicalDeviceProperties mProperties;
+    std::vector<std::string> mCreatedFiles;
+};
+
+// Test that data extending the stored data is appended as a new record, and that the records are
+// stitched back together on load.
+TEST_F(PipelineCacheDiskStoreTest, LoadAfterAppend)
+{
+    PipelineCacheDiskStore store;
+    initStore(&store);
+
+    std::vector<uint8_t> scratch;
+    const uint8_t *data = nullptr;
+    size_t size         = 0;
+    EXPECT_FALSE(store.load(&scratch, &data, &size));
+    store.releaseLoadedData();
+
+    const std::vector<uint8_t> first = MakeData(1000, 1);
+    store.store(first);
+    const size_t firstFileSize = GetFileSize(store.getPath());
+    expectLoadedData(first);
+
+    const std::vector<uint8_t> tail     = MakeData(300, 2);
+    const std::vector<uint8_t> extended = Concatenate(first, tail);
+    store.store(extended);
+    EXPECT_EQ(firstFileSize + kRecordHeaderSize + tail.size(), GetFileSize(store.getPath()));
+    expectLoadedData(extended);
+
+    // A store that loaded the file can keep appending to it.
+    PipelineCacheDiskStore otherStore;
+    initStore(&otherStore);
+    ASSERT_TRUE(otherStore.load(&scratch, &data, &size));
+    otherStore.releaseLoadedData();
+
+    const std::vector<uint8_t> extendedAgain = Concatenate(extended, MakeData(10, 3));
+    otherStore.store(extendedAgain);
+    EXPECT_EQ(firstFileSize + 2 * kRecordHeaderSize + tail.size() + 10,
+              GetFileSize(store.getPath()));
+    expectLoadedData(extendedAgain);
+}
+
+// Test that data that doesn't start with the stored data replaces the file with a single record.
+TEST_F(PipelineCacheDiskStoreTest, PrefixMismatchRewrites)
+{
+    PipelineCacheDiskStore store;
+    initStore(&store);
+
+    const std::vector<uint8_t> first = MakeData(1000, 1);
+    store.store(first);
+    const size_t headerSize = GetFileSize(store.getPath()) - first.size();
+
+    std::vector<uint8_t> changed = MakeData(1500, 1);
+    changed[10] ^= 0xFF;
+    store.store(changed);
+    EXPECT_EQ(headerSize + changed.size(), GetFileSize(store.getPath()));
+    expectLoadedData(changed);
+
+    // Shrinking the data also rewrites the file.
+    const std::vector<uint8_t> shrunk = MakeData(500, 4);
+    store.store(shrunk);
+    EXPECT_EQ(headerSize + shrunk.size(), GetFileSize(store.getPath()));
+    expectLoadedData(shrunk);
+}
+
+// Test that the file is compacted to a single record once it holds 64 records.
+TEST_F(PipelineCacheDiskStoreTest, CompactionRewrite)
+{
+    constexpr size_t kMaxRecordCount = 64;
+    constexpr size_t kChunkSize      = 16;
+
+    PipelineCacheDiskStore store;
+    initStore(&store);
+
+    std::vector<uint8_t> data = MakeData(kChunkSize, 0);
+    store.store(data);
+    const size_t headerSize = GetFileSize(store.getPath()) - data.size();
+
+    for (size_t recordCount = 2; recordCount <= kMaxRecordCount; ++recordCount)
+    {
+        data = Concatenate(data, MakeData(kChunkSize, static_cast<uint8_t>(recordCount)));
+        store.store(data);
+        EXPECT_EQ(headerSize + (recordCount - 1) * kRecordHeaderSize + data.size(),
+                  GetFileSize(store.getPath()));
+    }
+    expectLoadedData(data);
+
+    data = Concatenate(data, MakeData(kChunkSize, 0xFF));
+    store.store(data);
+    EXPECT_EQ(headerSize + data.size(), GetFileSize(store.getPath()));
+    expectLoadedData(data);
+}
+
+// Test that a truncated or corrupt last record is ignored on load, and that the next store
+// rewrites the file.
+TEST_F(PipelineCacheDiskStoreTest, CorruptTail)
+{
+    PipelineCacheDiskStore store;
+    initStore(&store);
+
+    const std::vector<uint8_t> first    = MakeData(1000, 1);
+    const std::vector<uint8_t> extended = Concatenate(first, MakeData(300, 2));
+    store.store(first);
+    const size_t headerSize = GetFileSize(store.getPath()) - first.size();
+    store.store(extended);
+
+    const std::vector<uint8_t> contents = ReadFile(store.getPath());
+
+    // Truncate the last record.
+    std::vector<uint8_t> truncated(contents.begin(), contents.end() - 5);
+    WriteFile(store.getPath(), truncated);
+    expectLoadedData(first);
+
+    // Flip a byte in the last record.
+    std::vector<uint8_t> corrupt = contents;
+    corrupt[corrupt.size() - 5] ^= 0xFF;
+    WriteFile(store.getPath(), corrupt);
+    expectLoadedData(first);
+
+    // A store that loaded the corrupt file rewrites it instead of appending after the bad record.
+    PipelineCacheDiskStore otherStore;
+    initStore(&otherStore);
+    std::vector<uint8_t> scratch;
+    const uint8_t *data = nullptr;
+    size_t size         = 0;
+    ASSERT_TRUE(otherStore.load(&scratch, &data, &size));
+    otherStore.releaseLoadedData();
+
+    otherStore.store(extended);
+    EXPECT_EQ(headerSize + extended.size(), GetFileSize(store.getPath()));
+    expectLoadedData(extended);
+
+    // A corrupt first record leaves no data.
+    corrupt = ReadFile(store.getPath());
+    corrupt[headerSize] ^= 0xFF;
+    WriteFile(store.getPath(), corrupt);
+    EXPECT_FALSE(otherStore.load(&scratch, &data, &size));
+    otherStore.releaseLoadedData();
+}
+
+// Test that a store doesn't append to a file that another writer changed since, as the records
+// of different writers would form data that neither of them produced.
+TEST_F(PipelineCacheDiskStoreTest, ConcurrentWriters)
+{
+    const std::vector<uint8_t> first = MakeData(1000, 1);
+
+    PipelineCacheDiskStore writerA;
+    initStore(&writerA);
+    writerA.store(first);
+    const size_t headerSize = GetFileSize(writerA.getPath()) - first.size();
+
+    PipelineCacheDiskStore writerB;
+    initStore(&writerB);
+    std::vector<uint8_t> scratch;
+    const uint8_t *data = nullptr;
+    size_t size         = 0;
+    ASSERT_TRUE(writerB.load(&scratch, &data, &size));
+    writerB.releaseLoadedData();
+
+    // Both writers extend the same data differently.  The second one to write must replace the
+    // file instead of appending after the other's record.  The sizes are picked so that the file
+    // written by B has the size A expects.
+    const std::vector<uint8_t> extendedA = Concatenate(first, MakeData(100, 2));
+    const std::vector<uint8_t> extendedB =
+        Concatenate(first, MakeData(100 + kRecordHeaderSize, 3));
+    writerA.store(extendedA);
+    writerB.store(extendedB);
+    EXPECT_EQ(headerSize + extendedB.size(), GetFileSize(writerA.getPath()));
+    expectLoadedData(extendedB);
+
+    // The same applies after a rewrite by the other writer, even though the file size matches.
+    const std::vector<uint8_t> extendedAgainA = Concatenate(extendedA, MakeData(10, 4));
+    writerA.store(extendedAgainA);
+    EXPECT_EQ(headerSize + extendedAgainA.size(), GetFileSize(writerA.getPath()));
+    expectLoadedData(extendedAgainA);
+}
+
+// Test that devices with different pipeline cache UUIDs never share a file.
+TEST_F(PipelineCacheDiskStoreTest, FileNamePerUUID)
+{
+    PipelineCacheDiskStore store;
+    initStore(&store);
+
+    // With unpadded hex digits, the UUIDs {0x01, 0x23, ...} and {0x12, 0x03, ...} would map to the
+    // same name.
+    mProperties.pipelineCacheUUID[0] = 0x01;
+    mProperties.pipelineCacheUUID[1] = 0x23;
+    PipelineCacheDiskStore storeA;
+    initStore(&storeA);
+
+    mProperties.pipelineCacheUUID[0] = 0x12;
+    mProperties.pipelineCacheUUID[1] = 0x03;
+    PipelineCacheDiskStore storeB;
+    initStore(&storeB);
+
+    EXPECT_NE(store.getPath(), storeA.getPath());
+    EXPECT_NE(storeA.getPath(), storeB.getPath());
+
+    storeA.store(MakeData(100, 1));
+    std::vector<uint8_t> scratch;
+    const uint8_t *data = nullptr;
+    size_t size         = 0;
+    EXPECT_FALSE(storeB.load(&scratch, &data, &size));
+    storeB.releaseLoadedData();
+}
+}  // anonymous namespace
+}  // namespace vk
+}  // namespace rx
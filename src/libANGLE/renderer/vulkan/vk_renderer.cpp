@@ -1328,6 +1328,21 @@ class CompressAndStorePipelineCacheTask : public angle::Closure
     size_t mMaxTotalSize;
 };
 
+class StorePipelineCacheToDiskTask : public angle::Closure
+{
+  public:
+    StorePipelineCacheToDiskTask(vk::PipelineCacheDiskStore *diskStore,
+                                 std::vector<uint8_t> &&cacheData)
+        : mDiskStore(diskStore), mCacheData(std::move(cacheData))
+    {}
+
+    void operator()() override { mDiskStore->store(mCacheData); }
+
+  private:
+    vk::PipelineCacheDiskStore *mDiskStore;
+    std::vector<uint8_t> mCacheData;
+};
+
 angle::Result GetAndDecompressPipelineCacheVk(vk::Context *context,
                                               vk::GlobalOps *globalOps,
                                               angle::MemoryBuffer *uncompressedData,
@@ -1758,6 +1773,9 @@ Renderer::Renderer()
     {
         mPipelineCacheGraphDumpPath = kDefaultPipelineCacheGraphDumpPath;
     }
+
+    mPipelineCacheDiskStoreDirectory = angle::GetEnvironmentVarOrAndroidProperty(
+        "ANGLE_VK_PIPELINE_CACHE_DIR", "angle.vk_pipeline_cache_dir");
 }
 
 Renderer::~Renderer() {}
@@ -1774,6 +1792,8 @@ void Renderer::onDestroy(vk::Context *context)
         handleDeviceLost();
     }
 
+    flushQueuedBlobCacheEntries(mGlobalOps);
+
     if (mPlaceHolderDescriptorSetLayout && mPlaceHolderDescriptorSetLayout->get().valid())
     {
         ASSERT(!mPlaceHolderDescriptorSetLayout->isReferenced());
@@ -1801,6 +1821,7 @@ void Renderer::onDestroy(vk::Context *context)
 
     mSamplerCache.destroy(this);
     mYuvConversionCache.destroy(this);
+    mTransformedSpirvCache.destroy(this);
     mVkFormatDescriptorCountMap.clear();
 
     mOutsideRenderPassCommandBufferRecycler.onDestroy();
@@ -2681,6 +2702,23 @@ void Renderer::appendDeviceExtensionFeaturesNotPromoted(
         vk::AddToPNextChain(deviceProperties, &mHostImageCopyProperties);
     }
 
+    if (ExtensionFound(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME, deviceExtensionNames))
+    {
+        vk::AddToPNextChain(deviceFeatures, &mDescriptorBufferFeatures);
+        vk::AddToPNextChain(deviceProperties, &mDescriptorBufferProperties);
+    }
+
+    if (ExtensionFound(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME, deviceExtensionNames))
+    {
+        vk::AddToPNextChain(deviceProperties, &mPushDescriptorProperties);
+    }
+
+    if (ExtensionFound(VK_EXT_MULTI_DRAW_EXTENSION_NAME, deviceExtensionNames))
+    {
+        vk::AddToPNextChain(deviceFeatures, &mMultiDrawFeatures);
+        vk::AddToPNextChain(deviceProperties, &mMultiDrawProperties);
+    }
+
     if (ExtensionFound(VK_EXT_VERTEX_INPUT_DYNAMIC_STATE_EXTENSION_NAME, deviceExtensionNames))
     {
         vk::AddToPNextChain(deviceFeatures, &mVertexInputDynamicStateFeatures);
@@ -2824,6 +2862,11 @@ void Renderer::appendDeviceExtensionFeaturesPromotedTo12(
         vk::AddToPNextChain(deviceFeatures, &mHostQueryResetFeatures);
     }
 
+    if (ExtensionFound(VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME, deviceExtensionNames))
+    {
+        vk::AddToPNextChain(deviceFeatures, &mBufferDeviceAddressFeatures);
+    }
+
     if (ExtensionFound(VK_KHR_IMAGELESS_FRAMEBUFFER_EXTENSION_NAME, deviceExtensionNames))
     {
         vk::AddToPNextChain(deviceFeatures, &mImagelessFramebufferFeatures);
@@ -3066,6 +3109,27 @@ void Renderer::queryDeviceExtensionFeatures(const vk::ExtensionNameList &deviceE
     mHostImageCopyProperties.sType =
         VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_IMAGE_COPY_PROPERTIES_EXT;
 
+    mDescriptorBufferFeatures       = {};
+    mDescriptorBufferFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_FEATURES_EXT;
+
+    mDescriptorBufferProperties = {};
+    mDescriptorBufferProperties.sType =
+        VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_PROPERTIES_EXT;
+
+    mPushDescriptorProperties = {};
+    mPushDescriptorProperties.sType =
+        VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PUSH_DESCRIPTOR_PROPERTIES_KHR;
+
+    mMultiDrawFeatures       = {};
+    mMultiDrawFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTI_DRAW_FEATURES_EXT;
+
+    mMultiDrawProperties       = {};
+    mMultiDrawProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTI_DRAW_PROPERTIES_EXT;
+
+    mBufferDeviceAddressFeatures = {};
+    mBufferDeviceAddressFeatures.sType =
+        VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES_KHR;
+
     m8BitStorageFeatures       = {};
     m8BitStorageFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_8BIT_STORAGE_FEATURES_KHR;
 
@@ -3164,6 +3228,12 @@ void Renderer::queryDeviceExtensionFeatures(const vk::ExtensionNameList &deviceE
     mTimelineSemaphoreFeatures.pNext                  = nullptr;
     mHostImageCopyFeatures.pNext                      = nullptr;
     mHostImageCopyProperties.pNext                    = nullptr;
+    mDescriptorBufferFeatures.pNext                   = nullptr;
+    mDescriptorBufferProperties.pNext                 = nullptr;
+    mPushDescriptorProperties.pNext                   = nullptr;
+    mMultiDrawFeatures.pNext                          = nullptr;
+    mMultiDrawProperties.pNext                        = nullptr;
+    mBufferDeviceAddressFeatures.pNext                = nullptr;
     m8BitStorageFeatures.pNext                        = nullptr;
     m16BitStorageFeatures.pNext                       = nullptr;
     mSynchronization2Features.pNext                   = nullptr;
@@ -3465,6 +3535,38 @@ void Renderer::enableDeviceExtensionsNotPromoted(const vk::ExtensionNameList &de
         vk::AddToPNextChain(&mEnabledFeatures, &mHostImageCopyFeatures);
     }
 
+    if (useDescriptorBuffer())
+    {
+        // VK_EXT_descriptor_buffer requires VK_KHR_buffer_device_address,
+        // VK_EXT_descriptor_indexing and VK_KHR_synchronization2.  The latter is enabled
+        // separately; supportsDescriptorBuffer already depends on it.
+        ASSERT(ExtensionFound(VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME, deviceExtensionNames));
+        mEnabledDeviceExtensions.push_back(VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME);
+
+        mBufferDeviceAddressFeatures.bufferDeviceAddressCaptureReplay = VK_FALSE;
+        mBufferDeviceAddressFeatures.bufferDeviceAddressMultiDevice   = VK_FALSE;
+        mEnabledDeviceExtensions.push_back(VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME);
+        vk::AddToPNextChain(&mEnabledFeatures, &mBufferDeviceAddressFeatures);
+
+        // Only the core functionality of the extension is used.
+        mDescriptorBufferFeatures.descriptorBufferCaptureReplay      = VK_FALSE;
+        mDescriptorBufferFeatures.descriptorBufferImageLayoutIgnored = VK_FALSE;
+        mDescriptorBufferFeatures.descriptorBufferPushDescriptors    = VK_FALSE;
+        mEnabledDeviceExtensions.push_back(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME);
+        vk::AddToPNextChain(&mEnabledFeatures, &mDescriptorBufferFeatures);
+    }
+
+    if (usePushDescriptorsForDefaultUniforms())
+    {
+        mEnabledDeviceExtensions.push_back(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME);
+    }
+
+    if (getFeatures().supportsMultiDraw.enabled)
+    {
+        mEnabledDeviceExtensions.push_back(VK_EXT_MULTI_DRAW_EXTENSION_NAME);
+        vk::AddToPNextChain(&mEnabledFeatures, &mMultiDrawFeatures);
+    }
+
     if (getFeatures().supportsVertexInputDynamicState.enabled)
     {
         mEnabledDeviceExtensions.push_back(VK_EXT_VERTEX_INPUT_DYNAMIC_STATE_EXTENSION_NAME);
@@ -3812,6 +3914,23 @@ void Renderer::initDeviceExtensionEntryPoints()
     {
         InitSynchronization2Functions(mDevice);
     }
+    if (mFeatures.supportsTimelineSemaphore.enabled)
+    {
+        InitTimelineSemaphoreFunctions(mDevice);
+    }
+    if (useDescriptorBuffer())
+    {
+        InitBufferDeviceAddressFunctions(mDevice);
+        InitDescriptorBufferFunctions(mDevice);
+    }
+    if (usePushDescriptorsForDefaultUniforms())
+    {
+        InitPushDescriptorFunctions(mDevice);
+    }
+    if (mFeatures.supportsMultiDraw.enabled)
+    {
+        InitMultiDrawFunctions(mDevice);
+    }
     // Extensions promoted to Vulkan 1.2
     {
         if (mFeatures.supportsHostQueryReset.enabled)
@@ -4035,6 +4154,10 @@ angle::Result Renderer::createDeviceAndQueue(vk::Context *context, uint32_t queu
     // Vulkan pipeline cache will be initialized lazily in ensurePipelineCacheInitialized() method.
     ASSERT(!mPipelineCacheInitialized);
     ASSERT(!mPipelineCache.valid());
+    if (mFeatures.usePipelineCacheDiskStore.enabled)
+    {
+        mPipelineCacheDiskStore.init(mPipelineCacheDiskStoreDirectory, mPhysicalDeviceProperties);
+    }
 
     // Track the set of supported pipeline stages.  This is used when issuing image layout
     // transitions that cover many stages (such as AllGraphicsReadOnly) to mask out unsupported
@@ -5017,6 +5140,8 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
                                 maxComputeWorkGroupInvocations >= 256 &&
                                 ((isAMD && !IsWindows()) || isNvidia || isSamsung));
 
+    ANGLE_FEATURE_CONDITION(&mFeatures, forceGenerateMipmapOnCPU, false);
+
     bool isAdreno540 = mPhysicalDeviceProperties.deviceID == angle::kDeviceID_Adreno540;
     ANGLE_FEATURE_CONDITION(&mFeatures, forceMaxUniformBufferSize16KB,
                             isQualcommProprietary && isAdreno540);
@@ -5384,14 +5509,55 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
                             mPipelineProtectedAccessFeatures.pipelineProtectedAccess == VK_TRUE &&
                                 mProtectedMemoryFeatures.protectedMemory == VK_TRUE);
 
+    // VK_EXT_descriptor_buffer depends on VK_KHR_synchronization2 (checked directly as
+    // supportsSynchronization2 is decided further below) and bufferDeviceAddress.  ANGLE binds a
+    // single buffer that holds both resource and sampler descriptors, and writes arrays of combined
+    // image samplers as a single array.
+    ANGLE_FEATURE_CONDITION(
+        &mFeatures, supportsDescriptorBuffer,
+        mDescriptorBufferFeatures.descriptorBuffer == VK_TRUE &&
+            mBufferDeviceAddressFeatures.bufferDeviceAddress == VK_TRUE &&
+            mSynchronization2Features.synchronization2 == VK_TRUE &&
+            ExtensionFound(VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME, deviceExtensionNames) &&
+            mDescriptorBufferProperties.maxResourceDescriptorBufferBindings >= 1 &&
+            mDescriptorBufferProperties.maxSamplerDescriptorBufferBindings >= 1 &&
+            mDescriptorBufferProperties.combinedImageSamplerDescriptorSingleArray == VK_TRUE);
+
+    // Writing descriptors directly into descriptor buffers is opt-in while it matures.
+    ANGLE_FEATURE_CONDITION(&mFeatures, useDescriptorBuffer, false);
+
+    ANGLE_FEATURE_CONDITION(
+        &mFeatures, supportsPushDescriptor,
+        ExtensionFound(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME, deviceExtensionNames) &&
+            mPushDescriptorProperties.maxPushDescriptors > 0);
+
+    // glMultiDraw* calls whose sub-draws share all state are recorded as a single
+    // vkCmdDrawMulti[Indexed]EXT.
+    ANGLE_FEATURE_CONDITION(&mFeatures, supportsMultiDraw,
+                            mMultiDrawFeatures.multiDraw == VK_TRUE &&
+                                mMultiDrawProperties.maxMultiDrawCount > 1);
+
+    // Pushing the default uniforms descriptors avoids the descriptor set cache lookup (and pool
+    // allocation on miss) whenever the uniform buffer changes.  Opt-in until measured on more
+    // drivers; it is not used together with descriptor buffers.
+    ANGLE_FEATURE_CONDITION(&mFeatures, usePushDescriptorsForDefaultUniforms, false);
+
+    // Descriptor update templates are core in Vulkan 1.1.  Programs create one per descriptor set
+    // at link time, letting each set update be a single vkUpdateDescriptorSetWithTemplate call.
+    ANGLE_FEATURE_CONDITION(&mFeatures, useDescriptorUpdateTemplates, true);
+
     // VK_EXT_graphics_pipeline_library is available on NVIDIA drivers earlier
     // than version 531, but there are transient visual glitches with rendering
     // on those earlier versions.  http://anglebug.com/42266655
     //
     // On RADV, creating graphics pipeline can crash in the driver.  http://crbug.com/1497512
+    //
+    // Pipeline libraries must all agree on VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT, which
+    // depends on the program, so the two features are not used together.
     ANGLE_FEATURE_CONDITION(&mFeatures, supportsGraphicsPipelineLibrary,
                             mGraphicsPipelineLibraryFeatures.graphicsPipelineLibrary == VK_TRUE &&
-                                (!isNvidia || nvidiaVersion.major >= 531) && !isRADV);
+                                (!isNvidia || nvidiaVersion.major >= 531) && !isRADV &&
+                                !useDescriptorBuffer());
 
     // The following drivers are known to key the pipeline cache blobs with vertex input and
     // fragment output state, causing draw-time pipeline creation to miss the cache regardless of
@@ -5416,6 +5582,11 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
                             libraryBlobsAreReusedByMonolithicPipelines && !isQualcommProprietary &&
                                 !(IsLinux() && isIntel) && !(IsChromeOS() && isSwiftShader));
 
+    // Disabled until the benefit is measured on real applications.  When enabled, the recorded
+    // pipelines are precompiled after program binary load, and after link only if
+    // warmUpPipelineCacheAtLink is also enabled as they share the same post-link tasks.
+    ANGLE_FEATURE_CONDITION(&mFeatures, precompileRecordedGraphicsPipelines, false);
+
     // On SwiftShader, no data is retrieved from the pipeline cache, so there is no reason to
     // serialize it or put it in the blob cache.
     // For Windows Nvidia Vulkan driver older than 520, Vulkan pipeline cache will only generate one
@@ -5484,6 +5655,10 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
     ANGLE_FEATURE_CONDITION(&mFeatures, verifyPipelineCacheInBlobCache,
                             !mFeatures.hasBlobCacheThatEvictsOldItemsFirst.enabled);
 
+    // Only used when the application opts in by providing a directory for the pipeline cache file.
+    ANGLE_FEATURE_CONDITION(&mFeatures, usePipelineCacheDiskStore,
+                            !mPipelineCacheDiskStoreDirectory.empty());
+
     // On ARM, dynamic state for stencil write mask doesn't work correctly in the presence of
     // discard or alpha to coverage, if the static state provided when creating the pipeline has a
     // value of 0.
@@ -5595,6 +5770,8 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
 
     ANGLE_FEATURE_CONDITION(&mFeatures, supportsTimelineSemaphore,
                             mTimelineSemaphoreFeatures.timelineSemaphore == VK_TRUE);
+    ANGLE_FEATURE_CONDITION(&mFeatures, useTimelineSemaphoreForQueueCompletion,
+                            mFeatures.supportsTimelineSemaphore.enabled);
 
     // 8bit storage features
     ANGLE_FEATURE_CONDITION(&mFeatures, supports8BitStorageBuffer,
@@ -5666,6 +5843,11 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
     ANGLE_FEATURE_CONDITION(&mFeatures, supportsSynchronization2,
                             mSynchronization2Features.synchronization2 == VK_TRUE);
 
+    // Coalesced submissions are made with vkQueueSubmit2, which comes with synchronization2.
+    ANGLE_FEATURE_CONDITION(&mFeatures, coalesceAsyncQueueSubmits,
+                            mFeatures.asyncCommandQueue.enabled &&
+                                mFeatures.supportsSynchronization2.enabled);
+
     // Disable memory report feature overrides if extension is not supported.
     if ((mFeatures.logMemoryReportCallbacks.enabled || mFeatures.logMemoryReportStats.enabled) &&
         !mMemoryReportFeatures.deviceMemoryReport)
@@ -5696,23 +5878,92 @@ angle::Result Renderer::initPipelineCache(vk::Context *context,
                                           bool *success)
 {
     angle::MemoryBuffer initialData;
+    std::vector<uint8_t> diskStoreScratch;
+    const uint8_t *initialDataPtr = nullptr;
+    size_t initialDataSize        = 0;
     if (!mFeatures.disablePipelineCacheLoadForTesting.enabled)
     {
-        ANGLE_TRY(GetAndDecompressPipelineCacheVk(context, mGlobalOps, &initialData, success));
+        if (mPipelineCacheDiskStore.valid())
+        {
+            // The data is used directly from the memory-mapped file when possible.
+            *success = mPipelineCacheDiskStore.load(&diskStoreScratch, &initialDataPtr,
+                                                    &initialDataSize);
+        }
+        else
+        {
+            ANGLE_TRY(GetAndDecompressPipelineCacheVk(context, mGlobalOps, &initialData, success));
+            initialDataPtr  = initialData.data();
+            initialDataSize = initialData.size();
+        }
     }
 
     VkPipelineCacheCreateInfo pipelineCacheCreateInfo = {};
 
     pipelineCacheCreateInfo.sType           = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
     pipelineCacheCreateInfo.flags           = 0;
-    pipelineCacheCreateInfo.initialDataSize = *success ? initialData.size() : 0;
-    pipelineCacheCreateInfo.pInitialData    = *success ? initialData.data() : nullptr;
+    pipelineCacheCreateInfo.initialDataSize = *success ? initialDataSize : 0;
+    pipelineCacheCreateInfo.pInitialData    = *success ? initialDataPtr : nullptr;
 
-    ANGLE_VK_TRY(context, pipelineCache->init(mDevice, pipelineCacheCreateInfo));
+    VkResult result = pipelineCache->init(mDevice, pipelineCacheCreateInfo);
+    if (mPipelineCacheDiskStore.valid())
+    {
+        mPipelineCacheDiskStore.releaseLoadedData();
+    }
+    ANGLE_VK_TRY(context, result);
 
     return angle::Result::Continue;
 }
 
+bool Renderer::getBlobCacheEntry(const angle::BlobCacheKey &key, angle::MemoryBuffer *dataOut)
+{
+    {
+        std::lock_guard<angle::SimpleMutex> lock(mQueuedBlobCacheEntriesMutex);
+        auto iter = mQueuedBlobCacheEntries.find(key);
+        if (iter != mQueuedBlobCacheEntries.end())
+        {
+            const angle::MemoryBuffer &queued = iter->second;
+            if (!dataOut->resize(queued.size()))
+            {
+                return false;
+            }
+            memcpy(dataOut->data(), queued.data(), queued.size());
+            return true;
+        }
+    }
+
+    // The blob cache value returned by |mGlobalOps| lives in a scratch buffer that is shared with
+    // the pipeline cache loads, which are done with |mPipelineCacheMutex| held.
+    std::unique_lock<angle::SimpleMutex> lock(mPipelineCacheMutex);
+
+    angle::BlobCacheValue value;
+    if (!mGlobalOps->getBlob(key, &value) || !dataOut->resize(value.size()))
+    {
+        return false;
+    }
+    memcpy(dataOut->data(), value.data(), value.size());
+    return true;
+}
+
+void Renderer::queueBlobCacheEntry(const angle::BlobCacheKey &key, angle::MemoryBuffer &&data)
+{
+    std::lock_guard<angle::SimpleMutex> lock(mQueuedBlobCacheEntriesMutex);
+    mQueuedBlobCacheEntries[key] = std::move(data);
+}
+
+void Renderer::flushQueuedBlobCacheEntries(vk::GlobalOps *globalOps)
+{
+    std::map<angle::BlobCacheKey, angle::MemoryBuffer> entries;
+    {
+        std::lock_guard<angle::SimpleMutex> lock(mQueuedBlobCacheEntriesMutex);
+        entries.swap(mQueuedBlobCacheEntries);
+    }
+
+    for (const auto &entry : entries)
+    {
+        globalOps->putBlob(entry.first, entry.second);
+    }
+}
+
 angle::Result Renderer::ensurePipelineCacheInitialized(vk::Context *context)
 {
     // If it is initialized already, there is nothing to do
@@ -5889,6 +6140,9 @@ angle::Result Renderer::syncPipelineCacheVk(vk::Context *context,
                                             vk::GlobalOps *globalOps,
                                             const gl::Context *contextGL)
 {
+    // The queued blob cache entries are small, so they are written out at every sync.
+    flushQueuedBlobCacheEntries(globalOps);
+
     // Skip syncing until pipeline cache is initialized.
     if (!mPipelineCacheInitialized)
     {
@@ -5896,7 +6150,11 @@ angle::Result Renderer::syncPipelineCacheVk(vk::Context *context,
     }
     ASSERT(mPipelineCache.valid());
 
-    if (!mFeatures.syncMonolithicPipelinesToBlobCache.enabled)
+    // Syncing to the disk store is cheap enough to do whenever the driver serializes the pipeline
+    // cache effectively.
+    const bool syncToDiskStore = mPipelineCacheDiskStore.valid() &&
+                                 mFeatures.hasEffectivePipelineCacheSerialization.enabled;
+    if (!mFeatures.syncMonolithicPipelinesToBlobCache.enabled && !syncToDiskStore)
     {
         return angle::Result::Continue;
     }
@@ -5932,6 +6190,23 @@ angle::Result Renderer::syncPipelineCacheVk(vk::Context *context,
     }
     mPipelineCacheSizeAtLastSync = pipelineCacheSize;
 
+    if (mPipelineCacheDiskStore.valid())
+    {
+        // Only the data added since the last sync is normally written out, uncompressed, so the
+        // blob cache size limits don't apply.
+        if (mFeatures.enableAsyncPipelineCacheCompression.enabled)
+        {
+            mCompressEvent = contextGL->getWorkerThreadPool()->postWorkerTask(
+                std::make_shared<StorePipelineCacheToDiskTask>(&mPipelineCacheDiskStore,
+                                                               std::move(pipelineCacheData)));
+        }
+        else
+        {
+            mPipelineCacheDiskStore.store(pipelineCacheData);
+        }
+        return angle::Result::Continue;
+    }
+
     if (mFeatures.enableAsyncPipelineCacheCompression.enabled)
     {
         // zlib compression ratio normally ranges from 2:1 to 5:1. Set kMaxTotalSize to 64M to
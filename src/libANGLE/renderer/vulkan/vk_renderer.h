@@ -12,6 +12,7 @@
 
 #include <condition_variable>
 #include <deque>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <queue>
@@ -33,6 +34,7 @@
 #include "libANGLE/renderer/vulkan/vk_helpers.h"
 #include "libANGLE/renderer/vulkan/vk_internal_shaders_autogen.h"
 #include "libANGLE/renderer/vulkan/vk_mem_alloc_wrapper.h"
+#include "libANGLE/renderer/vulkan/vk_pipeline_cache_store.h"
 #include "libANGLE/renderer/vulkan/vk_resource.h"
 
 namespace angle
@@ -202,6 +204,13 @@ class Renderer : angle::NonCopyable
     {
         return mHostImageCopyProperties;
     }
+    const VkPhysicalDeviceDescriptorBufferPropertiesEXT &
+    getPhysicalDeviceDescriptorBufferProperties() const
+    {
+        return mDescriptorBufferProperties;
+    }
+    uint32_t getMaxPushDescriptors() const { return mPushDescriptorProperties.maxPushDescriptors; }
+    uint32_t getMaxMultiDrawCount() const { return mMultiDrawProperties.maxMultiDrawCount; }
     const VkPhysicalDeviceFeatures &getPhysicalDeviceFeatures() const
     {
         return mPhysicalDeviceFeatures;
@@ -287,6 +296,15 @@ class Renderer : angle::NonCopyable
     {
         return mFeatures.asyncCommandBufferResetAndGarbageCleanup.enabled;
     }
+    bool useDescriptorBuffer() const
+    {
+        return mFeatures.supportsDescriptorBuffer.enabled && mFeatures.useDescriptorBuffer.enabled;
+    }
+    bool usePushDescriptorsForDefaultUniforms() const
+    {
+        return mFeatures.supportsPushDescriptor.enabled &&
+               mFeatures.usePushDescriptorsForDefaultUniforms.enabled && !useDescriptorBuffer();
+    }
 
     ANGLE_INLINE egl::ContextPriority getDriverPriority(egl::ContextPriority priority)
     {
@@ -424,12 +442,20 @@ class Renderer : angle::NonCopyable
     void resetCommandQueuePerFrameCounters() { mCommandQueue.resetPerFramePerfCounters(); }
 
     vk::GlobalOps *getGlobalOps() const { return mGlobalOps; }
+    // Reads an entry of the blob cache into |dataOut|.  Unlike getGlobalOps()->getBlob(), this is
+    // safe to call from any thread.  Entries that are queued with queueBlobCacheEntry() are found
+    // too.
+    bool getBlobCacheEntry(const angle::BlobCacheKey &key, angle::MemoryBuffer *dataOut);
+    // Queues an entry to be put in the blob cache with the next pipeline cache sync, so that it is
+    // not written on the draw path.  A later entry with the same key replaces the queued one.
+    void queueBlobCacheEntry(const angle::BlobCacheKey &key, angle::MemoryBuffer &&data);
 
     bool enableDebugUtils() const { return mEnableDebugUtils; }
     bool angleDebuggerMode() const { return mAngleDebuggerMode; }
 
     SamplerCache &getSamplerCache() { return mSamplerCache; }
     SamplerYcbcrConversionCache &getYuvConversionCache() { return mYuvConversionCache; }
+    TransformedSpirvCache &getTransformedSpirvCache() { return mTransformedSpirvCache; }
 
     void onAllocateHandle(vk::HandleType handleType);
     void onDeallocateHandle(vk::HandleType handleType);
@@ -834,6 +860,7 @@ class Renderer : angle::NonCopyable
                                     vk::PipelineCache *pipelineCache,
                                     bool *success);
     angle::Result ensurePipelineCacheInitialized(vk::Context *context);
+    void flushQueuedBlobCacheEntries(vk::GlobalOps *globalOps);
 
     template <VkFormatFeatureFlags VkFormatProperties::*features>
     VkFormatFeatureFlags getFormatFeatureBits(angle::FormatID formatID,
@@ -962,6 +989,12 @@ class Renderer : angle::NonCopyable
     VkPhysicalDeviceHostImageCopyPropertiesEXT mHostImageCopyProperties;
     std::vector<VkImageLayout> mHostImageCopySrcLayoutsStorage;
     std::vector<VkImageLayout> mHostImageCopyDstLayoutsStorage;
+    VkPhysicalDeviceDescriptorBufferFeaturesEXT mDescriptorBufferFeatures;
+    VkPhysicalDeviceDescriptorBufferPropertiesEXT mDescriptorBufferProperties;
+    VkPhysicalDevicePushDescriptorPropertiesKHR mPushDescriptorProperties;
+    VkPhysicalDeviceMultiDrawFeaturesEXT mMultiDrawFeatures;
+    VkPhysicalDeviceMultiDrawPropertiesEXT mMultiDrawProperties;
+    VkPhysicalDeviceBufferDeviceAddressFeaturesKHR mBufferDeviceAddressFeatures;
 #if defined(ANGLE_PLATFORM_ANDROID)
     VkPhysicalDeviceExternalFormatResolveFeaturesANDROID mExternalFormatResolveFeatures;
     VkPhysicalDeviceExternalFormatResolvePropertiesANDROID mExternalFormatResolveProperties;
@@ -1033,6 +1066,15 @@ class Renderer : angle::NonCopyable
     size_t mPipelineCacheSizeAtLastSync;
     std::atomic<bool> mPipelineCacheInitialized;
 
+    // File-backed copy of mPipelineCache, used instead of the blob cache when
+    // usePipelineCacheDiskStore is enabled.
+    std::string mPipelineCacheDiskStoreDirectory;
+    vk::PipelineCacheDiskStore mPipelineCacheDiskStore;
+
+    // Blob cache entries waiting for the next pipeline cache sync, see queueBlobCacheEntry().
+    angle::SimpleMutex mQueuedBlobCacheEntriesMutex;
+    std::map<angle::BlobCacheKey, angle::MemoryBuffer> mQueuedBlobCacheEntries;
+
     // Latest validation data for debug overlay.
     std::string mLastValidationMessage;
     uint32_t mValidationMessageCount;
@@ -1069,6 +1111,7 @@ class Renderer : angle::NonCopyable
 
     SamplerCache mSamplerCache;
     SamplerYcbcrConversionCache mYuvConversionCache;
+    TransformedSpirvCache mTransformedSpirvCache;
     angle::HashMap<VkFormat, uint32_t> mVkFormatDescriptorCountMap;
     vk::ActiveHandleCounter mActiveHandleCounts;
     angle::SimpleMutex mActiveHandleCountsMutex;
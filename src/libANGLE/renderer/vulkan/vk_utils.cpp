@@ -562,6 +562,16 @@ VkResult AllocateBufferMemory(Context *context,
                               DeviceMemory *deviceMemoryOut,
                               VkDeviceSize *sizeOut)
 {
+    // With VK_EXT_descriptor_buffer, buffer descriptors are written from device addresses, so
+    // the backing memory must be allocated with the device address bit.
+    VkMemoryAllocateFlagsInfo allocateFlagsInfo = {};
+    if (extraAllocationInfo == nullptr && context->getRenderer()->useDescriptorBuffer())
+    {
+        allocateFlagsInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO;
+        allocateFlagsInfo.flags = VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT;
+        extraAllocationInfo     = &allocateFlagsInfo;
+    }
+
     return AllocateBufferOrImageMemory(context, memoryAllocationType, requestedMemoryPropertyFlags,
                                        memoryPropertyFlagsOut, extraAllocationInfo, buffer,
                                        memoryTypeIndexOut, deviceMemoryOut, sizeOut);
@@ -615,6 +625,16 @@ VkResult AllocateBufferMemoryWithRequirements(Context *context,
                                               memoryTypeIndexOut, deviceMemoryOut);
 }
 
+VkDeviceAddress GetBufferDeviceAddress(VkDevice device, VkBuffer buffer)
+{
+    ASSERT(buffer != VK_NULL_HANDLE);
+
+    VkBufferDeviceAddressInfo addressInfo = {};
+    addressInfo.sType                     = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO;
+    addressInfo.buffer                    = buffer;
+    return vkGetBufferDeviceAddressKHR(device, &addressInfo);
+}
+
 angle::Result InitShaderModule(Context *context,
                                ShaderModule *shaderModule,
                                const uint32_t *shaderCode,
@@ -726,6 +746,10 @@ void GarbageObject::destroy(Renderer *renderer)
         case HandleType::DescriptorSetLayout:
             vkDestroyDescriptorSetLayout(device, (VkDescriptorSetLayout)mHandle, nullptr);
             break;
+        case HandleType::DescriptorUpdateTemplate:
+            vkDestroyDescriptorUpdateTemplate(device, (VkDescriptorUpdateTemplate)mHandle,
+                                              nullptr);
+            break;
         case HandleType::Sampler:
             vkDestroySampler(device, (VkSampler)mHandle, nullptr);
             break;
@@ -1031,6 +1055,28 @@ PFN_vkTransitionImageLayoutEXT vkTransitionImageLayoutEXT           = nullptr;
 // VK_KHR_Synchronization2
 PFN_vkCmdPipelineBarrier2KHR vkCmdPipelineBarrier2KHR = nullptr;
 PFN_vkCmdWriteTimestamp2KHR vkCmdWriteTimestamp2KHR   = nullptr;
+PFN_vkQueueSubmit2KHR vkQueueSubmit2KHR               = nullptr;
+
+// VK_KHR_timeline_semaphore
+PFN_vkGetSemaphoreCounterValueKHR vkGetSemaphoreCounterValueKHR = nullptr;
+PFN_vkWaitSemaphoresKHR vkWaitSemaphoresKHR                     = nullptr;
+
+// VK_KHR_buffer_device_address
+PFN_vkGetBufferDeviceAddressKHR vkGetBufferDeviceAddressKHR = nullptr;
+
+// VK_EXT_descriptor_buffer
+PFN_vkGetDescriptorSetLayoutSizeEXT vkGetDescriptorSetLayoutSizeEXT                   = nullptr;
+PFN_vkGetDescriptorSetLayoutBindingOffsetEXT vkGetDescriptorSetLayoutBindingOffsetEXT = nullptr;
+PFN_vkGetDescriptorEXT vkGetDescriptorEXT                                             = nullptr;
+PFN_vkCmdBindDescriptorBuffersEXT vkCmdBindDescriptorBuffersEXT                       = nullptr;
+PFN_vkCmdSetDescriptorBufferOffsetsEXT vkCmdSetDescriptorBufferOffsetsEXT             = nullptr;
+
+// VK_KHR_push_descriptor
+PFN_vkCmdPushDescriptorSetKHR vkCmdPushDescriptorSetKHR = nullptr;
+
+// VK_EXT_multi_draw
+PFN_vkCmdDrawMultiEXT vkCmdDrawMultiEXT               = nullptr;
+PFN_vkCmdDrawMultiIndexedEXT vkCmdDrawMultiIndexedEXT = nullptr;
 
 void InitDebugUtilsEXTFunctions(VkInstance instance)
 {
@@ -1181,6 +1227,43 @@ void InitSynchronization2Functions(VkDevice device)
 {
     GET_DEVICE_FUNC(vkCmdPipelineBarrier2KHR);
     GET_DEVICE_FUNC(vkCmdWriteTimestamp2KHR);
+    GET_DEVICE_FUNC(vkQueueSubmit2KHR);
+}
+
+// VK_KHR_timeline_semaphore
+void InitTimelineSemaphoreFunctions(VkDevice device)
+{
+    GET_DEVICE_FUNC(vkGetSemaphoreCounterValueKHR);
+    GET_DEVICE_FUNC(vkWaitSemaphoresKHR);
+}
+
+// VK_KHR_buffer_device_address
+void InitBufferDeviceAddressFunctions(VkDevice device)
+{
+    GET_DEVICE_FUNC(vkGetBufferDeviceAddressKHR);
+}
+
+// VK_EXT_descriptor_buffer
+void InitDescriptorBufferFunctions(VkDevice device)
+{
+    GET_DEVICE_FUNC(vkGetDescriptorSetLayoutSizeEXT);
+    GET_DEVICE_FUNC(vkGetDescriptorSetLayoutBindingOffsetEXT);
+    GET_DEVICE_FUNC(vkGetDescriptorEXT);
+    GET_DEVICE_FUNC(vkCmdBindDescriptorBuffersEXT);
+    GET_DEVICE_FUNC(vkCmdSetDescriptorBufferOffsetsEXT);
+}
+
+// VK_KHR_push_descriptor
+void InitPushDescriptorFunctions(VkDevice device)
+{
+    GET_DEVICE_FUNC(vkCmdPushDescriptorSetKHR);
+}
+
+// VK_EXT_multi_draw
+void InitMultiDrawFunctions(VkDevice device)
+{
+    GET_DEVICE_FUNC(vkCmdDrawMultiEXT);
+    GET_DEVICE_FUNC(vkCmdDrawMultiIndexedEXT);
 }
 
 #    undef GET_INSTANCE_FUNC
@@ -619,6 +619,9 @@ VkResult AllocateBufferMemoryWithRequirements(Context *context,
                                               uint32_t *memoryTypeIndexOut,
                                               DeviceMemory *deviceMemoryOut);
 
+// Requires VK_KHR_buffer_device_address; only used with VK_EXT_descriptor_buffer.
+VkDeviceAddress GetBufferDeviceAddress(VkDevice device, VkBuffer buffer);
+
 angle::Result InitShaderModule(Context *context,
                                ShaderModule *shaderModule,
                                const uint32_t *shaderCode,
@@ -1254,6 +1257,21 @@ void InitHostImageCopyFunctions(VkDevice device);
 // VK_KHR_Synchronization2
 void InitSynchronization2Functions(VkDevice device);
 
+// VK_KHR_timeline_semaphore
+void InitTimelineSemaphoreFunctions(VkDevice device);
+
+// VK_KHR_buffer_device_address
+void InitBufferDeviceAddressFunctions(VkDevice device);
+
+// VK_EXT_descriptor_buffer
+void InitDescriptorBufferFunctions(VkDevice device);
+
+// VK_KHR_push_descriptor
+void InitPushDescriptorFunctions(VkDevice device);
+
+// VK_EXT_multi_draw
+void InitMultiDrawFunctions(VkDevice device);
+
 #endif  // !defined(ANGLE_SHARED_LIBVULKAN)
 
 // Promoted to Vulkan 1.1
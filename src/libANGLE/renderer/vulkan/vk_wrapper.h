@@ -39,6 +39,7 @@ namespace vk
     FUNC(CommandPool)              \
     FUNC(DescriptorPool)           \
     FUNC(DescriptorSetLayout)      \
+    FUNC(DescriptorUpdateTemplate) \
     FUNC(DeviceMemory)             \
     FUNC(Event)                    \
     FUNC(Fence)                    \
@@ -197,6 +198,7 @@ class CommandBuffer : public WrappedObject<CommandBuffer, VkCommandBuffer>
     void beginRenderPass(const VkRenderPassBeginInfo &beginInfo, VkSubpassContents subpassContents);
     void beginRendering(const VkRenderingInfo &beginInfo);
 
+    void bindDescriptorBuffers(VkDeviceAddress address, VkBufferUsageFlags usage);
     void bindDescriptorSets(const PipelineLayout &layout,
                             VkPipelineBindPoint pipelineBindPoint,
                             DescriptorSetIndex firstSet,
@@ -286,6 +288,14 @@ class CommandBuffer : public WrappedObject<CommandBuffer, VkCommandBuffer>
                       VkDeviceSize offset,
                       uint32_t drawCount,
                       uint32_t stride);
+    void drawMulti(uint32_t drawCount,
+                   const VkMultiDrawInfoEXT *vertexInfo,
+                   uint32_t instanceCount,
+                   uint32_t firstInstance);
+    void drawMultiIndexed(uint32_t drawCount,
+                          const VkMultiDrawIndexedInfoEXT *indexInfo,
+                          uint32_t instanceCount,
+                          uint32_t firstInstance);
 
     VkResult end();
     void endQuery(const QueryPool &queryPool, uint32_t query);
@@ -342,6 +352,11 @@ class CommandBuffer : public WrappedObject<CommandBuffer, VkCommandBuffer>
                        uint32_t offset,
                        uint32_t size,
                        const void *data);
+    void pushDescriptorSet(const PipelineLayout &layout,
+                           VkPipelineBindPoint pipelineBindPoint,
+                           DescriptorSetIndex set,
+                           uint32_t writeCount,
+                           const VkWriteDescriptorSet *writes);
 
     void setBlendConstants(const float blendConstants[4]);
     void setCullMode(VkCullModeFlags cullMode);
@@ -352,6 +367,12 @@ class CommandBuffer : public WrappedObject<CommandBuffer, VkCommandBuffer>
     void setDepthCompareOp(VkCompareOp depthCompareOp);
     void setDepthTestEnable(VkBool32 depthTestEnable);
     void setDepthWriteEnable(VkBool32 depthWriteEnable);
+    void setDescriptorBufferOffsets(const PipelineLayout &layout,
+                                    VkPipelineBindPoint pipelineBindPoint,
+                                    DescriptorSetIndex firstSet,
+                                    uint32_t setCount,
+                                    const uint32_t *bufferIndices,
+                                    const VkDeviceSize *offsets);
     void setEvent(VkEvent event, VkPipelineStageFlags stageMask);
     void setFragmentShadingRate(const VkExtent2D *fragmentSize,
                                 VkFragmentShadingRateCombinerOpKHR ops[2]);
@@ -475,6 +496,7 @@ class Semaphore final : public WrappedObject<Semaphore, VkSemaphore>
     void destroy(VkDevice device);
 
     VkResult init(VkDevice device);
+    VkResult init(VkDevice device, const VkSemaphoreCreateInfo &createInfo);
     VkResult importFd(VkDevice device, const VkImportSemaphoreFdInfoKHR &importFdInfo) const;
 };
 
@@ -633,6 +655,18 @@ class DescriptorSetLayout final : public WrappedObject<DescriptorSetLayout, VkDe
     VkResult init(VkDevice device, const VkDescriptorSetLayoutCreateInfo &createInfo);
 };
 
+class DescriptorUpdateTemplate final
+    : public WrappedObject<DescriptorUpdateTemplate, VkDescriptorUpdateTemplate>
+{
+  public:
+    DescriptorUpdateTemplate() = default;
+    void destroy(VkDevice device);
+
+    VkResult init(VkDevice device, const VkDescriptorUpdateTemplateCreateInfo &createInfo);
+
+    void updateDescriptorSet(VkDevice device, VkDescriptorSet descriptorSet, const void *data) const;
+};
+
 class DescriptorPool final : public WrappedObject<DescriptorPool, VkDescriptorPool>
 {
   public:
@@ -1034,6 +1068,17 @@ ANGLE_INLINE void CommandBuffer::bindIndexBuffer(const Buffer &buffer,
     vkCmdBindIndexBuffer(mHandle, buffer.getHandle(), offset, indexType);
 }
 
+ANGLE_INLINE void CommandBuffer::bindDescriptorBuffers(VkDeviceAddress address,
+                                                       VkBufferUsageFlags usage)
+{
+    ASSERT(valid());
+    VkDescriptorBufferBindingInfoEXT bindingInfo = {};
+    bindingInfo.sType   = VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_INFO_EXT;
+    bindingInfo.address = address;
+    bindingInfo.usage   = usage;
+    vkCmdBindDescriptorBuffersEXT(mHandle, 1, &bindingInfo);
+}
+
 ANGLE_INLINE void CommandBuffer::bindDescriptorSets(const PipelineLayout &layout,
                                                     VkPipelineBindPoint pipelineBindPoint,
                                                     DescriptorSetIndex firstSet,
@@ -1083,6 +1128,17 @@ ANGLE_INLINE void CommandBuffer::pushConstants(const PipelineLayout &layout,
     vkCmdPushConstants(mHandle, layout.getHandle(), flag, 0, size, data);
 }
 
+ANGLE_INLINE void CommandBuffer::pushDescriptorSet(const PipelineLayout &layout,
+                                                   VkPipelineBindPoint pipelineBindPoint,
+                                                   DescriptorSetIndex set,
+                                                   uint32_t writeCount,
+                                                   const VkWriteDescriptorSet *writes)
+{
+    ASSERT(valid() && layout.valid());
+    vkCmdPushDescriptorSetKHR(mHandle, pipelineBindPoint, layout.getHandle(), ToUnderlying(set),
+                              writeCount, writes);
+}
+
 ANGLE_INLINE void CommandBuffer::setBlendConstants(const float blendConstants[4])
 {
     ASSERT(valid());
@@ -1127,6 +1183,18 @@ ANGLE_INLINE void CommandBuffer::setDepthWriteEnable(VkBool32 depthWriteEnable)
     vkCmdSetDepthWriteEnableEXT(mHandle, depthWriteEnable);
 }
 
+ANGLE_INLINE void CommandBuffer::setDescriptorBufferOffsets(const PipelineLayout &layout,
+                                                            VkPipelineBindPoint pipelineBindPoint,
+                                                            DescriptorSetIndex firstSet,
+                                                            uint32_t setCount,
+                                                            const uint32_t *bufferIndices,
+                                                            const VkDeviceSize *offsets)
+{
+    ASSERT(valid() && layout.valid());
+    vkCmdSetDescriptorBufferOffsetsEXT(mHandle, pipelineBindPoint, layout.getHandle(),
+                                       ToUnderlying(firstSet), setCount, bufferIndices, offsets);
+}
+
 ANGLE_INLINE void CommandBuffer::setEvent(VkEvent event, VkPipelineStageFlags stageMask)
 {
     ASSERT(valid() && event != VK_NULL_HANDLE);
@@ -1361,6 +1429,27 @@ ANGLE_INLINE void CommandBuffer::drawIndirect(const Buffer &buffer,
     vkCmdDrawIndirect(mHandle, buffer.getHandle(), offset, drawCount, stride);
 }
 
+ANGLE_INLINE void CommandBuffer::drawMulti(uint32_t drawCount,
+                                           const VkMultiDrawInfoEXT *vertexInfo,
+                                           uint32_t instanceCount,
+                                           uint32_t firstInstance)
+{
+    ASSERT(valid());
+    vkCmdDrawMultiEXT(mHandle, drawCount, vertexInfo, instanceCount, firstInstance,
+                      sizeof(VkMultiDrawInfoEXT));
+}
+
+ANGLE_INLINE void CommandBuffer::drawMultiIndexed(uint32_t drawCount,
+                                                  const VkMultiDrawIndexedInfoEXT *indexInfo,
+                                                  uint32_t instanceCount,
+                                                  uint32_t firstInstance)
+{
+    ASSERT(valid());
+    // The vertex offset is taken from each VkMultiDrawIndexedInfoEXT.
+    vkCmdDrawMultiIndexedEXT(mHandle, drawCount, indexInfo, instanceCount, firstInstance,
+                             sizeof(VkMultiDrawIndexedInfoEXT), nullptr);
+}
+
 ANGLE_INLINE void CommandBuffer::dispatch(uint32_t groupCountX,
                                           uint32_t groupCountY,
                                           uint32_t groupCountZ)
@@ -1574,6 +1663,12 @@ ANGLE_INLINE VkResult Semaphore::init(VkDevice device)
     return vkCreateSemaphore(device, &semaphoreInfo, nullptr, &mHandle);
 }
 
+ANGLE_INLINE VkResult Semaphore::init(VkDevice device, const VkSemaphoreCreateInfo &createInfo)
+{
+    ASSERT(!valid());
+    return vkCreateSemaphore(device, &createInfo, nullptr, &mHandle);
+}
+
 ANGLE_INLINE VkResult Semaphore::importFd(VkDevice device,
                                           const VkImportSemaphoreFdInfoKHR &importFdInfo) const
 {
@@ -1941,6 +2036,32 @@ ANGLE_INLINE VkResult DescriptorSetLayout::init(VkDevice device,
     return vkCreateDescriptorSetLayout(device, &createInfo, nullptr, &mHandle);
 }
 
+// DescriptorUpdateTemplate implementation.
+ANGLE_INLINE void DescriptorUpdateTemplate::destroy(VkDevice device)
+{
+    if (valid())
+    {
+        vkDestroyDescriptorUpdateTemplate(device, mHandle, nullptr);
+        mHandle = VK_NULL_HANDLE;
+    }
+}
+
+ANGLE_INLINE VkResult
+DescriptorUpdateTemplate::init(VkDevice device,
+                               const VkDescriptorUpdateTemplateCreateInfo &createInfo)
+{
+    ASSERT(!valid());
+    return vkCreateDescriptorUpdateTemplate(device, &createInfo, nullptr, &mHandle);
+}
+
+ANGLE_INLINE void DescriptorUpdateTemplate::updateDescriptorSet(VkDevice device,
+                                                                VkDescriptorSet descriptorSet,
+                                                                const void *data) const
+{
+    ASSERT(valid());
+    vkUpdateDescriptorSetWithTemplate(device, descriptorSet, mHandle, data);
+}
+
 // DescriptorPool implementation.
 ANGLE_INLINE void DescriptorPool::destroy(VkDevice device)
 {
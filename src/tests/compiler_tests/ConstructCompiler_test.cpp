@@ -44,3 +44,41 @@ TEST(ConstructCompilerTest, InvalidMaxDualSourceDrawBuffers)
                                               SH_GLSL_COMPATIBILITY_OUTPUT, &resources);
     ASSERT_EQ(nullptr, compiler);
 }
+
+// Test that compilers with the same or different resources see the built-ins of their own
+// resources, regardless of the order they are created and destroyed in.
+TEST(ConstructCompilerTest, ResourceDependentBuiltIns)
+{
+    constexpr char kShader[] =
+        "precision mediump float;\n"
+        "void main()\n"
+        "{\n"
+        "    gl_FragColor = vec4(gl_MaxDrawBuffers);\n"
+        "}\n";
+
+    auto compileWithMaxDrawBuffers = [&](int maxDrawBuffers) {
+        ShBuiltInResources resources;
+        sh::InitBuiltInResources(&resources);
+        resources.MaxDrawBuffers = maxDrawBuffers;
+        ShHandle compiler        = sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES2_SPEC,
+                                                         SH_GLSL_COMPATIBILITY_OUTPUT, &resources);
+        EXPECT_NE(nullptr, compiler);
+
+        ShCompileOptions compileOptions = {};
+        compileOptions.objectCode       = true;
+        const char *shaderStrings[]     = {kShader};
+        EXPECT_TRUE(sh::Compile(compiler, shaderStrings, 1, compileOptions));
+        return compiler;
+    };
+
+    ShHandle compiler4 = compileWithMaxDrawBuffers(4);
+    ShHandle compiler8 = compileWithMaxDrawBuffers(8);
+    EXPECT_NE(std::string::npos, sh::GetObjectCode(compiler4).find("vec4(4.0"));
+    EXPECT_NE(std::string::npos, sh::GetObjectCode(compiler8).find("vec4(8.0"));
+    sh::Destruct(compiler4);
+
+    ShHandle otherCompiler4 = compileWithMaxDrawBuffers(4);
+    EXPECT_NE(std::string::npos, sh::GetObjectCode(otherCompiler4).find("vec4(4.0"));
+    sh::Destruct(otherCompiler4);
+    sh::Destruct(compiler8);
+}
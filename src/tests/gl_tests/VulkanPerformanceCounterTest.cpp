@@ -7537,6 +7537,45 @@ TEST_P(VulkanPerformanceCounterTest, PipelineCacheIsRestoredWithProgramBinaryTwi
     testPipelineCacheIsWarm(&twiceReloadedProgram, GLColor::blue);
 }
 
+class VulkanPerformanceCounterTest_PrecompileRecordedPipelines
+    : public VulkanPerformanceCounterTest
+{};
+
+// Verifies that the pipelines created by draw calls are precompiled when the same program is
+// linked again.
+TEST_P(VulkanPerformanceCounterTest_PrecompileRecordedPipelines,
+       RecordedPipelinesArePrecompiledAtLinkTime)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled(kPerfMonitorExtensionName));
+    ANGLE_SKIP_TEST_IF(!isFeatureEnabled(Feature::PrecompileRecordedGraphicsPipelines) ||
+                       !hasWarmUpPipelineCacheAtLink());
+
+    uint64_t recordedPipelines = 0;
+    {
+        ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::Red());
+
+        // Any pipeline that the draw call needs but the link did not warm up is recorded.
+        const uint64_t missesBefore = getPerfCounters().graphicsPipelinePrecompileMisses;
+        drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+        ASSERT_GL_NO_ERROR();
+        recordedPipelines = getPerfCounters().graphicsPipelinePrecompileMisses - missesBefore;
+    }
+
+    const uint64_t expectedHits =
+        getPerfCounters().graphicsPipelinePrecompileHits + recordedPipelines;
+    const uint64_t expectedMisses = getPerfCounters().graphicsPipelinePrecompileMisses;
+
+    // The recorded pipelines are precompiled after the second link, so the same draw call doesn't
+    // create any new pipeline.
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::Red());
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_EQ(getPerfCounters().graphicsPipelinePrecompileHits, expectedHits);
+    EXPECT_EQ(getPerfCounters().graphicsPipelinePrecompileMisses, expectedMisses);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+}
+
 // Test calling glEGLImageTargetTexture2DOES repeatedly with same arguments will not leak
 // DescriptorSets. This is the same usage pattern surafceflinger is doing with notification shades
 // except with AHB.
@@ -8133,4 +8172,9 @@ ANGLE_INSTANTIATE_TEST(VulkanPerformanceCounterTest_AsyncCQ,
                        ES3_VULKAN(),
                        ES3_VULKAN().enable(Feature::AsyncCommandQueue));
 
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(
+    VulkanPerformanceCounterTest_PrecompileRecordedPipelines);
+ANGLE_INSTANTIATE_TEST(VulkanPerformanceCounterTest_PrecompileRecordedPipelines,
+                       ES3_VULKAN().enable(Feature::PrecompileRecordedGraphicsPipelines));
+
 }  // anonymous namespace
@@ -63,9 +63,10 @@ struct TraceCategory
     const char *name;
 };
 
-constexpr TraceCategory gTraceCategories[2] = {
+constexpr TraceCategory gTraceCategories[3] = {
     {1, "gpu.angle"},
     {1, "gpu.angle.gpu"},
+    {1, "gpu.angle.shader_translator"},
 };
 
 void EmptyPlatformMethod(PlatformMethods *, const char *) {}
@@ -1387,6 +1388,11 @@ void ANGLERenderTest::setRobustResourceInit(bool enabled)
     mConfigParams.robustResourceInit = enabled;
 }
 
+void ANGLERenderTest::setNoErrorEnabled(bool enabled)
+{
+    mConfigParams.noError = enabled;
+}
+
 std::vector<TraceEvent> &ANGLERenderTest::getTraceEventBuffer()
 {
     return mTraceEventBuffer;
@@ -23,18 +23,45 @@ using angle::WorkerThreadPool;
 
 struct AstcDecompressorParams
 {
-    AstcDecompressorParams(uint32_t width, uint32_t height) : width(width), height(height) {}
+    AstcDecompressorParams(uint32_t width,
+                           uint32_t height,
+                           uint32_t blockSize = 8,
+                           uint32_t workerThreads = 0)
+        : width(width), height(height), blockSize(blockSize), workerThreads(workerThreads)
+    {}
 
     uint32_t width;
     uint32_t height;
+    uint32_t blockSize;
+    // Number of threads of the multi-threaded pool, which the calling thread joins.  0 lets the
+    // pool choose, and 1 makes the decompression single-threaded.
+    uint32_t workerThreads;
 };
 
 std::ostream &operator<<(std::ostream &os, const AstcDecompressorParams &params)
 {
     os << params.width << "x" << params.height;
+    if (params.blockSize != 8)
+    {
+        os << "_block_" << params.blockSize << "x" << params.blockSize;
+    }
+    if (params.workerThreads != 0)
+    {
+        os << "_threads_" << params.workerThreads;
+    }
     return os;
 }
 
+std::vector<uint8_t> MakeInput(const AstcDecompressorParams &params)
+{
+    // The 8x8 checkerboard keeps the results of the existing tests comparable.
+    if (params.blockSize == 8)
+    {
+        return makeAstcCheckerboard(params.width, params.height);
+    }
+    return makeAstcImage(params.width, params.height, params.blockSize, params.blockSize);
+}
+
 class AstcDecompressorPerfTest : public ANGLEPerfTest,
                                  public WithParamInterface<AstcDecompressorParams>
 {
@@ -42,6 +69,7 @@ class AstcDecompressorPerfTest : public ANGLEPerfTest,
     AstcDecompressorPerfTest();
 
     void step() override;
+    void TearDown() override;
 
     std::string getName();
 
@@ -55,16 +83,33 @@ class AstcDecompressorPerfTest : public ANGLEPerfTest,
 AstcDecompressorPerfTest::AstcDecompressorPerfTest()
     : ANGLEPerfTest(getName(), "", "_run", 1, "us"),
       mDecompressor(AstcDecompressor::get()),
-      mInput(makeAstcCheckerboard(GetParam().width, GetParam().height)),
+      mInput(MakeInput(GetParam())),
       mOutput(GetParam().width * GetParam().height * 4),
       mSingleThreadPool(WorkerThreadPool::Create(1, ANGLEPlatformCurrent())),
-      mMultiThreadPool(WorkerThreadPool::Create(0, ANGLEPlatformCurrent()))
-{}
+      mMultiThreadPool(WorkerThreadPool::Create(GetParam().workerThreads, ANGLEPlatformCurrent()))
+{
+    mReporter->RegisterImportantMetric(".decoded_MB_per_second", "MB/s");
+}
 
 void AstcDecompressorPerfTest::step()
 {
-    mDecompressor.decompress(mSingleThreadPool, mMultiThreadPool, GetParam().width,
-                             GetParam().height, 8, 8, mInput.data(), mInput.size(), mOutput.data());
+    const AstcDecompressorParams &params = GetParam();
+    mDecompressor.decompress(mSingleThreadPool, mMultiThreadPool, params.width, params.height, 1,
+                             params.blockSize, params.blockSize, mInput.data(), mInput.size(),
+                             mOutput.data(), params.width * 4, mOutput.size());
+}
+
+void AstcDecompressorPerfTest::TearDown()
+{
+    // Throughput in bytes of RGBA8 output.
+    const double elapsedTime = mTrialTimer.getElapsedWallClockTime();
+    if (elapsedTime > 0)
+    {
+        recordDoubleMetric(".decoded_MB_per_second",
+                           getNumStepsPerformed() * mOutput.size() / elapsedTime / 1e6, "MB/s");
+    }
+
+    ANGLEPerfTest::TearDown();
 }
 
 std::string AstcDecompressorPerfTest::getName()
@@ -87,7 +132,15 @@ INSTANTIATE_TEST_SUITE_P(,
                          AstcDecompressorPerfTest,
                          Values(AstcDecompressorParams(16, 16),
                                 AstcDecompressorParams(256, 256),
-                                AstcDecompressorParams(1024, 1024)),
+                                AstcDecompressorParams(1024, 1024),
+                                AstcDecompressorParams(1024, 1024, 4),
+                                AstcDecompressorParams(1024, 1024, 6),
+                                AstcDecompressorParams(1024, 1024, 10),
+                                AstcDecompressorParams(1024, 1024, 12),
+                                AstcDecompressorParams(2048, 2048, 8, 1),
+                                AstcDecompressorParams(2048, 2048, 8, 2),
+                                AstcDecompressorParams(2048, 2048, 8, 4),
+                                AstcDecompressorParams(2048, 2048, 8, 8)),
                          PrintToStringParamName());
 
 }  // anonymous namespace
@@ -0,0 +1,174 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CallOverheadPerf:
+//   Performance test for the fixed cost of a GL call: fetching the current context, packing the
+//   parameters, validation and dispatch to the context.  The calls do very little work on their
+//   own, and the result is reported per call.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <sstream>
+
+#include "test_utils/gl_raii.h"
+#include "util/shader_utils.h"
+
+namespace angle
+{
+namespace
+{
+constexpr unsigned int kCallsPerStep = 10000;
+
+enum class CallType
+{
+    Uniform4f,
+    BindBuffer,
+};
+
+struct CallOverheadParams final : public RenderTestParams
+{
+    CallOverheadParams()
+    {
+        iterationsPerStep = kCallsPerStep;
+
+        majorVersion = 3;
+        minorVersion = 0;
+        windowWidth  = 64;
+        windowHeight = 64;
+    }
+
+    std::string story() const override;
+
+    CallType callType = CallType::Uniform4f;
+    bool noError      = false;
+};
+
+std::ostream &operator<<(std::ostream &os, const CallOverheadParams &params)
+{
+    os << params.backendAndStory().substr(1);
+    return os;
+}
+
+std::string CallOverheadParams::story() const
+{
+    std::stringstream strstr;
+
+    strstr << RenderTestParams::story();
+    strstr << (callType == CallType::Uniform4f ? "_uniform4f" : "_bind_buffer");
+    if (noError)
+    {
+        strstr << "_no_error";
+    }
+
+    return strstr.str();
+}
+
+class CallOverheadBenchmark : public ANGLERenderTest,
+                              public ::testing::WithParamInterface<CallOverheadParams>
+{
+  public:
+    CallOverheadBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    GLuint mProgram        = 0;
+    GLint mUniformLocation = -1;
+    GLBuffer mBuffers[2];
+};
+
+CallOverheadBenchmark::CallOverheadBenchmark() : ANGLERenderTest("CallOverhead", GetParam())
+{
+    setNoErrorEnabled(GetParam().noError);
+}
+
+void CallOverheadBenchmark::initializeBenchmark()
+{
+    constexpr char kFS[] = R"(precision mediump float;
+uniform vec4 color;
+void main()
+{
+    gl_FragColor = color;
+})";
+
+    mProgram = CompileProgram(essl1_shaders::vs::Simple(), kFS);
+    ASSERT_NE(0u, mProgram);
+    glUseProgram(mProgram);
+
+    mUniformLocation = glGetUniformLocation(mProgram, "color");
+    ASSERT_NE(-1, mUniformLocation);
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void CallOverheadBenchmark::destroyBenchmark()
+{
+    glDeleteProgram(mProgram);
+}
+
+void CallOverheadBenchmark::drawBenchmark()
+{
+    const auto &params = GetParam();
+
+    switch (params.callType)
+    {
+        case CallType::Uniform4f:
+            for (unsigned int call = 0; call < kCallsPerStep; ++call)
+            {
+                const float value = static_cast<float>(call & 0xFF) / 255.0f;
+                glUniform4f(mUniformLocation, value, 0.0f, 1.0f - value, 1.0f);
+            }
+            break;
+
+        case CallType::BindBuffer:
+            for (unsigned int call = 0; call < kCallsPerStep; ++call)
+            {
+                glBindBuffer(GL_ARRAY_BUFFER, mBuffers[call & 1]);
+            }
+            break;
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+CallOverheadParams VulkanParams(CallType callType, bool noError)
+{
+    CallOverheadParams params;
+    params.eglParameters = egl_platform::VULKAN_NULL();
+    params.callType      = callType;
+    params.noError       = noError;
+    return params;
+}
+
+CallOverheadParams OpenGLOrGLESParams(CallType callType, bool noError)
+{
+    CallOverheadParams params;
+    params.eglParameters = egl_platform::OPENGL_OR_GLES_NULL();
+    params.callType      = callType;
+    params.noError       = noError;
+    return params;
+}
+
+// Reports the time per call in ns.  Compare the _no_error stories for the cost of validation.
+TEST_P(CallOverheadBenchmark, Run)
+{
+    run();
+}
+}  // namespace
+
+ANGLE_INSTANTIATE_TEST(CallOverheadBenchmark,
+                       VulkanParams(CallType::Uniform4f, false),
+                       VulkanParams(CallType::Uniform4f, true),
+                       VulkanParams(CallType::BindBuffer, false),
+                       VulkanParams(CallType::BindBuffer, true),
+                       OpenGLOrGLESParams(CallType::Uniform4f, false),
+                       OpenGLOrGLESParams(CallType::Uniform4f, true),
+                       OpenGLOrGLESParams(CallType::BindBuffer, false),
+                       OpenGLOrGLESParams(CallType::BindBuffer, true));
+
+}  // namespace angle
@@ -11,6 +11,8 @@
 
 #include "ANGLEPerfTest.h"
 
+#include <sstream>
+
 #include "GLSLANG/ShaderLang.h"
 #include "compiler/translator/Compiler.h"
 #include "compiler/translator/InitializeGlobals.h"
@@ -162,6 +164,57 @@ void main()
 
 const char *kTrickyESSL300Id = "TrickyESSL300";
 
+// A large shader in the style of generated uber-shaders: many functions, all called from main, with
+// loops, branches and indexing of uniform arrays.
+constexpr int kUberShaderFunctionCount = 200;
+
+const char *GetUberShaderESSL300FragSource()
+{
+    static const std::string source = []() {
+        std::ostringstream stream;
+        stream << R"(#version 300 es
+precision highp float;
+uniform vec4 uLights[16];
+uniform mat4 uTransforms[8];
+uniform sampler2D uTextures[4];
+uniform int uLightCount;
+in vec2 vTexCoord;
+in vec3 vNormal;
+out vec4 outColor;
+)";
+        for (int index = 0; index < kUberShaderFunctionCount; ++index)
+        {
+            stream << "vec4 shade" << index << "(vec3 normal, vec4 color)\n"
+                   << "{\n"
+                   << "    vec4 result = color * " << index + 1 << ".0;\n"
+                   << "    for (int i = 0; i < uLightCount; ++i)\n"
+                   << "    {\n"
+                   << "        float d = max(dot(normal, uLights[i].xyz), 0.0);\n"
+                   << "        result += d > 0.5 ? vec4(d) : uTransforms[i % 8] * color;\n"
+                   << "        if (result.w > " << index << ".0)\n"
+                   << "        {\n"
+                   << "            break;\n"
+                   << "        }\n"
+                   << "    }\n"
+                   << "    return result + texture(uTextures[" << index % 4 << "], vTexCoord);\n"
+                   << "}\n";
+        }
+        stream << "void main()\n"
+               << "{\n"
+               << "    vec4 color = vec4(vNormal, 1.0);\n";
+        for (int index = 0; index < kUberShaderFunctionCount; ++index)
+        {
+            stream << "    color = shade" << index << "(vNormal, color);\n";
+        }
+        stream << "    outColor = color;\n"
+               << "}\n";
+        return stream.str();
+    }();
+    return source.c_str();
+}
+
+const char *kUberShaderESSL300Id = "UberShaderESSL300";
+
 constexpr int kNumIterationsPerStep = 4;
 
 struct CompilerParameters
@@ -222,15 +275,23 @@ struct CompilerPerfParameters final : public CompilerParameters
 {
     CompilerPerfParameters(ShShaderOutput output,
                            const char *shaderSource,
-                           const char *shaderSourceId)
-        : CompilerParameters(output), shaderSource(shaderSource)
+                           const char *shaderSourceId,
+                           bool threadPageCache = true)
+        : CompilerParameters(output), shaderSource(shaderSource), threadPageCache(threadPageCache)
     {
         testId = shaderSourceId;
         testId += "_";
         testId += CompilerParameters::str();
+        if (!threadPageCache)
+        {
+            testId += "_no_page_cache";
+        }
     }
 
     const char *shaderSource;
+    // Whether the pages of the pool allocator are kept by the thread from one compilation to the
+    // next.
+    bool threadPageCache;
     std::string testId;
 };
 
@@ -260,11 +321,16 @@ class CompilerPerfTest : public ANGLEPerfTest,
     ShBuiltInResources mResources;
     angle::PoolAllocator mAllocator;
     sh::TCompiler *mTranslator;
+    size_t mThreadPageCacheLimit;
 };
 
 CompilerPerfTest::CompilerPerfTest()
     : ANGLEPerfTest("CompilerPerf", "", GetParam().testId, kNumIterationsPerStep)
-{}
+{
+    mReporter->RegisterImportantMetric(".peak_pool_bytes", "sizeInBytes");
+    mReporter->RegisterFyiMetric(".pool_pages_allocated", "count");
+    mReporter->RegisterFyiMetric(".pool_pages_reused", "count");
+}
 
 void CompilerPerfTest::SetUp()
 {
@@ -276,6 +342,12 @@ void CompilerPerfTest::SetUp()
 
     const auto &params = GetParam();
 
+    mThreadPageCacheLimit = angle::PoolAllocator::GetThreadPageCacheLimit();
+    if (!params.threadPageCache)
+    {
+        angle::PoolAllocator::SetThreadPageCacheLimit(0);
+    }
+
     mTranslator = sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_WEBGL2_SPEC, params.output);
     sh::InitBuiltInResources(&mResources);
     mResources.FragmentPrecisionHigh = true;
@@ -289,7 +361,17 @@ void CompilerPerfTest::SetUp()
 
 void CompilerPerfTest::TearDown()
 {
+    // Memory used by the pool allocator for the last compilation.
+    if (mTranslator)
+    {
+        const angle::PoolAllocator::Stats &stats = mTranslator->getPoolAllocatorStats();
+        recordIntegerMetric(".peak_pool_bytes", stats.peakBytes, "sizeInBytes");
+        recordIntegerMetric(".pool_pages_allocated", stats.pagesAllocated, "count");
+        recordIntegerMetric(".pool_pages_reused", stats.pagesReused, "count");
+    }
+
     SafeDelete(mTranslator);
+    angle::PoolAllocator::SetThreadPageCacheLimit(mThreadPageCacheLimit);
 
     SetGlobalPoolAllocator(nullptr);
     mAllocator.pop();
@@ -334,15 +416,28 @@ ANGLE_INSTANTIATE_TEST(
     CompilerPerfParameters(SH_HLSL_4_1_OUTPUT, kSimpleESSL300FragSource, kSimpleESSL300Id),
     CompilerPerfParameters(SH_HLSL_4_1_OUTPUT, kRealWorldESSL100FragSource, kRealWorldESSL100Id),
     CompilerPerfParameters(SH_HLSL_4_1_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id),
+    CompilerPerfParameters(SH_HLSL_4_1_OUTPUT,
+                           GetUberShaderESSL300FragSource(),
+                           kUberShaderESSL300Id),
     CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT, kSimpleESSL100FragSource, kSimpleESSL100Id),
     CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT, kSimpleESSL300FragSource, kSimpleESSL300Id),
     CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT,
                            kRealWorldESSL100FragSource,
                            kRealWorldESSL100Id),
     CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id),
+    CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT,
+                           GetUberShaderESSL300FragSource(),
+                           kUberShaderESSL300Id),
     CompilerPerfParameters(SH_ESSL_OUTPUT, kSimpleESSL100FragSource, kSimpleESSL100Id),
     CompilerPerfParameters(SH_ESSL_OUTPUT, kSimpleESSL300FragSource, kSimpleESSL300Id),
     CompilerPerfParameters(SH_ESSL_OUTPUT, kRealWorldESSL100FragSource, kRealWorldESSL100Id),
-    CompilerPerfParameters(SH_ESSL_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id));
+    CompilerPerfParameters(SH_ESSL_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id),
+    CompilerPerfParameters(SH_ESSL_OUTPUT, GetUberShaderESSL300FragSource(), kUberShaderESSL300Id),
+    CompilerPerfParameters(SH_ESSL_OUTPUT, kSimpleESSL100FragSource, kSimpleESSL100Id, false),
+    CompilerPerfParameters(SH_ESSL_OUTPUT,
+                           kRealWorldESSL100FragSource,
+                           kRealWorldESSL100Id,
+                           false),
+    CompilerPerfParameters(SH_ESSL_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id, false));
 
 }  // anonymous namespace
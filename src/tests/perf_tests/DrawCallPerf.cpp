@@ -33,8 +33,9 @@ enum class StateChange
     EnumCount = InvalidEnum,
 };
 
-constexpr size_t kCycleVBOPoolSize  = 200;
-constexpr size_t kManyTexturesCount = 8;
+constexpr size_t kCycleVBOPoolSize    = 200;
+constexpr size_t kManyTexturesCount   = 8;
+constexpr GLsizei kMultiDrawBatchSize = 1000;
 
 struct DrawArraysPerfParams : public DrawCallPerfParams
 {
@@ -43,7 +44,9 @@ struct DrawArraysPerfParams : public DrawCallPerfParams
 
     std::string story() const override;
 
-    StateChange stateChange = StateChange::NoChange;
+    StateChange stateChange  = StateChange::NoChange;
+    bool useDescriptorBuffer = false;
+    bool useMultiDraw        = false;
 };
 
 std::string DrawArraysPerfParams::story() const
@@ -85,6 +88,20 @@ std::string DrawArraysPerfParams::story() const
             break;
     }
 
+    if (useDescriptorBuffer)
+    {
+        strstr << "_descriptor_buffer";
+    }
+
+    if (useMultiDraw)
+    {
+        strstr << "_multi_draw";
+        if (isDisableRequested(Feature::SupportsMultiDraw))
+        {
+            strstr << "_emulated";
+        }
+    }
+
     return strstr.str();
 }
 
@@ -146,6 +163,8 @@ class DrawCallPerfBenchmark : public ANGLERenderTest,
     int mNumTris = GetParam().numTris;
     std::vector<GLuint> mVBOPool;
     size_t mCurrentVBO = 0;
+    std::vector<GLint> mMultiDrawFirsts;
+    std::vector<GLsizei> mMultiDrawCounts;
 };
 
 DrawCallPerfBenchmark::DrawCallPerfBenchmark() : ANGLERenderTest("DrawCallPerf", GetParam())
@@ -164,6 +183,18 @@ void DrawCallPerfBenchmark::initializeBenchmark()
 {
     const auto &params = GetParam();
 
+    if (params.useMultiDraw)
+    {
+        if (!IsGLExtensionEnabled("GL_ANGLE_multi_draw"))
+        {
+            skipTest("missing GL_ANGLE_multi_draw");
+            return;
+        }
+
+        mMultiDrawFirsts.assign(kMultiDrawBatchSize, 0);
+        mMultiDrawCounts.assign(kMultiDrawBatchSize, static_cast<GLsizei>(3 * mNumTris));
+    }
+
     if (params.stateChange == StateChange::Texture)
     {
         mProgram1 = SetupSimpleTextureProgram();
@@ -569,6 +600,19 @@ void UpdateUniformThenDraw(unsigned int iterations, GLsizei numElements)
     }
 }
 
+void MultiDrawBatches(unsigned int iterations,
+                      const std::vector<GLint> &firsts,
+                      const std::vector<GLsizei> &counts)
+{
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    for (unsigned int it = 0; it < iterations; it++)
+    {
+        glMultiDrawArraysANGLE(GL_TRIANGLES, firsts.data(), counts.data(),
+                               static_cast<GLsizei>(firsts.size()));
+    }
+}
+
 void DrawCallPerfBenchmark::drawBenchmark()
 {
     // This workaround fixes a huge queue of graphics commands accumulating on the GL
@@ -599,9 +643,13 @@ void DrawCallPerfBenchmark::drawBenchmark()
             ChangeProgramThenDraw(params.iterationsPerStep, numElements, mProgram1, mProgram2);
             break;
         case StateChange::NoChange:
-            if (eglParams.deviceType != EGL_PLATFORM_ANGLE_DEVICE_TYPE_NULL_ANGLE ||
-                (eglParams.renderer != EGL_PLATFORM_ANGLE_TYPE_OPENGL_ANGLE &&
-                 eglParams.renderer != EGL_PLATFORM_ANGLE_TYPE_OPENGLES_ANGLE))
+            if (params.useMultiDraw)
+            {
+                MultiDrawBatches(params.iterationsPerStep, mMultiDrawFirsts, mMultiDrawCounts);
+            }
+            else if (eglParams.deviceType != EGL_PLATFORM_ANGLE_DEVICE_TYPE_NULL_ANGLE ||
+                     (eglParams.renderer != EGL_PLATFORM_ANGLE_TYPE_OPENGL_ANGLE &&
+                      eglParams.renderer != EGL_PLATFORM_ANGLE_TYPE_OPENGLES_ANGLE))
             {
                 ClearThenDraw(params.iterationsPerStep, numElements);
             }
@@ -654,14 +702,68 @@ DrawArraysPerfParams CombineStateChange(const DrawArraysPerfParams &in, StateCha
     return out;
 }
 
+DrawArraysPerfParams DescriptorBuffer(const DrawArraysPerfParams &in)
+{
+    DrawArraysPerfParams out = in;
+    out.useDescriptorBuffer  = true;
+    out.eglParameters.enable(Feature::UseDescriptorBuffer);
+    return out;
+}
+
+// Each iteration issues a batch of kMultiDrawBatchSize draws, so the iteration count is scaled down
+// to keep the total number of draws comparable with the single-draw tests.
+DrawArraysPerfParams MultiDraw(const DrawArraysPerfParams &in)
+{
+    DrawArraysPerfParams out = in;
+    out.useMultiDraw         = true;
+    out.iterationsPerStep =
+        std::max(1u, in.iterationsPerStep / static_cast<unsigned int>(kMultiDrawBatchSize));
+    return out;
+}
+
+// Same as above, but with VK_EXT_multi_draw disabled so that the batch is split into individual
+// draw calls.
+DrawArraysPerfParams MultiDrawEmulated(const DrawArraysPerfParams &in)
+{
+    DrawArraysPerfParams out = MultiDraw(in);
+    out.eglParameters.disable(Feature::SupportsMultiDraw);
+    return out;
+}
+
 using P = DrawArraysPerfParams;
 
 std::vector<P> gTestsWithStateChange =
     CombineWithValues({P()}, angle::AllEnums<StateChange>(), CombineStateChange);
 std::vector<P> gTestsWithRenderer =
     CombineWithFuncs(gTestsWithStateChange, {D3D11<P>, GL<P>, Metal<P>, Vulkan<P>, WGL<P>});
-std::vector<P> gTestsWithDevice =
-    CombineWithFuncs(gTestsWithRenderer, {Passthrough<P>, Offscreen<P>, NullDevice<P>});
+
+// Descriptor buffers only affect the Vulkan backend, and only the state changes that result in
+// descriptor updates.
+std::vector<P> gDescriptorBufferTestsWithStateChange = CombineWithValues(
+    {P()},
+    {StateChange::NoChange, StateChange::Texture, StateChange::ManyTextureDraw,
+     StateChange::Uniform},
+    CombineStateChange);
+std::vector<P> gDescriptorBufferTestsWithRenderer =
+    CombineWithFuncs(gDescriptorBufferTestsWithStateChange, {Vulkan<P>});
+std::vector<P> gDescriptorBufferTests =
+    CombineWithFuncs(gDescriptorBufferTestsWithRenderer, {DescriptorBuffer});
+
+// Multi-draw batches are lowered to VK_EXT_multi_draw by the Vulkan backend when available.
+std::vector<P> gMultiDrawTestsWithRenderer = {
+    CombineStateChange(Vulkan<P>(P()), StateChange::NoChange)};
+std::vector<P> gMultiDrawTests =
+    CombineWithFuncs(gMultiDrawTestsWithRenderer, {MultiDraw, MultiDrawEmulated});
+
+std::vector<P> CombineAllTests()
+{
+    std::vector<P> tests = gTestsWithRenderer;
+    tests.insert(tests.end(), gDescriptorBufferTests.begin(), gDescriptorBufferTests.end());
+    tests.insert(tests.end(), gMultiDrawTests.begin(), gMultiDrawTests.end());
+    return CombineWithFuncs(tests, {Passthrough<P>, Offscreen<P>, NullDevice<P>});
+}
+
+std::vector<P> gTestsWithDevice = CombineAllTests();
 
 ANGLE_INSTANTIATE_TEST_ARRAY(DrawCallPerfBenchmark, gTestsWithDevice);
 
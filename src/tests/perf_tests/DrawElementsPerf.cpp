@@ -15,6 +15,19 @@
 
 namespace
 {
+// Number of index ranges drawn from in the IndexUpdate::SubRanges mode.
+constexpr GLsizei kSubRangeCount = 8;
+
+enum class IndexUpdate
+{
+    // The index buffer is never updated.
+    None,
+    // The whole index buffer is updated before every draw.
+    WholeBuffer,
+    // One of several ranges of the index buffer is updated before drawing from all of them.  The
+    // vertex data comes from client memory, so every draw needs the range of its indices.
+    SubRanges,
+};
 
 GLuint CreateElementArrayBuffer(size_t count, GLenum type, GLenum usage)
 {
@@ -41,10 +54,14 @@ struct DrawElementsPerfParams final : public DrawCallPerfParams
 
         strstr << DrawCallPerfParams::story();
 
-        if (indexBufferChanged)
+        if (indexUpdate == IndexUpdate::WholeBuffer)
         {
             strstr << "_index_buffer_changed";
         }
+        else if (indexUpdate == IndexUpdate::SubRanges)
+        {
+            strstr << "_index_sub_ranges_changed";
+        }
 
         if (type == GL_UNSIGNED_SHORT)
         {
@@ -55,7 +72,7 @@ struct DrawElementsPerfParams final : public DrawCallPerfParams
     }
 
     GLenum type             = GL_UNSIGNED_INT;
-    bool indexBufferChanged = false;
+    IndexUpdate indexUpdate = IndexUpdate::None;
 };
 
 std::ostream &operator<<(std::ostream &os, const DrawElementsPerfParams &params)
@@ -84,6 +101,7 @@ class DrawElementsPerfBenchmark : public ANGLERenderTest,
     int mCount          = 3 * GetParam().numTris;
     std::vector<GLuint> mIntIndexData;
     std::vector<GLushort> mShortIndexData;
+    std::vector<GLfloat> mClientVertexData;
 };
 
 DrawElementsPerfBenchmark::DrawElementsPerfBenchmark()
@@ -120,7 +138,9 @@ void DrawElementsPerfBenchmark::initializeBenchmark()
     glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
 
     mBuffer      = Create2DTriangleBuffer(params.numTris, GL_STATIC_DRAW);
-    mIndexBuffer = CreateElementArrayBuffer(mCount, params.type, GL_STATIC_DRAW);
+    mIndexBuffer = CreateElementArrayBuffer(
+        params.indexUpdate == IndexUpdate::SubRanges ? mCount * kSubRangeCount : mCount,
+        params.type, GL_STATIC_DRAW);
 
     for (int i = 0; i < mCount; i++)
     {
@@ -133,16 +153,35 @@ void DrawElementsPerfBenchmark::initializeBenchmark()
 
     mBufferSize = ElementTypeSize(params.type) * mCount;
 
-    if (params.type == GL_UNSIGNED_INT)
+    const GLsizei rangeCount = params.indexUpdate == IndexUpdate::SubRanges ? kSubRangeCount : 1;
+    for (GLsizei range = 0; range < rangeCount; ++range)
+    {
+        if (params.type == GL_UNSIGNED_INT)
+        {
+            glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, range * mBufferSize, mBufferSize,
+                            mIntIndexData.data());
+        }
+        else
+        {
+            glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, range * mBufferSize, mBufferSize,
+                            mShortIndexData.data());
+        }
+    }
+
+    if (params.indexUpdate == IndexUpdate::SubRanges)
     {
-        glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, mBufferSize, mIntIndexData.data());
+        for (int i = 0; i < mCount * 2; i++)
+        {
+            mClientVertexData.push_back(static_cast<GLfloat>(rand() % 200 - 100) / 100.0f);
+        }
+
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, mClientVertexData.data());
     }
     else
     {
-        glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, mBufferSize, mShortIndexData.data());
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, 0);
     }
-
-    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, 0);
     glEnableVertexAttribArray(0);
 
     // Set the viewport
@@ -180,17 +219,34 @@ void DrawElementsPerfBenchmark::drawBenchmark()
 
     const DrawElementsPerfParams &params = GetParam();
 
-    if (params.indexBufferChanged)
+    const void *bufferData = (params.type == GL_UNSIGNED_INT)
+                                 ? static_cast<GLvoid *>(mIntIndexData.data())
+                                 : static_cast<GLvoid *>(mShortIndexData.data());
+
+    if (params.indexUpdate == IndexUpdate::WholeBuffer)
     {
-        const void *bufferData = (params.type == GL_UNSIGNED_INT)
-                                     ? static_cast<GLvoid *>(mIntIndexData.data())
-                                     : static_cast<GLvoid *>(mShortIndexData.data());
         for (unsigned int it = 0; it < params.iterationsPerStep; it++)
         {
             glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, mBufferSize, bufferData);
             glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(mCount), params.type, 0);
         }
     }
+    else if (params.indexUpdate == IndexUpdate::SubRanges)
+    {
+        for (unsigned int it = 0; it < params.iterationsPerStep; it++)
+        {
+            const GLsizei updatedRange = it % kSubRangeCount;
+            glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, updatedRange * mBufferSize, mBufferSize,
+                            bufferData);
+
+            for (GLsizei range = 0; range < kSubRangeCount; ++range)
+            {
+                glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(mCount), params.type,
+                               reinterpret_cast<const void *>(
+                                   static_cast<uintptr_t>(range * mBufferSize)));
+            }
+        }
+    }
     else
     {
         for (unsigned int it = 0; it < params.iterationsPerStep; it++)
@@ -218,13 +274,13 @@ P CombineIndexType(const P &in, GLenum indexType)
     return out;
 }
 
-P CombineIndexBufferChanged(const P &in, bool indexBufferChanged)
+P CombineIndexUpdate(const P &in, IndexUpdate indexUpdate)
 {
-    P out                  = in;
-    out.indexBufferChanged = indexBufferChanged;
+    P out           = in;
+    out.indexUpdate = indexUpdate;
 
     // Scale down iterations for slower tests.
-    if (indexBufferChanged)
+    if (indexUpdate != IndexUpdate::None)
         out.iterationsPerStep /= 100;
 
     return out;
@@ -235,7 +291,9 @@ std::vector<P> gWithIndexType   = CombineWithValues({P()}, gIndexTypes, CombineI
 std::vector<P> gWithRenderer =
     CombineWithFuncs(gWithIndexType, {D3D11<P>, GL<P>, Metal<P>, Vulkan<P>, WGL<P>});
 std::vector<P> gWithChange =
-    CombineWithValues(gWithRenderer, {false, true}, CombineIndexBufferChanged);
+    CombineWithValues(gWithRenderer,
+                      {IndexUpdate::None, IndexUpdate::WholeBuffer, IndexUpdate::SubRanges},
+                      CombineIndexUpdate);
 std::vector<P> gWithDevice = CombineWithFuncs(gWithChange, {Passthrough<P>, NullDevice<P>});
 
 ANGLE_INSTANTIATE_TEST_ARRAY(DrawElementsPerfBenchmark, gWithDevice);
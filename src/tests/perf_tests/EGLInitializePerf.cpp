@@ -5,13 +5,17 @@
 //
 // EGLInitializePerfTest:
 //   Performance test for device creation.
+// EGLCreateContextPerfTest:
+//   Performance test for context creation, up to its first shader compilation.
 //
 
 #include "ANGLEPerfTest.h"
+#include "common/system_utils.h"
 #include "platform/PlatformMethods.h"
 #include "test_utils/angle_test_configs.h"
 #include "test_utils/angle_test_instantiate.h"
 #include "util/Timer.h"
+#include "util/shader_utils.h"
 
 using namespace testing;
 
@@ -162,4 +166,163 @@ ANGLE_INSTANTIATE_TEST(EGLInitializePerfTest,
                        angle::ES2_METAL(),
                        angle::ES2_VULKAN());
 
+class EGLCreateContextPerfTest : public ANGLEPerfTest,
+                                 public WithParamInterface<angle::PlatformParameters>
+{
+  public:
+    EGLCreateContextPerfTest();
+    ~EGLCreateContextPerfTest();
+
+    void step() override;
+    void SetUp() override;
+    void TearDown() override;
+
+  private:
+    OSWindow *mOSWindow;
+    EGLDisplay mDisplay;
+    EGLConfig mConfig;
+    EGLSurface mSurface;
+    std::unique_ptr<angle::Library> mEGLLibrary;
+    uint32_t mStepIndex;
+};
+
+EGLCreateContextPerfTest::EGLCreateContextPerfTest()
+    : ANGLEPerfTest("EGLCreateContext", "", "_run", 1),
+      mOSWindow(nullptr),
+      mDisplay(EGL_NO_DISPLAY),
+      mConfig(nullptr),
+      mSurface(EGL_NO_SURFACE),
+      mStepIndex(0)
+{
+    auto platform = GetParam().eglParameters;
+
+    std::vector<EGLint> displayAttributes;
+    displayAttributes.push_back(EGL_PLATFORM_ANGLE_TYPE_ANGLE);
+    displayAttributes.push_back(platform.renderer);
+    displayAttributes.push_back(EGL_PLATFORM_ANGLE_MAX_VERSION_MAJOR_ANGLE);
+    displayAttributes.push_back(platform.majorVersion);
+    displayAttributes.push_back(EGL_PLATFORM_ANGLE_MAX_VERSION_MINOR_ANGLE);
+    displayAttributes.push_back(platform.minorVersion);
+    displayAttributes.push_back(EGL_PLATFORM_ANGLE_DEVICE_TYPE_ANGLE);
+    displayAttributes.push_back(platform.deviceType);
+    displayAttributes.push_back(EGL_NONE);
+
+    mOSWindow = OSWindow::New();
+    mOSWindow->initialize("EGLCreateContext Test", 64, 64);
+
+    mEGLLibrary.reset(
+        angle::OpenSharedLibrary(ANGLE_EGL_LIBRARY_NAME, angle::SearchType::ModuleDir));
+
+    LoadProc getProc = reinterpret_cast<LoadProc>(mEGLLibrary->getSymbol("eglGetProcAddress"));
+    if (!getProc)
+    {
+        abortTest();
+        return;
+    }
+
+    LoadUtilEGL(getProc);
+    LoadUtilGLES(getProc);
+
+    if (!eglGetPlatformDisplayEXT)
+    {
+        abortTest();
+        return;
+    }
+
+    mDisplay = eglGetPlatformDisplayEXT(EGL_PLATFORM_ANGLE_ANGLE,
+                                        reinterpret_cast<void *>(mOSWindow->getNativeDisplay()),
+                                        &displayAttributes[0]);
+}
+
+EGLCreateContextPerfTest::~EGLCreateContextPerfTest()
+{
+    OSWindow::Delete(&mOSWindow);
+}
+
+void EGLCreateContextPerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    ASSERT_NE(EGL_NO_DISPLAY, mDisplay);
+    EGLint majorVersion, minorVersion;
+    ASSERT_TRUE(eglInitialize(mDisplay, &majorVersion, &minorVersion));
+
+    EGLint numConfigs;
+    EGLint configAttrs[] = {EGL_RED_SIZE,
+                            8,
+                            EGL_GREEN_SIZE,
+                            8,
+                            EGL_BLUE_SIZE,
+                            8,
+                            EGL_RENDERABLE_TYPE,
+                            GetParam().majorVersion == 3 ? EGL_OPENGL_ES3_BIT : EGL_OPENGL_ES2_BIT,
+                            EGL_SURFACE_TYPE,
+                            EGL_PBUFFER_BIT,
+                            EGL_NONE};
+    ASSERT_TRUE(eglChooseConfig(mDisplay, configAttrs, &mConfig, 1, &numConfigs));
+    ASSERT_EQ(1, numConfigs);
+
+    EGLint surfaceAttrs[] = {EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE};
+    mSurface              = eglCreatePbufferSurface(mDisplay, mConfig, surfaceAttrs);
+    ASSERT_NE(EGL_NO_SURFACE, mSurface);
+}
+
+void EGLCreateContextPerfTest::TearDown()
+{
+    ANGLEPerfTest::TearDown();
+    eglDestroySurface(mDisplay, mSurface);
+    eglTerminate(mDisplay);
+}
+
+void EGLCreateContextPerfTest::step()
+{
+    EGLint contextAttrs[] = {EGL_CONTEXT_MAJOR_VERSION, GetParam().majorVersion,
+                             EGL_CONTEXT_MINOR_VERSION, GetParam().minorVersion, EGL_NONE};
+    EGLContext context    = eglCreateContext(mDisplay, mConfig, EGL_NO_CONTEXT, contextAttrs);
+    ASSERT_NE(EGL_NO_CONTEXT, context);
+    ASSERT_TRUE(eglMakeCurrent(mDisplay, mSurface, mSurface, context));
+
+    // A context creates its shader compilers when it first compiles shaders.  The shaders are
+    // different every step, so they are never found in the shader cache.
+    const uint32_t stepIndex = mStepIndex++;
+
+    std::stringstream vertexShader;
+    vertexShader << "attribute vec4 position;\n"
+                    "void main()\n"
+                    "{\n"
+                    "    gl_Position = position * "
+                 << stepIndex << ".0;\n"
+                 << "}\n";
+
+    std::stringstream fragmentShader;
+    fragmentShader << "precision mediump float;\n"
+                      "void main()\n"
+                      "{\n"
+                      "    gl_FragColor = vec4("
+                   << stepIndex << ".0);\n"
+                   << "}\n";
+
+    GLuint vs = CompileShader(GL_VERTEX_SHADER, vertexShader.str().c_str());
+    GLuint fs = CompileShader(GL_FRAGMENT_SHADER, fragmentShader.str().c_str());
+    ASSERT_NE(0u, vs);
+    ASSERT_NE(0u, fs);
+    glDeleteShader(vs);
+    glDeleteShader(fs);
+
+    ASSERT_TRUE(eglMakeCurrent(mDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT));
+    ASSERT_TRUE(eglDestroyContext(mDisplay, context));
+}
+
+TEST_P(EGLCreateContextPerfTest, Run)
+{
+    run();
+}
+
+ANGLE_INSTANTIATE_TEST(EGLCreateContextPerfTest,
+                       angle::ES2_D3D11(),
+                       angle::ES2_METAL(),
+                       angle::ES2_OPENGL(),
+                       angle::ES2_VULKAN(),
+                       angle::ES3_VULKAN());
+
 }  // namespace
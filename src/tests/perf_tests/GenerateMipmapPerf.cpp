@@ -9,6 +9,7 @@
 
 #include "ANGLEPerfTest.h"
 
+#include <algorithm>
 #include <iostream>
 #include <random>
 #include <sstream>
@@ -34,7 +35,8 @@ struct GenerateMipmapParams final : public RenderTestParams
 
         internalFormat = GL_RGBA;
 
-        webgl = false;
+        webgl   = false;
+        cpuPath = false;
     }
 
     std::string story() const override;
@@ -45,6 +47,7 @@ struct GenerateMipmapParams final : public RenderTestParams
     GLenum internalFormat;
 
     bool webgl;
+    bool cpuPath;
 };
 
 std::ostream &operator<<(std::ostream &os, const GenerateMipmapParams &params)
@@ -68,6 +71,11 @@ std::string GenerateMipmapParams::story() const
         strstr << "_rgb";
     }
 
+    if (cpuPath)
+    {
+        strstr << "_cpu";
+    }
+
     return strstr.str();
 }
 
@@ -124,6 +132,11 @@ GenerateMipmapBenchmarkBase::GenerateMipmapBenchmarkBase(const char *benchmarkNa
     setWebGLCompatibilityEnabled(GetParam().webgl);
     setRobustResourceInit(GetParam().webgl);
 
+    if (GetParam().cpuPath)
+    {
+        mReporter->RegisterImportantMetric(".source_MB_per_second", "MB/s");
+    }
+
     if (GetParam().getRenderer() == EGL_PLATFORM_ANGLE_TYPE_D3D11_ANGLE)
     {
         skipTest("http://crbug.com/945415 Crashes on nvidia+d3d11");
@@ -193,6 +206,29 @@ void main()
 
 void GenerateMipmapBenchmarkBase::destroyBenchmark()
 {
+    const auto &params = GetParam();
+
+    // Throughput of the CPU path, counting the bytes read from every level the mips are generated
+    // from.
+    const double elapsedTime = mTrialTimer.getElapsedWallClockTime();
+    if (params.cpuPath && elapsedTime > 0)
+    {
+        size_t bytesPerIteration = 0;
+        GLsizei width            = params.textureWidth;
+        GLsizei height           = params.textureHeight;
+        while (width > 1 || height > 1)
+        {
+            bytesPerIteration += static_cast<size_t>(width) * height * 4;
+            width  = std::max(width / 2, 1);
+            height = std::max(height / 2, 1);
+        }
+
+        const double iterationCount =
+            static_cast<double>(getNumStepsPerformed()) * params.iterationsPerStep;
+        recordDoubleMetric(".source_MB_per_second",
+                           iterationCount * bytesPerIteration / elapsedTime / 1e6, "MB/s");
+    }
+
     glDeleteTextures(1, &mTexture);
     glDeleteProgram(mProgram);
 }
@@ -332,6 +368,14 @@ GenerateMipmapParams VulkanParams(bool webglCompat, bool singleIteration, bool e
     return params;
 }
 
+GenerateMipmapParams VulkanCPUParams(bool singleIteration, bool emulatedFormat)
+{
+    GenerateMipmapParams params = VulkanParams(false, singleIteration, emulatedFormat);
+    params.cpuPath              = true;
+    params.eglParameters.enable(Feature::ForceGenerateMipmapOnCPU);
+    return params;
+}
+
 }  // anonymous namespace
 
 TEST_P(GenerateMipmapBenchmark, Run)
@@ -356,7 +400,9 @@ ANGLE_INSTANTIATE_TEST(GenerateMipmapBenchmark,
                        VulkanParams(false, false, false),
                        VulkanParams(true, false, false),
                        VulkanParams(false, false, true),
-                       VulkanParams(true, false, true));
+                       VulkanParams(true, false, true),
+                       VulkanCPUParams(false, false),
+                       VulkanCPUParams(false, true));
 
 ANGLE_INSTANTIATE_TEST(GenerateMipmapWithRedefineBenchmark,
                        D3D11Params(false, true),
@@ -368,4 +414,6 @@ ANGLE_INSTANTIATE_TEST(GenerateMipmapWithRedefineBenchmark,
                        VulkanParams(false, true, false),
                        VulkanParams(true, true, false),
                        VulkanParams(false, true, true),
-                       VulkanParams(true, true, true));
+                       VulkanParams(true, true, true),
+                       VulkanCPUParams(true, false),
+                       VulkanCPUParams(true, true));
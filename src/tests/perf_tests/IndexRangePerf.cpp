@@ -0,0 +1,130 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// IndexRangePerf:
+//   Performance test for computing the range of the indices in a large index buffer, as done for
+//   draws that need to know how many vertices they use.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <random>
+#include <sstream>
+
+#include "common/utilities.h"
+
+namespace
+{
+constexpr size_t kIndexCount = 1024 * 1024;
+
+struct IndexRangeParams
+{
+    gl::DrawElementsType type    = gl::DrawElementsType::UnsignedShort;
+    bool primitiveRestartEnabled = false;
+};
+
+std::string IndexRangeStory(const IndexRangeParams &params)
+{
+    std::ostringstream story;
+    switch (params.type)
+    {
+        case gl::DrawElementsType::UnsignedByte:
+            story << "_ubyte";
+            break;
+        case gl::DrawElementsType::UnsignedShort:
+            story << "_ushort";
+            break;
+        default:
+            story << "_uint";
+            break;
+    }
+    if (params.primitiveRestartEnabled)
+    {
+        story << "_primitive_restart";
+    }
+    return story.str();
+}
+
+class IndexRangePerfTest : public ANGLEPerfTest,
+                           public ::testing::WithParamInterface<IndexRangeParams>
+{
+  public:
+    IndexRangePerfTest();
+
+    void SetUp() override;
+    void step() override;
+
+  private:
+    template <typename IndexType>
+    void fillIndices();
+
+    std::vector<uint8_t> mIndices;
+};
+
+IndexRangePerfTest::IndexRangePerfTest()
+    : ANGLEPerfTest("IndexRangePerf", "", IndexRangeStory(GetParam()), 1)
+{}
+
+template <typename IndexType>
+void IndexRangePerfTest::fillIndices()
+{
+    mIndices.resize(kIndexCount * sizeof(IndexType));
+    IndexType *indices = reinterpret_cast<IndexType *>(mIndices.data());
+
+    // Mostly triangle strips of a few hundred vertices separated by the restart index.
+    std::mt19937 random(1);
+    const IndexType restartIndex =
+        static_cast<IndexType>(gl::GetPrimitiveRestartIndex(GetParam().type));
+    for (size_t index = 0; index < kIndexCount; ++index)
+    {
+        indices[index] = index % 256 == 255
+                             ? restartIndex
+                             : static_cast<IndexType>(random() % restartIndex);
+    }
+}
+
+void IndexRangePerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    switch (GetParam().type)
+    {
+        case gl::DrawElementsType::UnsignedByte:
+            fillIndices<GLubyte>();
+            break;
+        case gl::DrawElementsType::UnsignedShort:
+            fillIndices<GLushort>();
+            break;
+        default:
+            fillIndices<GLuint>();
+            break;
+    }
+}
+
+void IndexRangePerfTest::step()
+{
+    const gl::IndexRange range = gl::ComputeIndexRange(GetParam().type, mIndices.data(),
+                                                       kIndexCount,
+                                                       GetParam().primitiveRestartEnabled);
+    ASSERT(range.vertexIndexCount > 0);
+    ANGLE_UNUSED_VARIABLE(range);
+}
+
+}  // anonymous namespace
+
+TEST_P(IndexRangePerfTest, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(,
+                         IndexRangePerfTest,
+                         ::testing::ValuesIn(std::vector<IndexRangeParams>{
+                             {IndexRangeParams{gl::DrawElementsType::UnsignedByte, false},
+                              IndexRangeParams{gl::DrawElementsType::UnsignedByte, true},
+                              IndexRangeParams{gl::DrawElementsType::UnsignedShort, false},
+                              IndexRangeParams{gl::DrawElementsType::UnsignedShort, true},
+                              IndexRangeParams{gl::DrawElementsType::UnsignedInt, false},
+                              IndexRangeParams{gl::DrawElementsType::UnsignedInt, true}}}));
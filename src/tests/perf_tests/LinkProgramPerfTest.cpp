@@ -23,6 +23,9 @@ enum class TaskOption
 {
     CompileOnly,
     CompileAndLink,
+    // The shaders are compiled once, and every program links them again.  This measures the work
+    // done per program when programs share shaders, such as transforming their SPIR-V.
+    LinkSharedShaders,
 
     Unspecified
 };
@@ -62,6 +65,10 @@ struct LinkProgramParams final : public RenderTestParams
         {
             strstr << "_compile_and_link";
         }
+        else if (taskOption == TaskOption::LinkSharedShaders)
+        {
+            strstr << "_link_shared_shaders";
+        }
 
         if (threadOption == ThreadOption::SingleThread)
         {
@@ -90,6 +97,17 @@ std::ostream &operator<<(std::ostream &os, const LinkProgramParams &params)
     return os;
 }
 
+constexpr char kVertexShader[] =
+    "attribute vec2 position;\n"
+    "void main() {\n"
+    "    gl_Position = vec4(position, 0, 1);\n"
+    "}";
+constexpr char kFragmentShader[] =
+    "precision mediump float;\n"
+    "void main() {\n"
+    "    gl_FragColor = vec4(1, 0, 0, 1);\n"
+    "}";
+
 class LinkProgramBenchmark : public ANGLERenderTest,
                              public ::testing::WithParamInterface<LinkProgramParams>
 {
@@ -101,7 +119,9 @@ class LinkProgramBenchmark : public ANGLERenderTest,
     void drawBenchmark() override;
 
   protected:
-    GLuint mVertexBuffer = 0;
+    GLuint mVertexBuffer   = 0;
+    GLuint mVertexShader   = 0;
+    GLuint mFragmentShader = 0;
 };
 
 LinkProgramBenchmark::LinkProgramBenchmark() : ANGLERenderTest("LinkProgram", GetParam()) {}
@@ -129,44 +149,56 @@ void LinkProgramBenchmark::initializeBenchmark()
     glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
     glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(Vector3), vertices.data(),
                  GL_STATIC_DRAW);
+
+    if (GetParam().taskOption == TaskOption::LinkSharedShaders)
+    {
+        mVertexShader   = CompileShader(GL_VERTEX_SHADER, kVertexShader);
+        mFragmentShader = CompileShader(GL_FRAGMENT_SHADER, kFragmentShader);
+        ASSERT_NE(0u, mVertexShader);
+        ASSERT_NE(0u, mFragmentShader);
+    }
 }
 
 void LinkProgramBenchmark::destroyBenchmark()
 {
+    glDeleteShader(mVertexShader);
+    glDeleteShader(mFragmentShader);
     glDeleteBuffers(1, &mVertexBuffer);
 }
 
 void LinkProgramBenchmark::drawBenchmark()
 {
-    static const char *vertexShader =
-        "attribute vec2 position;\n"
-        "void main() {\n"
-        "    gl_Position = vec4(position, 0, 1);\n"
-        "}";
-    static const char *fragmentShader =
-        "precision mediump float;\n"
-        "void main() {\n"
-        "    gl_FragColor = vec4(1, 0, 0, 1);\n"
-        "}";
-    GLuint vs = CompileShader(GL_VERTEX_SHADER, vertexShader);
-    GLuint fs = CompileShader(GL_FRAGMENT_SHADER, fragmentShader);
-
-    ASSERT_NE(0u, vs);
-    ASSERT_NE(0u, fs);
-    if (GetParam().taskOption == TaskOption::CompileOnly)
+    GLuint program = 0;
+    if (GetParam().taskOption == TaskOption::LinkSharedShaders)
     {
-        glDeleteShader(vs);
-        glDeleteShader(fs);
-        return;
+        program = glCreateProgram();
+        ASSERT_NE(0u, program);
+
+        glAttachShader(program, mVertexShader);
+        glAttachShader(program, mFragmentShader);
     }
+    else
+    {
+        GLuint vs = CompileShader(GL_VERTEX_SHADER, kVertexShader);
+        GLuint fs = CompileShader(GL_FRAGMENT_SHADER, kFragmentShader);
+
+        ASSERT_NE(0u, vs);
+        ASSERT_NE(0u, fs);
+        if (GetParam().taskOption == TaskOption::CompileOnly)
+        {
+            glDeleteShader(vs);
+            glDeleteShader(fs);
+            return;
+        }
 
-    GLuint program = glCreateProgram();
-    ASSERT_NE(0u, program);
+        program = glCreateProgram();
+        ASSERT_NE(0u, program);
 
-    glAttachShader(program, vs);
-    glDeleteShader(vs);
-    glAttachShader(program, fs);
-    glDeleteShader(fs);
+        glAttachShader(program, vs);
+        glDeleteShader(vs);
+        glAttachShader(program, fs);
+        glDeleteShader(fs);
+    }
     glLinkProgram(program);
     glUseProgram(program);
 
@@ -232,6 +264,8 @@ ANGLE_INSTANTIATE_TEST(
     LinkProgramD3D11Params(TaskOption::CompileAndLink, ThreadOption::SingleThread),
     LinkProgramMetalParams(TaskOption::CompileAndLink, ThreadOption::SingleThread),
     LinkProgramOpenGLOrGLESParams(TaskOption::CompileAndLink, ThreadOption::SingleThread),
-    LinkProgramVulkanParams(TaskOption::CompileAndLink, ThreadOption::SingleThread));
+    LinkProgramVulkanParams(TaskOption::CompileAndLink, ThreadOption::SingleThread),
+    LinkProgramVulkanParams(TaskOption::LinkSharedShaders, ThreadOption::MultiThread),
+    LinkProgramVulkanParams(TaskOption::LinkSharedShaders, ThreadOption::SingleThread));
 
 }  // anonymous namespace
@@ -34,17 +34,23 @@ enum class CompileLinkOrder
     Unspecified,
 };
 
+// Number of functions in the fragment shaders of the large shader variants, which stand for the
+// shaders that take by far the longest to translate.
+constexpr uint32_t kManyFunctions = 300;
+
 struct ParallelLinkProgramParams final : public RenderTestParams
 {
-    ParallelLinkProgramParams(CompileLinkOrder order)
+    ParallelLinkProgramParams(CompileLinkOrder order, uint32_t functionCountIn)
     {
-        iterationsPerStep = 100;
+        // Fewer, but much larger programs are compiled when the shaders have many functions.
+        iterationsPerStep = functionCountIn > 0 ? 10 : 100;
 
         majorVersion     = 3;
         minorVersion     = 0;
         windowWidth      = 256;
         windowHeight     = 256;
         compileLinkOrder = order;
+        functionCount    = functionCountIn;
     }
 
     std::string story() const override
@@ -65,6 +71,11 @@ struct ParallelLinkProgramParams final : public RenderTestParams
             strstr << "_interleaved_compile_and_link_with_immediate_query";
         }
 
+        if (functionCount > 0)
+        {
+            strstr << "_" << functionCount << "_functions";
+        }
+
         if (std::find(eglParameters.disabledFeatureOverrides.begin(),
                       eglParameters.disabledFeatureOverrides.end(),
                       Feature::EnableParallelCompileAndLink) !=
@@ -82,6 +93,8 @@ struct ParallelLinkProgramParams final : public RenderTestParams
     }
 
     CompileLinkOrder compileLinkOrder;
+    // Number of functions, each called once, added to the fragment shaders.
+    uint32_t functionCount;
 };
 
 std::ostream &operator<<(std::ostream &os, const ParallelLinkProgramParams &params)
@@ -190,7 +203,24 @@ uniform mediump sampler2D s2;
 
 layout(location = 0) out mediump vec4 color1;
 layout(location = 2) out highp uvec2 color2;
-
+)";
+        for (uint32_t j = 0; j < params.functionCount; ++j)
+        {
+            fs << R"(
+highp vec4 func)"
+               << j << R"((highp vec4 v)
+{
+    for (int k = 0; k < )"
+               << (j % 4 + 1) << R"(; ++k)
+    {
+        v = v.yzwx * data[)"
+               << (j % params.iterationsPerStep) << R"(] + vec4()" << i << R"(.0);
+    }
+    return v;
+}
+)";
+        }
+        fs << R"(
 void main()
 {
     color1 = var1.xyzx + texture(s, vec2(var2) / 9.);
@@ -198,11 +228,24 @@ void main()
     for (int i = 0; i < 10; ++i)
       sum += texture(s2, vec2(float(i / 2) / 5., float(i % 5) / 5.));
     uvec2 res = uvec2(sum.xz + sum.yw);)";
+        if (params.functionCount > 0)
+        {
+            fs << R"(
+    highp vec4 f = var1.xyzx;)";
+            for (uint32_t j = 0; j < params.functionCount; ++j)
+            {
+                fs << R"(
+    f = func)"
+                   << j << R"((f);)";
+            }
+            fs << R"(
+    color1 += f;)";
+        }
         for (uint32_t j = 0; j < i * 5; ++j)
         {
             fs << R"(
     res += uvec2(data[)"
-               << (j % 100) << R"(]);)";
+               << (j % params.iterationsPerStep) << R"(]);)";
         }
         fs << R"(
     color2 = res;
@@ -298,36 +341,38 @@ using namespace egl_platform;
 
 ParallelLinkProgramParams ParallelLinkProgramD3D11Params(CompileLinkOrder compileLinkOrder)
 {
-    ParallelLinkProgramParams params(compileLinkOrder);
+    ParallelLinkProgramParams params(compileLinkOrder, 0);
     params.eglParameters = D3D11();
     return params;
 }
 
 ParallelLinkProgramParams ParallelLinkProgramMetalParams(CompileLinkOrder compileLinkOrder)
 {
-    ParallelLinkProgramParams params(compileLinkOrder);
+    ParallelLinkProgramParams params(compileLinkOrder, 0);
     params.eglParameters = METAL();
     return params;
 }
 
 ParallelLinkProgramParams ParallelLinkProgramOpenGLOrGLESParams(CompileLinkOrder compileLinkOrder)
 {
-    ParallelLinkProgramParams params(compileLinkOrder);
+    ParallelLinkProgramParams params(compileLinkOrder, 0);
     params.eglParameters = OPENGL_OR_GLES();
     return params;
 }
 
-ParallelLinkProgramParams ParallelLinkProgramVulkanParams(CompileLinkOrder compileLinkOrder)
+ParallelLinkProgramParams ParallelLinkProgramVulkanParams(CompileLinkOrder compileLinkOrder,
+                                                          uint32_t functionCount = 0)
 {
-    ParallelLinkProgramParams params(compileLinkOrder);
+    ParallelLinkProgramParams params(compileLinkOrder, functionCount);
     params.eglParameters = VULKAN();
     params.enable(Feature::EnableParallelCompileAndLink);
     return params;
 }
 
-ParallelLinkProgramParams SerialLinkProgramVulkanParams(CompileLinkOrder compileLinkOrder)
+ParallelLinkProgramParams SerialLinkProgramVulkanParams(CompileLinkOrder compileLinkOrder,
+                                                        uint32_t functionCount = 0)
 {
-    ParallelLinkProgramParams params(compileLinkOrder);
+    ParallelLinkProgramParams params(compileLinkOrder, functionCount);
     params.eglParameters = VULKAN();
     params.disable(Feature::EnableParallelCompileAndLink);
     return params;
@@ -352,6 +397,8 @@ ANGLE_INSTANTIATE_TEST(
     ParallelLinkProgramVulkanParams(CompileLinkOrder::InterleavedAndImmediateQuery),
     SerialLinkProgramVulkanParams(CompileLinkOrder::AllCompilesFirst),
     SerialLinkProgramVulkanParams(CompileLinkOrder::Interleaved),
-    SerialLinkProgramVulkanParams(CompileLinkOrder::InterleavedAndImmediateQuery));
+    SerialLinkProgramVulkanParams(CompileLinkOrder::InterleavedAndImmediateQuery),
+    ParallelLinkProgramVulkanParams(CompileLinkOrder::AllCompilesFirst, kManyFunctions),
+    SerialLinkProgramVulkanParams(CompileLinkOrder::AllCompilesFirst, kManyFunctions));
 
 }  // anonymous namespace
@@ -0,0 +1,128 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// QueueSubmitPerf:
+//   Performance test for making many small queue submissions.  Each submission only clears a
+//   small framebuffer, so the cost is dominated by the submission itself and the tracking of its
+//   completion, which is done either with a fence per submission or with a timeline semaphore.
+//
+
+#include "ANGLEPerfTest.h"
+#include "test_utils/gl_raii.h"
+
+#include <sstream>
+
+namespace angle
+{
+constexpr unsigned int kIterationsPerStep   = 4;
+constexpr unsigned int kSubmitsPerIteration = 100;
+constexpr GLsizei kFramebufferSize          = 16;
+
+struct QueueSubmitParams final : public RenderTestParams
+{
+    QueueSubmitParams()
+    {
+        iterationsPerStep = kIterationsPerStep;
+
+        majorVersion = 3;
+        minorVersion = 0;
+        windowWidth  = kFramebufferSize;
+        windowHeight = kFramebufferSize;
+    }
+
+    std::string story() const override;
+    bool useTimelineSemaphore = false;
+};
+
+std::ostream &operator<<(std::ostream &os, const QueueSubmitParams &params)
+{
+    os << params.backendAndStory().substr(1);
+    return os;
+}
+
+std::string QueueSubmitParams::story() const
+{
+    std::stringstream strstr;
+
+    strstr << RenderTestParams::story();
+    strstr << (useTimelineSemaphore ? "_timeline_semaphore" : "_fence");
+
+    return strstr.str();
+}
+
+class QueueSubmitBenchmark : public ANGLERenderTest,
+                             public ::testing::WithParamInterface<QueueSubmitParams>
+{
+  public:
+    QueueSubmitBenchmark() : ANGLERenderTest("QueueSubmit", GetParam()) {}
+    void initializeBenchmark() override;
+    void drawBenchmark() override;
+
+  protected:
+    GLTexture mTexture;
+    GLFramebuffer mFramebuffer;
+};
+
+void QueueSubmitBenchmark::initializeBenchmark()
+{
+    glBindTexture(GL_TEXTURE_2D, mTexture);
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, kFramebufferSize, kFramebufferSize);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, mFramebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, mTexture, 0);
+    ASSERT_GLENUM_EQ(GL_FRAMEBUFFER_COMPLETE, glCheckFramebufferStatus(GL_FRAMEBUFFER));
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void QueueSubmitBenchmark::drawBenchmark()
+{
+    const auto &params = GetParam();
+
+    for (size_t it = 0; it < params.iterationsPerStep; ++it)
+    {
+        for (unsigned int submit = 0; submit < kSubmitsPerIteration; ++submit)
+        {
+            const float value = static_cast<float>(submit) / kSubmitsPerIteration;
+            glClearColor(value, 0.0f, 1.0f - value, 1.0f);
+            glClear(GL_COLOR_BUFFER_BIT);
+            glFlush();
+        }
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+QueueSubmitParams VulkanFenceParams()
+{
+    QueueSubmitParams params;
+    params.eglParameters =
+        egl_platform::VULKAN().disable(Feature::UseTimelineSemaphoreForQueueCompletion);
+    params.useTimelineSemaphore = false;
+
+    return params;
+}
+
+QueueSubmitParams VulkanTimelineSemaphoreParams()
+{
+    QueueSubmitParams params;
+    params.eglParameters =
+        egl_platform::VULKAN().enable(Feature::UseTimelineSemaphoreForQueueCompletion);
+    params.useTimelineSemaphore = true;
+
+    return params;
+}
+
+// Runs tests to measure the overhead of many small queue submissions.  Compare the _fence and
+// _timeline_semaphore stories for the before/after cost of completion tracking.
+TEST_P(QueueSubmitBenchmark, Run)
+{
+    run();
+}
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(QueueSubmitBenchmark);
+ANGLE_INSTANTIATE_TEST(QueueSubmitBenchmark, VulkanFenceParams(), VulkanTimelineSemaphoreParams());
+
+}  // namespace angle
@@ -0,0 +1,154 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ResourceMapPerf:
+//   Performance test for concurrent lookups in the thread-safe gl::ResourceMap, while another
+//   thread keeps inserting and erasing ids.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <atomic>
+#include <sstream>
+#include <thread>
+
+#include "libANGLE/ResourceMap.h"
+
+namespace
+{
+constexpr unsigned int kLookupsPerThreadPerStep = 100000;
+// Applications sharing tens of thousands of buffers between contexts use ids well beyond the
+// flat array of the map.
+constexpr GLuint kLargeIdCount = 40000;
+
+struct ResourceMapParams
+{
+    uint32_t threadCount = 1;
+    // Whether the looked up ids start past the flat array of the map.
+    bool largeIds = false;
+};
+
+std::string ResourceMapStory(const ResourceMapParams &params)
+{
+    std::ostringstream story;
+    story << (params.largeIds ? "_large_ids" : "_small_ids") << "_" << params.threadCount
+          << "_threads";
+    return story.str();
+}
+
+// Every thread does the same amount of lookups per step, so with perfect scaling the time per step
+// stays flat as the thread count grows.  One more thread assigns and erases other ids at the same
+// time, as contexts creating and deleting buffers would.
+class ResourceMapPerfTest : public ANGLEPerfTest,
+                            public ::testing::WithParamInterface<ResourceMapParams>
+{
+  public:
+    ResourceMapPerfTest();
+    ~ResourceMapPerfTest();
+
+    void SetUp() override;
+    void step() override;
+
+  private:
+    void lookUp(uint32_t threadIndex);
+    void insertAndErase();
+
+    gl::ResourceMap<size_t, gl::BufferID> mResourceMap;
+    std::vector<size_t> mObjects;
+    GLuint mFirstId;
+    GLuint mIdCount;
+    std::atomic<bool> mLookupsDone;
+};
+
+ResourceMapPerfTest::ResourceMapPerfTest()
+    : ANGLEPerfTest("ResourceMapPerf", "", ResourceMapStory(GetParam()), kLookupsPerThreadPerStep),
+      mFirstId(GetParam().largeIds ? 10000 : 1),
+      mIdCount(GetParam().largeIds ? kLargeIdCount : 1000),
+      mLookupsDone(false)
+{}
+
+ResourceMapPerfTest::~ResourceMapPerfTest()
+{
+    mResourceMap.clear();
+}
+
+void ResourceMapPerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    // The ids in [mFirstId, mFirstId + mIdCount) are looked up, and the next ones are inserted
+    // and erased.
+    mObjects.resize(mIdCount * 2);
+    for (GLuint index = 0; index < mIdCount; ++index)
+    {
+        mResourceMap.assign({mFirstId + index}, &mObjects[index]);
+    }
+}
+
+void ResourceMapPerfTest::lookUp(uint32_t threadIndex)
+{
+    // Start each thread at a different id, and step with a stride to avoid walking the map in
+    // order.
+    GLuint index = threadIndex * 97;
+    for (unsigned int lookup = 0; lookup < kLookupsPerThreadPerStep; ++lookup)
+    {
+        index = (index + 7919) % mIdCount;
+
+        const size_t *object = mResourceMap.query({mFirstId + index});
+        ASSERT(object == &mObjects[index]);
+        ANGLE_UNUSED_VARIABLE(object);
+    }
+}
+
+void ResourceMapPerfTest::insertAndErase()
+{
+    GLuint index = 0;
+    while (!mLookupsDone)
+    {
+        const gl::BufferID id = {mFirstId + mIdCount + index};
+        size_t *object        = nullptr;
+        if (!mResourceMap.erase(id, &object))
+        {
+            mResourceMap.assign(id, &mObjects[mIdCount + index]);
+        }
+        index = (index + 1) % mIdCount;
+    }
+}
+
+void ResourceMapPerfTest::step()
+{
+    mLookupsDone = false;
+    std::thread writer(&ResourceMapPerfTest::insertAndErase, this);
+
+    std::vector<std::thread> threads;
+    for (uint32_t threadIndex = 1; threadIndex < GetParam().threadCount; ++threadIndex)
+    {
+        threads.emplace_back(&ResourceMapPerfTest::lookUp, this, threadIndex);
+    }
+
+    lookUp(0);
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    mLookupsDone = true;
+    writer.join();
+}
+
+}  // anonymous namespace
+
+TEST_P(ResourceMapPerfTest, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(,
+                         ResourceMapPerfTest,
+                         ::testing::ValuesIn(std::vector<ResourceMapParams>{
+                             {ResourceMapParams{1, false}, ResourceMapParams{4, false},
+                              ResourceMapParams{1, true}, ResourceMapParams{2, true},
+                              ResourceMapParams{4, true}, ResourceMapParams{8, true}}}));
@@ -23,6 +23,48 @@ namespace
 {
 constexpr unsigned int kIterationsPerStep = 2;
 
+// The client format of the uploaded data, for the tests that measure the conversion to the format
+// of the texture.
+enum class UploadFormat
+{
+    RGBA8,
+    L8,
+    LA8,
+    RGBA4,
+    RGB565,
+    RGB5A1,
+    RGBA32F,
+};
+
+struct UploadFormatInfo
+{
+    GLenum internalFormat;
+    GLenum format;
+    GLenum type;
+    const char *story;
+};
+
+UploadFormatInfo GetUploadFormatInfo(UploadFormat uploadFormat)
+{
+    switch (uploadFormat)
+    {
+        case UploadFormat::L8:
+            return {GL_LUMINANCE, GL_LUMINANCE, GL_UNSIGNED_BYTE, "_l8"};
+        case UploadFormat::LA8:
+            return {GL_LUMINANCE_ALPHA, GL_LUMINANCE_ALPHA, GL_UNSIGNED_BYTE, "_la8"};
+        case UploadFormat::RGBA4:
+            return {GL_RGBA4, GL_RGBA, GL_UNSIGNED_SHORT_4_4_4_4, "_rgba4"};
+        case UploadFormat::RGB565:
+            return {GL_RGB565, GL_RGB, GL_UNSIGNED_SHORT_5_6_5, "_rgb565"};
+        case UploadFormat::RGB5A1:
+            return {GL_RGB5_A1, GL_RGBA, GL_UNSIGNED_SHORT_5_5_5_1, "_rgb5a1"};
+        case UploadFormat::RGBA32F:
+            return {GL_RGBA16F, GL_RGBA, GL_FLOAT, "_rgba32f_to_16f"};
+        default:
+            return {GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE, "_rgba8"};
+    }
+}
+
 struct TextureUploadParams final : public RenderTestParams
 {
     TextureUploadParams()
@@ -32,16 +74,23 @@ struct TextureUploadParams final : public RenderTestParams
 
         baseSize     = 1024;
         subImageSize = 64;
+        arrayLayers  = 1;
 
-        webgl = false;
+        webgl          = false;
+        singleThreaded = false;
+        uploadFormat   = UploadFormat::RGBA8;
     }
 
     std::string story() const override;
 
     GLsizei baseSize;
     GLsizei subImageSize;
+    GLsizei arrayLayers;
 
     bool webgl;
+    // Whether the texture data is converted on a single thread.
+    bool singleThreaded;
+    UploadFormat uploadFormat;
 };
 
 std::ostream &operator<<(std::ostream &os, const TextureUploadParams &params)
@@ -61,6 +110,16 @@ std::string TextureUploadParams::story() const
         strstr << "_webgl";
     }
 
+    if (singleThreaded)
+    {
+        strstr << "_single_threaded";
+    }
+
+    if (uploadFormat != UploadFormat::RGBA8)
+    {
+        strstr << GetUploadFormatInfo(uploadFormat).story;
+    }
+
     return strstr.str();
 }
 
@@ -108,6 +167,26 @@ class TextureUploadSubImageBenchmark : public TextureUploadBenchmarkBase
     void drawBenchmark() override;
 };
 
+// Uploads sub-images in a format that the implementation typically has to convert on the CPU.
+class TextureUploadConversionBenchmark : public TextureUploadBenchmarkBase
+{
+  public:
+    TextureUploadConversionBenchmark() : TextureUploadBenchmarkBase("TexSubImageConversion") {}
+
+    void initializeBenchmark() override
+    {
+        TextureUploadBenchmarkBase::initializeBenchmark();
+
+        const auto &params          = GetParam();
+        const UploadFormatInfo info = GetUploadFormatInfo(params.uploadFormat);
+        glTexImage2D(GL_TEXTURE_2D, 0, info.internalFormat, params.baseSize, params.baseSize, 0,
+                     info.format, info.type, nullptr);
+        ASSERT_GL_NO_ERROR();
+    }
+
+    void drawBenchmark() override;
+};
+
 class TextureUploadFullMipBenchmark : public TextureUploadBenchmarkBase
 {
   public:
@@ -116,6 +195,34 @@ class TextureUploadFullMipBenchmark : public TextureUploadBenchmarkBase
     void drawBenchmark() override;
 };
 
+class TextureUploadArrayFullMipBenchmark : public TextureUploadBenchmarkBase
+{
+  public:
+    TextureUploadArrayFullMipBenchmark() : TextureUploadBenchmarkBase("TextureArrayUpload") {}
+
+    void initializeBenchmark() override
+    {
+        TextureUploadBenchmarkBase::initializeBenchmark();
+
+        const auto &params = GetParam();
+
+        glGenTextures(1, &mArrayTexture);
+        glBindTexture(GL_TEXTURE_2D_ARRAY, mArrayTexture);
+        mTextureData.resize(params.baseSize * params.baseSize * params.arrayLayers, 0.5);
+    }
+
+    void destroyBenchmark() override
+    {
+        TextureUploadBenchmarkBase::destroyBenchmark();
+        glDeleteTextures(1, &mArrayTexture);
+    }
+
+    void drawBenchmark() override;
+
+  private:
+    GLuint mArrayTexture = 0;
+};
+
 class PBOSubImageBenchmark : public TextureUploadBenchmarkBase
 {
   public:
@@ -379,6 +486,27 @@ void TextureUploadSubImageBenchmark::drawBenchmark()
     ASSERT_GL_NO_ERROR();
 }
 
+void TextureUploadConversionBenchmark::drawBenchmark()
+{
+    const auto &params          = GetParam();
+    const UploadFormatInfo info = GetUploadFormatInfo(params.uploadFormat);
+
+    startGpuTimer();
+    for (unsigned int iteration = 0; iteration < params.iterationsPerStep; ++iteration)
+    {
+        glTexSubImage2D(GL_TEXTURE_2D, 0, rand() % (params.baseSize - params.subImageSize),
+                        rand() % (params.baseSize - params.subImageSize), params.subImageSize,
+                        params.subImageSize, info.format, info.type, mTextureData.data());
+
+        // Perform a draw just so the texture data is flushed.  With the position attributes not
+        // set, a constant default value is used, resulting in a very cheap draw.
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+    }
+    stopGpuTimer();
+
+    ASSERT_GL_NO_ERROR();
+}
+
 void TextureUploadFullMipBenchmark::drawBenchmark()
 {
     const auto &params = GetParam();
@@ -403,6 +531,30 @@ void TextureUploadFullMipBenchmark::drawBenchmark()
     ASSERT_GL_NO_ERROR();
 }
 
+void TextureUploadArrayFullMipBenchmark::drawBenchmark()
+{
+    const auto &params = GetParam();
+
+    startGpuTimer();
+    for (size_t it = 0; it < params.iterationsPerStep; ++it)
+    {
+        // Stage data for all layers of all mips.  The RGB data is converted to RGBA.
+        GLint mip = 0;
+        for (GLsizei levelSize = params.baseSize; levelSize > 0; levelSize >>= 1)
+        {
+            glTexImage3D(GL_TEXTURE_2D_ARRAY, mip++, GL_RGB, levelSize, levelSize,
+                         params.arrayLayers, 0, GL_RGB, GL_UNSIGNED_BYTE, mTextureData.data());
+        }
+
+        // Perform a draw just so the texture data is flushed.  With the position attributes not
+        // set, a constant default value is used, resulting in a very cheap draw.
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+    }
+    stopGpuTimer();
+
+    ASSERT_GL_NO_ERROR();
+}
+
 void PBOSubImageBenchmark::drawBenchmark()
 {
     const auto &params = GetParam();
@@ -488,6 +640,22 @@ TextureUploadParams ES3VulkanParams(bool webglCompat)
     return params;
 }
 
+TextureUploadParams ES3VulkanArrayParams(bool singleThreaded)
+{
+    TextureUploadParams params;
+    params.eglParameters  = egl_platform::VULKAN();
+    params.majorVersion   = 3;
+    params.minorVersion   = 0;
+    params.baseSize       = 512;
+    params.arrayLayers    = 16;
+    params.singleThreaded = singleThreaded;
+    if (singleThreaded)
+    {
+        params.enable(Feature::SingleThreadedTextureDecompression);
+    }
+    return params;
+}
+
 TextureUploadParams MetalPBOParams(GLsizei baseSize, GLsizei subImageSize)
 {
     TextureUploadParams params;
@@ -523,6 +691,16 @@ TextureUploadParams ES3OpenGLPBOParams(GLsizei baseSize, GLsizei subImageSize)
     return params;
 }
 
+TextureUploadParams ES3ConversionParams(const TextureUploadParams &in, UploadFormat uploadFormat)
+{
+    TextureUploadParams params = in;
+    params.majorVersion        = 3;
+    params.minorVersion        = 0;
+    params.subImageSize        = 512;
+    params.uploadFormat        = uploadFormat;
+    return params;
+}
+
 }  // anonymous namespace
 
 // Test etc to bc transcoding performance.
@@ -536,11 +714,23 @@ TEST_P(TextureUploadSubImageBenchmark, Run)
     run();
 }
 
+TEST_P(TextureUploadConversionBenchmark, Run)
+{
+    run();
+}
+
 TEST_P(TextureUploadFullMipBenchmark, Run)
 {
     run();
 }
 
+// Test uploading 2D array textures with full mip chains, with the conversion of the layers spread
+// over multiple threads, or on a single thread.
+TEST_P(TextureUploadArrayFullMipBenchmark, Run)
+{
+    run();
+}
+
 TEST_P(PBOSubImageBenchmark, Run)
 {
     run();
@@ -566,6 +756,17 @@ ANGLE_INSTANTIATE_TEST(TextureUploadSubImageBenchmark,
 
 ANGLE_INSTANTIATE_TEST(TextureUploadETC2TranscodingBenchmark, ES3VulkanParams(false));
 
+std::vector<TextureUploadParams> gConversionTests =
+    CombineWithValues(std::vector<TextureUploadParams>{D3D11Params(false),
+                                                       OpenGLOrGLESParams(false),
+                                                       VulkanParams(false),
+                                                       NullDevice(VulkanParams(false))},
+                      {UploadFormat::RGBA8, UploadFormat::L8, UploadFormat::LA8,
+                       UploadFormat::RGBA4, UploadFormat::RGB565, UploadFormat::RGB5A1,
+                       UploadFormat::RGBA32F},
+                      ES3ConversionParams);
+ANGLE_INSTANTIATE_TEST_ARRAY(TextureUploadConversionBenchmark, gConversionTests);
+
 ANGLE_INSTANTIATE_TEST(TextureUploadFullMipBenchmark,
                        D3D11Params(false),
                        D3D11Params(true),
@@ -576,6 +777,10 @@ ANGLE_INSTANTIATE_TEST(TextureUploadFullMipBenchmark,
                        VulkanParams(false),
                        VulkanParams(true));
 
+ANGLE_INSTANTIATE_TEST(TextureUploadArrayFullMipBenchmark,
+                       ES3VulkanArrayParams(false),
+                       ES3VulkanArrayParams(true));
+
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(PBOSubImageBenchmark);
 ANGLE_INSTANTIATE_TEST(PBOSubImageBenchmark,
                        ES3OpenGLPBOParams(1024, 128),
@@ -61,6 +61,7 @@ std::string FrequencyToString(Frequency frequency)
 
 constexpr size_t kRebindSometimesFrequency      = 5;
 constexpr size_t kStateUpdateSometimesFrequency = 3;
+constexpr size_t kDefaultTextureCount           = 8;
 
 struct TexturesParams final : public RenderTestParams
 {
@@ -74,7 +75,7 @@ struct TexturesParams final : public RenderTestParams
         windowWidth  = 720;
         windowHeight = 720;
 
-        numTextures                 = 8;
+        numTextures                 = kDefaultTextureCount;
         textureRebindFrequency      = Frequency::Sometimes;
         textureStateUpdateFrequency = Frequency::Sometimes;
         textureMipCount             = 8;
@@ -102,6 +103,10 @@ std::string TexturesParams::story() const
     std::stringstream strstr;
 
     strstr << RenderTestParams::story();
+    if (numTextures != kDefaultTextureCount)
+    {
+        strstr << "_" << numTextures << "_textures";
+    }
     strstr << "_" << FrequencyToString(textureRebindFrequency) << "_rebind";
     strstr << "_" << FrequencyToString(textureStateUpdateFrequency) << "_update";
 
@@ -110,6 +115,11 @@ std::string TexturesParams::story() const
         strstr << "_webgl";
     }
 
+    if (isDisableRequested(Feature::UseDescriptorUpdateTemplates))
+    {
+        strstr << "_no_update_templates";
+    }
+
     return strstr.str();
 }
 
@@ -369,6 +379,21 @@ TexturesParams VulkanParams(bool webglCompat,
     return ApplyFrequencies(params, rebindFrequency, stateUpdateFrequency);
 }
 
+// Texture-heavy programs, where each descriptor set update writes many descriptors.  Compares
+// vkUpdateDescriptorSets against descriptor update templates.
+TexturesParams VulkanManyTexturesParams(bool useDescriptorUpdateTemplates,
+                                        Frequency rebindFrequency,
+                                        Frequency stateUpdateFrequency)
+{
+    TexturesParams params = VulkanParams(false, rebindFrequency, stateUpdateFrequency);
+    params.numTextures    = 16;
+    if (!useDescriptorUpdateTemplates)
+    {
+        params.disable(Feature::UseDescriptorUpdateTemplates);
+    }
+    return params;
+}
+
 TEST_P(TexturesBenchmark, Run)
 {
     run();
@@ -391,5 +416,9 @@ ANGLE_INSTANTIATE_TEST(TexturesBenchmark,
                        VulkanParams(true, Frequency::Sometimes, Frequency::Sometimes),
                        VulkanParams(false, Frequency::Always, Frequency::Always),
                        VulkanParams(true, Frequency::Always, Frequency::Always),
-                       VulkanParams(false, Frequency::Always, Frequency::Never));
+                       VulkanParams(false, Frequency::Always, Frequency::Never),
+                       VulkanManyTexturesParams(true, Frequency::Always, Frequency::Never),
+                       VulkanManyTexturesParams(false, Frequency::Always, Frequency::Never),
+                       VulkanManyTexturesParams(true, Frequency::Always, Frequency::Always),
+                       VulkanManyTexturesParams(false, Frequency::Always, Frequency::Always));
 }  // namespace angle
@@ -121,6 +121,11 @@ std::string UniformsParams::story() const
         strstr << "_repeating";
     }
 
+    if (isEnableRequested(Feature::UsePushDescriptorsForDefaultUniforms))
+    {
+        strstr << "_push_descriptors";
+    }
+
     return strstr.str();
 }
 
@@ -500,6 +505,12 @@ UniformsParams MatrixUniforms(const EGLPlatformParameters &egl,
     return params;
 }
 
+UniformsParams PushDescriptors(UniformsParams params)
+{
+    params.enable(Feature::UsePushDescriptorsForDefaultUniforms);
+    return params;
+}
+
 }  // anonymous namespace
 
 TEST_P(UniformsBenchmark, Run)
@@ -533,4 +544,9 @@ ANGLE_INSTANTIATE_TEST(
     MatrixUniforms(VULKAN(), DataMode::REPEAT, DataType::MAT4x4, MatrixLayout::NO_TRANSPOSE),
     MatrixUniforms(VULKAN(), DataMode::UPDATE, DataType::MAT3x3, MatrixLayout::NO_TRANSPOSE),
     MatrixUniforms(VULKAN(), DataMode::REPEAT, DataType::MAT3x3, MatrixLayout::NO_TRANSPOSE),
+    VectorUniforms(VULKAN(), DataMode::UPDATE),
+    PushDescriptors(VectorUniforms(VULKAN(), DataMode::UPDATE)),
+    PushDescriptors(
+        MatrixUniforms(VULKAN(), DataMode::UPDATE, DataType::MAT4x4, MatrixLayout::NO_TRANSPOSE)),
+    PushDescriptors(VectorUniforms(VULKAN(), DataMode::UPDATE, ProgramMode::MULTIPLE)),
     VectorUniforms(D3D11_NULL(), DataMode::REPEAT, ProgramMode::MULTIPLE));
@@ -62,6 +62,8 @@ struct CommandBufferTestParams
     std::string story;
     int frames  = NUM_FRAMES;
     int buffers = NUM_CMD_BUFFERS;
+    // If set, the number of vkQueueSubmit calls per frame, used to report submits per second.
+    int submitsPerFrame = 0;
 };
 
 class VulkanCommandBufferPerfTest : public ANGLEPerfTest,
@@ -173,6 +175,14 @@ void VulkanCommandBufferPerfTest::step()
 
 void VulkanCommandBufferPerfTest::TearDown()
 {
+    const double elapsedTime = mTrialTimer.getElapsedWallClockTime();
+    if (GetParam().submitsPerFrame > 0 && elapsedTime > 0)
+    {
+        const double submitCount =
+            static_cast<double>(getNumStepsPerformed()) * mFrames * GetParam().submitsPerFrame;
+        recordDoubleMetric(".submits_per_second", submitCount / elapsedTime, "count");
+    }
+
     vkDestroySemaphore(mInfo.device, mImageAcquiredSemaphore, NULL);
     vkDestroyFence(mInfo.device, mDrawFence, NULL);
     destroy_pipeline(mInfo);
@@ -224,12 +234,8 @@ void Present(sample_info &info, VkFence drawFence)
     ASSERT_EQ(VK_SUCCESS, res);
 }
 
-// 100 separate primary cmd buffers, each with 1 Draw
-void PrimaryCommandBufferBenchmarkHundredIndividual(sample_info &info,
-                                                    VkClearValue *clear_values,
-                                                    VkFence drawFence,
-                                                    VkSemaphore imageAcquiredSemaphore,
-                                                    int numBuffers)
+// Records numBuffers separate primary cmd buffers, each with 1 Draw
+void RecordPrimaryCommandBuffers(sample_info &info, VkClearValue *clear_values, int numBuffers)
 {
     VkResult res;
 
@@ -270,6 +276,18 @@ void PrimaryCommandBufferBenchmarkHundredIndividual(sample_info &info,
         res = vkEndCommandBuffer(info.cmds[x]);
         ASSERT_EQ(VK_SUCCESS, res);
     }
+}
+
+// 100 separate primary cmd buffers, each with 1 Draw
+void PrimaryCommandBufferBenchmarkHundredIndividual(sample_info &info,
+                                                    VkClearValue *clear_values,
+                                                    VkFence drawFence,
+                                                    VkSemaphore imageAcquiredSemaphore,
+                                                    int numBuffers)
+{
+    VkResult res;
+
+    RecordPrimaryCommandBuffers(info, clear_values, numBuffers);
 
     VkPipelineStageFlags pipe_stage_flags = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
     VkSubmitInfo submitInfo[1]            = {};
@@ -290,6 +308,73 @@ void PrimaryCommandBufferBenchmarkHundredIndividual(sample_info &info,
     Present(info, drawFence);
 }
 
+// Separate primary cmd buffers with 1 Draw each, each submitted with its own vkQueueSubmit call.
+// This is how submissions from many contexts reach the queue when they are not coalesced.
+void PrimaryCommandBufferBenchmarkIndividualSubmits(sample_info &info,
+                                                    VkClearValue *clear_values,
+                                                    VkFence drawFence,
+                                                    VkSemaphore imageAcquiredSemaphore,
+                                                    int numBuffers)
+{
+    VkResult res;
+
+    RecordPrimaryCommandBuffers(info, clear_values, numBuffers);
+
+    VkPipelineStageFlags pipe_stage_flags = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    for (int x = 0; x < numBuffers; x++)
+    {
+        VkSubmitInfo submitInfo       = {};
+        submitInfo.sType              = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.commandBufferCount = 1;
+        submitInfo.pCommandBuffers    = &info.cmds[x];
+        if (x == 0)
+        {
+            submitInfo.waitSemaphoreCount = 1;
+            submitInfo.pWaitSemaphores    = &imageAcquiredSemaphore;
+            submitInfo.pWaitDstStageMask  = &pipe_stage_flags;
+        }
+
+        // The queue executes the submissions in order, so only the last one needs the fence.
+        res = vkQueueSubmit(info.graphics_queue, 1, &submitInfo,
+                            x == numBuffers - 1 ? drawFence : VK_NULL_HANDLE);
+        ASSERT_EQ(VK_SUCCESS, res);
+    }
+
+    Present(info, drawFence);
+}
+
+// The same submissions as PrimaryCommandBufferBenchmarkIndividualSubmits, coalesced into a single
+// vkQueueSubmit call with one VkSubmitInfo per cmd buffer.
+void PrimaryCommandBufferBenchmarkCoalescedSubmits(sample_info &info,
+                                                   VkClearValue *clear_values,
+                                                   VkFence drawFence,
+                                                   VkSemaphore imageAcquiredSemaphore,
+                                                   int numBuffers)
+{
+    VkResult res;
+
+    RecordPrimaryCommandBuffers(info, clear_values, numBuffers);
+
+    VkPipelineStageFlags pipe_stage_flags = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    std::vector<VkSubmitInfo> submitInfos(numBuffers);
+    for (int x = 0; x < numBuffers; x++)
+    {
+        VkSubmitInfo &submitInfo      = submitInfos[x];
+        submitInfo.sType              = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.commandBufferCount = 1;
+        submitInfo.pCommandBuffers    = &info.cmds[x];
+    }
+    submitInfos[0].waitSemaphoreCount = 1;
+    submitInfos[0].pWaitSemaphores    = &imageAcquiredSemaphore;
+    submitInfos[0].pWaitDstStageMask  = &pipe_stage_flags;
+
+    res = vkQueueSubmit(info.graphics_queue, static_cast<uint32_t>(submitInfos.size()),
+                        submitInfos.data(), drawFence);
+    ASSERT_EQ(VK_SUCCESS, res);
+
+    Present(info, drawFence);
+}
+
 // 100 of the same Draw cmds in the same primary cmd buffer
 void PrimaryCommandBufferBenchmarkOneWithOneHundred(sample_info &info,
                                                     VkClearValue *clear_values,
@@ -563,6 +648,24 @@ CommandBufferTestParams PrimaryCBOneWithOneHundredParams()
     return params;
 }
 
+CommandBufferTestParams PrimaryCBIndividualSubmitsParams()
+{
+    CommandBufferTestParams params;
+    params.CBImplementation = PrimaryCommandBufferBenchmarkIndividualSubmits;
+    params.story            = "_PrimaryCB_Individual_Submits_With_1_Draw";
+    params.submitsPerFrame  = params.buffers;
+    return params;
+}
+
+CommandBufferTestParams PrimaryCBCoalescedSubmitsParams()
+{
+    CommandBufferTestParams params;
+    params.CBImplementation = PrimaryCommandBufferBenchmarkCoalescedSubmits;
+    params.story            = "_PrimaryCB_Coalesced_Submits_With_1_Draw";
+    params.submitsPerFrame  = 1;
+    return params;
+}
+
 CommandBufferTestParams SecondaryCBParams()
 {
     CommandBufferTestParams params;
@@ -628,6 +731,8 @@ INSTANTIATE_TEST_SUITE_P(,
                          VulkanCommandBufferPerfTest,
                          ::testing::Values(PrimaryCBHundredIndividualParams(),
                                            PrimaryCBOneWithOneHundredParams(),
+                                           PrimaryCBIndividualSubmitsParams(),
+                                           PrimaryCBCoalescedSubmitsParams(),
                                            SecondaryCBParams(),
                                            CommandPoolDestroyParams(),
                                            CommandPoolHardResetParams(),
@@ -13,6 +13,11 @@
 #include "libANGLE/renderer/vulkan/vk_renderer.h"
 #include "util/random_utils.h"
 
+#include <condition_variable>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
 using namespace rx;
 
 namespace
@@ -142,6 +147,192 @@ void VulkanPipelineCachePerfTest::step()
     fsRefCounted.get().setHandle(VK_NULL_HANDLE);
 }
 
+constexpr unsigned int kLookupsPerThreadPerStep = 10000;
+
+struct ConcurrentParams
+{
+    uint32_t threadCount = 1;
+    bool concurrentCache = false;
+};
+
+std::string ConcurrentStory(const ConcurrentParams &params)
+{
+    std::ostringstream story;
+    story << (params.concurrentCache ? "_concurrent" : "_locked") << "_" << params.threadCount
+          << "_threads";
+    return story.str();
+}
+
+// Measures cache hit lookups from multiple threads.  The threads either share a
+// GraphicsPipelineCache behind a mutex, or a ConcurrentGraphicsPipelineCache without any lock, as
+// used by programs and ShareGroupVk.  Every thread does the same amount of work per step, so with
+// perfect scaling the time per step stays flat as the thread count grows.
+class VulkanConcurrentPipelineCachePerfTest : public ANGLEPerfTest,
+                                              public ::testing::WithParamInterface<ConcurrentParams>
+{
+  public:
+    VulkanConcurrentPipelineCachePerfTest();
+    ~VulkanConcurrentPipelineCachePerfTest();
+
+    void SetUp() override;
+    void TearDown() override;
+    void step() override;
+
+  private:
+    void lookUpThread(uint32_t threadIndex);
+    void lookUp(uint32_t threadIndex);
+
+    GraphicsPipelineCache<GraphicsPipelineDescCompleteHash> mCache;
+    ConcurrentGraphicsPipelineCache<GraphicsPipelineDescCompleteHash> mConcurrentCache;
+    std::mutex mCacheMutex;
+
+    std::vector<vk::GraphicsPipelineDesc> mCacheHits;
+
+    // The worker threads live for the whole test.  Every step increments |mStep| to start them,
+    // and waits for |mPendingThreadCount| to drop to zero.
+    std::vector<std::thread> mThreads;
+    std::mutex mMutex;
+    std::condition_variable mStepCondition;
+    std::condition_variable mDoneCondition;
+    uint64_t mStep             = 0;
+    size_t mPendingThreadCount = 0;
+    bool mExit                 = false;
+};
+
+VulkanConcurrentPipelineCachePerfTest::VulkanConcurrentPipelineCachePerfTest()
+    : ANGLEPerfTest("VulkanConcurrentPipelineCachePerf",
+                    "",
+                    ConcurrentStory(GetParam()),
+                    kLookupsPerThreadPerStep)
+{}
+
+VulkanConcurrentPipelineCachePerfTest::~VulkanConcurrentPipelineCachePerfTest()
+{
+    mCache.reset();
+    mConcurrentCache.reset();
+}
+
+void VulkanConcurrentPipelineCachePerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    angle::RNG rng(0x12345678u);
+    std::vector<uint8_t> bytes(sizeof(vk::GraphicsPipelineDesc));
+
+    for (int pipelineCount = 0; pipelineCount < 1000; ++pipelineCount)
+    {
+        vk::GraphicsPipelineDesc desc;
+        FillVectorWithRandomUBytes(&rng, &bytes);
+        memcpy(&desc, bytes.data(), sizeof(vk::GraphicsPipelineDesc));
+
+        if (pipelineCount % 10 == 0)
+        {
+            mCacheHits.push_back(desc);
+        }
+
+        if (GetParam().concurrentCache)
+        {
+            mConcurrentCache.populate(desc, vk::Pipeline(), nullptr);
+        }
+        else
+        {
+            mCache.populate(desc, vk::Pipeline(), nullptr);
+        }
+    }
+
+    // The calling thread does the lookups of thread 0.
+    for (uint32_t threadIndex = 1; threadIndex < GetParam().threadCount; ++threadIndex)
+    {
+        mThreads.emplace_back(&VulkanConcurrentPipelineCachePerfTest::lookUpThread, this,
+                              threadIndex);
+    }
+}
+
+void VulkanConcurrentPipelineCachePerfTest::TearDown()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mExit = true;
+    }
+    mStepCondition.notify_all();
+
+    for (std::thread &thread : mThreads)
+    {
+        thread.join();
+    }
+    mThreads.clear();
+
+    ANGLEPerfTest::TearDown();
+}
+
+void VulkanConcurrentPipelineCachePerfTest::lookUpThread(uint32_t threadIndex)
+{
+    uint64_t lastStep = 0;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mStepCondition.wait(lock, [&]() { return mExit || mStep != lastStep; });
+            if (mExit)
+            {
+                break;
+            }
+            lastStep = mStep;
+        }
+
+        lookUp(threadIndex);
+
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            if (--mPendingThreadCount == 0)
+            {
+                mDoneCondition.notify_one();
+            }
+        }
+    }
+}
+
+void VulkanConcurrentPipelineCachePerfTest::lookUp(uint32_t threadIndex)
+{
+    const vk::GraphicsPipelineDesc *desc = nullptr;
+    vk::PipelineHelper *result           = nullptr;
+
+    // Start each thread at a different pipeline, so they don't all hit the same shard together.
+    size_t hitIndex = threadIndex * 7;
+    for (unsigned int lookup = 0; lookup < kLookupsPerThreadPerStep; ++lookup)
+    {
+        const vk::GraphicsPipelineDesc &hit = mCacheHits[hitIndex % mCacheHits.size()];
+        ++hitIndex;
+
+        bool found = false;
+        if (GetParam().concurrentCache)
+        {
+            found = mConcurrentCache.getPipeline(hit, &desc, &result);
+        }
+        else
+        {
+            std::lock_guard<std::mutex> lock(mCacheMutex);
+            found = mCache.getPipeline(hit, &desc, &result);
+        }
+        ASSERT(found);
+    }
+}
+
+void VulkanConcurrentPipelineCachePerfTest::step()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mPendingThreadCount = mThreads.size();
+        ++mStep;
+    }
+    mStepCondition.notify_all();
+
+    lookUp(0);
+
+    std::unique_lock<std::mutex> lock(mMutex);
+    mDoneCondition.wait(lock, [&]() { return mPendingThreadCount == 0; });
+}
+
 }  // anonymous namespace
 
 // Test performance of pipeline hash and look up in Vulkan
@@ -153,3 +344,17 @@ TEST_P(VulkanPipelineCachePerfTest, Run)
 INSTANTIATE_TEST_SUITE_P(,
                          VulkanPipelineCachePerfTest,
                          ::testing::ValuesIn(std::vector<Params>{{Params{false}, Params{true}}}));
+
+// Test lookup throughput of the pipeline cache with multiple threads
+TEST_P(VulkanConcurrentPipelineCachePerfTest, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(,
+                         VulkanConcurrentPipelineCachePerfTest,
+                         ::testing::ValuesIn(std::vector<ConcurrentParams>{
+                             {ConcurrentParams{1, false}, ConcurrentParams{2, false},
+                              ConcurrentParams{4, false}, ConcurrentParams{8, false},
+                              ConcurrentParams{1, true}, ConcurrentParams{2, true},
+                              ConcurrentParams{4, true}, ConcurrentParams{8, true}}}));
@@ -70,6 +70,7 @@ enum class Feature
     ClearsWithGapsNeedFlush,
     ClearToZeroOrOneBroken,
     ClipSrcRegionForBlitFramebuffer,
+    CoalesceAsyncQueueSubmits,
     CompileJobIsThreadSafe,
     CompileMetalShaders,
     CompressVertexData,
@@ -178,6 +179,7 @@ enum class Feature
     ForceFallbackFormat,
     ForceFlushAfterDrawcallUsingShadowmap,
     ForceFragmentShaderPrecisionHighpToMediump,
+    ForceGenerateMipmapOnCPU,
     ForceGlErrorChecking,
     ForceInitShaderVariables,
     ForceMaxUniformBufferSize16KB,
@@ -240,6 +242,7 @@ enum class Feature
     PermanentlySwitchToFramebufferFetchMode,
     PersistentlyMappedBuffers,
     PreAddTexelFetchOffsets,
+    PrecompileRecordedGraphicsPipelines,
     PreemptivelyStartProvokingVertexCommandBuffer,
     PreferAggregateBarrierCalls,
     PreferCachedNoncoherentForDynamicStreamBufferUsage,
@@ -317,6 +320,7 @@ enum class Feature
     SupportsDepthClipControl,
     SupportsDepthStencilIndependentResolveNone,
     SupportsDepthStencilResolve,
+    SupportsDescriptorBuffer,
     SupportsDynamicRendering,
     SupportsDynamicRenderingLocalRead,
     SupportsExtendedDynamicState,
@@ -357,6 +361,7 @@ enum class Feature
     SupportsMaintenance5,
     SupportsMemoryBudget,
     SupportsMixedReadWriteDepthStencilLayouts,
+    SupportsMultiDraw,
     SupportsMultiDrawIndirect,
     SupportsMultisampledRenderToSingleSampled,
     SupportsMultiview,
@@ -370,6 +375,7 @@ enum class Feature
     SupportsPrimitivesGeneratedQuery,
     SupportsPrimitiveTopologyListRestart,
     SupportsProtectedMemory,
+    SupportsPushDescriptor,
     SupportsRasterizationOrderAttachmentAccess,
     SupportsRenderpass2,
     SupportsRenderPassLoadStoreOpNone,
@@ -426,19 +432,24 @@ enum class Feature
     UseDepthCompareOpDynamicState,
     UseDepthTestEnableDynamicState,
     UseDepthWriteEnableDynamicState,
+    UseDescriptorBuffer,
+    UseDescriptorUpdateTemplates,
     UseDualPipelineBlobCacheSlots,
     UseEmptyBlobsToEraseOldPipelineCacheFromBlobCache,
     UseFrontFaceDynamicState,
     UseIntermediateTextureForGenerateMipmap,
     UseMultipleDescriptorsForExternalFormats,
     UseNonZeroStencilWriteMaskStaticState,
+    UsePipelineCacheDiskStore,
     UsePrimitiveRestartEnableDynamicState,
+    UsePushDescriptorsForDefaultUniforms,
     UseRasterizerDiscardEnableDynamicState,
     UseResetCommandBufferBitForSecondaryPools,
     UseShadowBuffersWhenAppropriate,
     UseStencilOpDynamicState,
     UseStencilTestEnableDynamicState,
     UseSystemMemoryForConstantBuffers,
+    UseTimelineSemaphoreForQueueCompletion,
     UseUnusedBlocksWithStandardOrSharedLayout,
     UseVertexInputBindingStrideDynamicState,
     UseVkEventForImageBarrier,